@@ -0,0 +1,723 @@
+/**
+ * @file bplus_tree.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a cache-friendly B+ tree ordered container
+ * @version 0.3
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef BPLUS_TREE_HPP
+#define BPLUS_TREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/*!
+ * @class bplus_tree
+ * @brief B+ Tree class.
+ *
+ * @details An ordered set with the same query surface as bst (insert, find, min, max, successor, predecessor, remove), but with wide nodes instead of binary ones.
+ * Every node is NodeBytes big and aligned to a cache line, and keeps it's keys in one contiguous array, so a lookup takes one or two cache misses per level instead of one per key comparison,
+ * and the tree is only log_B(n) levels deep. All of the keys live in the leaves, which are linked to each other, so in-order scans (see for_each_in_range()) never go back up the tree.
+ *
+ * @note Keys are unique, inserting a key that is already in the tree does nothing.
+ * @note Keys move between nodes when nodes split or merge, so pointers returned by the queries are only valid until the next insert or remove.
+ * @note T has to be default constructible and move assignable, and is compared with operator<.
+ *
+ * @see const T* insert(const T& dt)
+ * @see const T* find(const T& dt)
+ * @see const T* min()
+ * @see const T* max()
+ * @see const T* successor(const T& dt)
+ * @see const T* predecessor(const T& dt)
+ * @see bool remove(const T& dt)
+ * @see void for_each_in_range(const T& lo, const T& hi, Visitor visit)
+ *
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes, rebound to the node types (see node_pool.hpp for a pooled one)
+ * @tparam NodeBytes Size of a single node in bytes, rounded to whole cache lines
+ */
+template <class T, class Alloc = std::allocator<T>, std::size_t NodeBytes = 512>
+class bplus_tree {
+public:
+    using allocator_type = Alloc;
+
+    static constexpr std::size_t cache_line = 64;   /**< Alignment of every node*/
+
+private:
+    /**< Common part of both node kinds, the amount of keys in the node*/
+    struct node_base {
+        std::size_t count = 0;
+    };
+
+    static constexpr std::size_t leaf_fit = (NodeBytes - sizeof(node_base) - 2 * sizeof(void*)) / sizeof(T);
+    static constexpr std::size_t inner_fit = (NodeBytes - sizeof(node_base) - sizeof(void*)) / (sizeof(T) + sizeof(void*));
+
+public:
+    static constexpr std::size_t leaf_capacity = leaf_fit < 4 ? 4 : leaf_fit;     /**< Most keys a leaf can hold*/
+    static constexpr std::size_t inner_capacity = inner_fit < 4 ? 4 : inner_fit;  /**< Most separator keys an inner node can hold*/
+
+private:
+    static constexpr std::size_t leaf_min = leaf_capacity / 2;     /**< Fewest keys a non-root leaf may hold*/
+    static constexpr std::size_t inner_min = inner_capacity / 2;   /**< Fewest keys a non-root inner node may hold*/
+    static constexpr std::size_t max_depth = 64;                   /**< Fan-out is at least 3, so this is never reached*/
+
+    /**< Bottom level node, holds the actual keys, and links to it's neighbours*/
+    struct alignas(cache_line) leaf_node : node_base {
+        leaf_node* prev = nullptr;
+        leaf_node* next = nullptr;
+        T keys[leaf_capacity];
+    };
+
+    /**< Upper level node, keys[i] is the smallest key under children[i + 1]*/
+    struct alignas(cache_line) inner_node : node_base {
+        T keys[inner_capacity];
+        node_base* children[inner_capacity + 1];
+    };
+
+    /**< One step of a root to leaf descent*/
+    struct path_step {
+        inner_node* node;
+        std::size_t child;
+    };
+
+    using leaf_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<leaf_node>;
+    using leaf_traits = std::allocator_traits<leaf_allocator>;
+    using inner_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<inner_node>;
+    using inner_traits = std::allocator_traits<inner_allocator>;
+
+    leaf_allocator leaf_alloc;      /**< Allocator for the leaves*/
+    inner_allocator inner_alloc;    /**< Allocator for the inner nodes*/
+    node_base* root;                /**< Root node, a leaf while height is 1 [nullptr if the tree is empty]*/
+    leaf_node* first_leaf;          /**< Leaf with the smallest keys*/
+    leaf_node* last_leaf;           /**< Leaf with the largest keys*/
+    std::size_t height;             /**< Amount of levels, including the leaves*/
+    std::size_t len;                /**< Amount of keys in the tree*/
+
+public:
+    /**
+     * Creates a new, empty B+ tree.
+     * @brief Default Constructor.
+     */
+    bplus_tree()
+        : bplus_tree{Alloc()} { }
+
+    /**
+     * Creates a new, empty B+ tree, which allocates it's nodes with the provided allocator.
+     * @brief Constructor.
+     */
+    explicit bplus_tree(const Alloc& allocator)
+        : leaf_alloc{allocator}, inner_alloc{allocator}, root{nullptr}, first_leaf{nullptr}, last_leaf{nullptr}, height{0}, len{0} { }
+
+    /**
+     * Creates a new B+ tree with a copy of every key of the provided tree.
+     * @brief Copy Constructor.
+     */
+    bplus_tree(const bplus_tree& tree);
+
+    /**
+     * Creates a new B+ tree, by taking over the nodes of the provided tree, which is left empty.
+     * @brief Move Constructor.
+     */
+    bplus_tree(bplus_tree&& tree) noexcept;
+
+    bplus_tree& operator=(const bplus_tree& tree);
+    bplus_tree& operator=(bplus_tree&& tree) noexcept;
+
+    /**
+     * Frees every node of the tree.
+     * @brief Destructor.
+     */
+    ~bplus_tree() {clear();}
+
+    /**
+     * @brief Inserts the provided key into the tree.
+     * @param dt Key to be inserted.
+     * @return Pointer to the inserted key [nullptr if the key was already in the tree].
+     */
+    const T* insert(const T& dt) {return emplace_key(dt);}
+
+    /**
+     * @brief Moves the provided key into the tree.
+     * @param dt Key to be inserted.
+     * @return Pointer to the inserted key [nullptr if the key was already in the tree].
+     */
+    const T* insert(T&& dt) {return emplace_key(std::move(dt));}
+
+    /**
+     * @brief Looks for the provided key.
+     * @param dt Key to be found.
+     * @return Pointer to the key inside of the tree [nullptr if it isn't in the tree].
+     */
+    const T* find(const T& dt) const;
+
+    /**
+     * @brief Returns the smallest key in the tree.
+     * @return Pointer to the smallest key [nullptr if the tree is empty].
+     */
+    const T* min() const {
+        return len == 0 ? nullptr : &first_leaf->keys[0];
+    }
+
+    /**
+     * @brief Returns the largest key in the tree.
+     * @return Pointer to the largest key [nullptr if the tree is empty].
+     */
+    const T* max() const {
+        return len == 0 ? nullptr : &last_leaf->keys[last_leaf->count - 1];
+    }
+
+    /**
+     * @brief Returns the smallest key, which is larger than the provided one. The provided key doesn't have to be in the tree.
+     * @param dt Key who's successor is looked for.
+     * @return Pointer to the successor [nullptr if there is none].
+     */
+    const T* successor(const T& dt) const;
+
+    /**
+     * @brief Returns the largest key, which is smaller than the provided one. The provided key doesn't have to be in the tree.
+     * @param dt Key who's predecessor is looked for.
+     * @return Pointer to the predecessor [nullptr if there is none].
+     */
+    const T* predecessor(const T& dt) const;
+
+    /**
+     * @brief Removes the provided key from the tree.
+     * @param dt Key to be removed.
+     * @return true if the key was removed, false if it wasn't in the tree.
+     */
+    bool remove(const T& dt);
+
+    /**
+     * @brief Calls visit(key) for every key in [lo, hi), in order, walking along the linked leaves.
+     * @param lo Smallest key to visit.
+     * @param hi Key at which to stop (not visited).
+     * @param visit Callable, which takes a const T&.
+     */
+    template <class Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor visit) const;
+
+    /**
+     * @brief Returns the amount of keys in the tree.
+     */
+    std::size_t size() const {return len;}
+
+    /**
+     * @brief Returns true if the tree holds no keys.
+     */
+    bool empty() const {return len == 0;}
+
+    /**
+     * @brief Frees every node of the tree, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * @brief Returns a copy of the allocator used by the tree.
+     */
+    allocator_type get_allocator() const {return allocator_type(leaf_alloc);}
+
+private:
+    /**
+     * @brief Index of the child of an inner node, under which the provided key belongs.
+     */
+    static std::size_t child_index(const inner_node* nd, const T& dt) {
+        return static_cast<std::size_t>(std::upper_bound(nd->keys, nd->keys + nd->count, dt) - nd->keys);
+    }
+
+    /**
+     * @brief Descends from the root to the leaf, under which the provided key belongs.
+     * @param dt Key to look for.
+     * @param path Optional array of at least max_depth steps, which records the descent.
+     * @return The leaf.
+     */
+    leaf_node* descend(const T& dt, path_step* path) const;
+
+    leaf_node* create_leaf();
+    inner_node* create_inner();
+    void destroy_leaf(leaf_node* nd);
+    void destroy_inner(inner_node* nd);
+
+    template <class U>
+    const T* emplace_key(U&& dt);
+
+    /**
+     * @brief Inserts a separator key and a new right child into the parents on the path, splitting them as needed.
+     * @param path Descent which led to the split node.
+     * @param depth Amount of steps in the path.
+     * @param sep Smallest key of the new right node.
+     * @param right The new right node.
+     */
+    void insert_into_parent(path_step* path, std::size_t depth, T sep, node_base* right);
+
+    /**
+     * @brief Fixes an inner node, which has too few keys, by borrowing from or merging with a sibling.
+     * @param path Descent which led to the node (the node is path[depth].node).
+     * @param depth Index of the node in the path.
+     */
+    void fix_inner(path_step* path, std::size_t depth);
+};
+
+template <class T, class Alloc, std::size_t NodeBytes>
+typename bplus_tree<T, Alloc, NodeBytes>::leaf_node* bplus_tree<T, Alloc, NodeBytes>::create_leaf() {
+    leaf_node* nd = leaf_traits::allocate(leaf_alloc, 1);
+    try {
+        leaf_traits::construct(leaf_alloc, nd);
+    }
+    catch (...) {
+        leaf_traits::deallocate(leaf_alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+typename bplus_tree<T, Alloc, NodeBytes>::inner_node* bplus_tree<T, Alloc, NodeBytes>::create_inner() {
+    inner_node* nd = inner_traits::allocate(inner_alloc, 1);
+    try {
+        inner_traits::construct(inner_alloc, nd);
+    }
+    catch (...) {
+        inner_traits::deallocate(inner_alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+void bplus_tree<T, Alloc, NodeBytes>::destroy_leaf(leaf_node* nd) {
+    leaf_traits::destroy(leaf_alloc, nd);
+    leaf_traits::deallocate(leaf_alloc, nd, 1);
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+void bplus_tree<T, Alloc, NodeBytes>::destroy_inner(inner_node* nd) {
+    inner_traits::destroy(inner_alloc, nd);
+    inner_traits::deallocate(inner_alloc, nd, 1);
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+bplus_tree<T, Alloc, NodeBytes>::bplus_tree(const bplus_tree& tree)
+    : leaf_alloc{leaf_traits::select_on_container_copy_construction(tree.leaf_alloc)},
+      inner_alloc{inner_traits::select_on_container_copy_construction(tree.inner_alloc)},
+      root{nullptr}, first_leaf{nullptr}, last_leaf{nullptr}, height{0}, len{0} {
+    for (const leaf_node* lf = tree.first_leaf; lf != nullptr; lf = lf->next)
+        for (std::size_t i = 0; i < lf->count; ++i)
+            insert(lf->keys[i]);
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+bplus_tree<T, Alloc, NodeBytes>::bplus_tree(bplus_tree&& tree) noexcept
+    : leaf_alloc{std::move(tree.leaf_alloc)}, inner_alloc{std::move(tree.inner_alloc)},
+      root{tree.root}, first_leaf{tree.first_leaf}, last_leaf{tree.last_leaf}, height{tree.height}, len{tree.len} {
+    tree.root = nullptr;
+    tree.first_leaf = tree.last_leaf = nullptr;
+    tree.height = tree.len = 0;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+bplus_tree<T, Alloc, NodeBytes>& bplus_tree<T, Alloc, NodeBytes>::operator=(const bplus_tree& tree) {
+    if (this != &tree) {
+        clear();
+        for (const leaf_node* lf = tree.first_leaf; lf != nullptr; lf = lf->next)
+            for (std::size_t i = 0; i < lf->count; ++i)
+                insert(lf->keys[i]);
+    }
+    return *this;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+bplus_tree<T, Alloc, NodeBytes>& bplus_tree<T, Alloc, NodeBytes>::operator=(bplus_tree&& tree) noexcept {
+    if (this != &tree) {
+        // Our nodes have to be freed with our own allocators, before they get replaced
+        clear();
+        leaf_alloc = std::move(tree.leaf_alloc);
+        inner_alloc = std::move(tree.inner_alloc);
+        root = tree.root;
+        first_leaf = tree.first_leaf;
+        last_leaf = tree.last_leaf;
+        height = tree.height;
+        len = tree.len;
+        tree.root = nullptr;
+        tree.first_leaf = tree.last_leaf = nullptr;
+        tree.height = tree.len = 0;
+    }
+    return *this;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+void bplus_tree<T, Alloc, NodeBytes>::clear() {
+    if (root == nullptr)
+        return;
+
+    // Inner nodes go depth-first with an explicit stack (the tree is at most max_depth levels deep)
+    if (height > 1) {
+        struct frame {
+            inner_node* node;
+            std::size_t next_child;
+        };
+        frame stack[max_depth];
+        std::size_t depth = 0;
+        stack[depth++] = frame{static_cast<inner_node*>(root), 0};
+        while (depth > 0) {
+            frame& top = stack[depth - 1];
+            // Children of the bottom inner level are leaves, which are freed below through the leaf links
+            if (depth == height - 1 || top.next_child > top.node->count) {
+                destroy_inner(top.node);
+                --depth;
+                continue;
+            }
+            node_base* child = top.node->children[top.next_child++];
+            stack[depth++] = frame{static_cast<inner_node*>(child), 0};
+        }
+    }
+
+    // Leaves are linked, no descent needed
+    leaf_node* lf = first_leaf;
+    while (lf != nullptr) {
+        leaf_node* next = lf->next;
+        destroy_leaf(lf);
+        lf = next;
+    }
+
+    root = nullptr;
+    first_leaf = last_leaf = nullptr;
+    height = len = 0;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+typename bplus_tree<T, Alloc, NodeBytes>::leaf_node* bplus_tree<T, Alloc, NodeBytes>::descend(const T& dt, path_step* path) const {
+    node_base* nd = root;
+    for (std::size_t level = 0; level + 1 < height; ++level) {
+        inner_node* inner = static_cast<inner_node*>(nd);
+        const std::size_t idx = child_index(inner, dt);
+        if (path != nullptr)
+            path[level] = path_step{inner, idx};
+        nd = inner->children[idx];
+    }
+    return static_cast<leaf_node*>(nd);
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+const T* bplus_tree<T, Alloc, NodeBytes>::find(const T& dt) const {
+    if (root == nullptr)
+        return nullptr;
+
+    const leaf_node* lf = descend(dt, nullptr);
+    const T* pos = std::lower_bound(lf->keys, lf->keys + lf->count, dt);
+    if (pos != lf->keys + lf->count && !(dt < *pos))
+        return pos;
+    return nullptr;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+const T* bplus_tree<T, Alloc, NodeBytes>::successor(const T& dt) const {
+    if (root == nullptr)
+        return nullptr;
+
+    const leaf_node* lf = descend(dt, nullptr);
+    const std::size_t idx = static_cast<std::size_t>(std::upper_bound(lf->keys, lf->keys + lf->count, dt) - lf->keys);
+    if (idx < lf->count)
+        return &lf->keys[idx];
+
+    // Everything in the next leaf is larger than dt
+    return lf->next == nullptr ? nullptr : &lf->next->keys[0];
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+const T* bplus_tree<T, Alloc, NodeBytes>::predecessor(const T& dt) const {
+    if (root == nullptr)
+        return nullptr;
+
+    const leaf_node* lf = descend(dt, nullptr);
+    const std::size_t idx = static_cast<std::size_t>(std::lower_bound(lf->keys, lf->keys + lf->count, dt) - lf->keys);
+    if (idx > 0)
+        return &lf->keys[idx - 1];
+
+    // Everything in the previous leaf is smaller than dt
+    return lf->prev == nullptr ? nullptr : &lf->prev->keys[lf->prev->count - 1];
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+template <class Visitor>
+void bplus_tree<T, Alloc, NodeBytes>::for_each_in_range(const T& lo, const T& hi, Visitor visit) const {
+    if (root == nullptr)
+        return;
+
+    // One descent to find the start, then only the leaf links
+    const leaf_node* lf = descend(lo, nullptr);
+    std::size_t idx = static_cast<std::size_t>(std::lower_bound(lf->keys, lf->keys + lf->count, lo) - lf->keys);
+    while (lf != nullptr) {
+        for (; idx < lf->count; ++idx) {
+            if (!(lf->keys[idx] < hi))
+                return;
+            visit(lf->keys[idx]);
+        }
+        lf = lf->next;
+        idx = 0;
+    }
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+template <class U>
+const T* bplus_tree<T, Alloc, NodeBytes>::emplace_key(U&& dt) {
+    // First key of the tree
+    if (root == nullptr) {
+        leaf_node* lf = create_leaf();
+        lf->keys[0] = std::forward<U>(dt);
+        lf->count = 1;
+        root = first_leaf = last_leaf = lf;
+        height = 1;
+        len = 1;
+        return &lf->keys[0];
+    }
+
+    path_step path[max_depth];
+    leaf_node* lf = descend(dt, path);
+    std::size_t idx = static_cast<std::size_t>(std::lower_bound(lf->keys, lf->keys + lf->count, dt) - lf->keys);
+
+    // Already in the tree
+    if (idx < lf->count && !(dt < lf->keys[idx]))
+        return nullptr;
+
+    // Room left in the leaf, just shift the larger keys over
+    if (lf->count < leaf_capacity) {
+        std::move_backward(lf->keys + idx, lf->keys + lf->count, lf->keys + lf->count + 1);
+        lf->keys[idx] = std::forward<U>(dt);
+        ++lf->count;
+        ++len;
+        return &lf->keys[idx];
+    }
+
+    // The leaf is full, split it in half and link the new leaf after it
+    leaf_node* right = create_leaf();
+    const std::size_t split = (leaf_capacity + 1) / 2;
+    std::move(lf->keys + split, lf->keys + leaf_capacity, right->keys);
+    right->count = leaf_capacity - split;
+    lf->count = split;
+
+    right->prev = lf;
+    right->next = lf->next;
+    if (lf->next != nullptr)
+        lf->next->prev = right;
+    else
+        last_leaf = right;
+    lf->next = right;
+
+    // Put the key into whichever half it belongs to
+    leaf_node* target = lf;
+    if (idx > split) {
+        target = right;
+        idx -= split;
+    }
+    std::move_backward(target->keys + idx, target->keys + target->count, target->keys + target->count + 1);
+    target->keys[idx] = std::forward<U>(dt);
+    ++target->count;
+    ++len;
+    const T* inserted = &target->keys[idx];
+
+    insert_into_parent(path, height - 1, right->keys[0], right);
+    return inserted;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+void bplus_tree<T, Alloc, NodeBytes>::insert_into_parent(path_step* path, std::size_t depth, T sep, node_base* right) {
+    while (true) {
+        // The root was split, grow the tree by one level
+        if (depth == 0) {
+            inner_node* new_root = create_inner();
+            new_root->keys[0] = std::move(sep);
+            new_root->children[0] = root;
+            new_root->children[1] = right;
+            new_root->count = 1;
+            root = new_root;
+            ++height;
+            return;
+        }
+
+        inner_node* parent = path[depth - 1].node;
+        const std::size_t pos = path[depth - 1].child;
+
+        // Room left, shift the keys and children over
+        if (parent->count < inner_capacity) {
+            std::move_backward(parent->keys + pos, parent->keys + parent->count, parent->keys + parent->count + 1);
+            std::copy_backward(parent->children + pos + 1, parent->children + parent->count + 1, parent->children + parent->count + 2);
+            parent->keys[pos] = std::move(sep);
+            parent->children[pos + 1] = right;
+            ++parent->count;
+            return;
+        }
+
+        // The parent is full, lay out all keys and children in order, then split them around the middle key
+        T keys[inner_capacity + 1];
+        node_base* children[inner_capacity + 2];
+        std::move(parent->keys, parent->keys + pos, keys);
+        keys[pos] = std::move(sep);
+        std::move(parent->keys + pos, parent->keys + inner_capacity, keys + pos + 1);
+        std::copy(parent->children, parent->children + pos + 1, children);
+        children[pos + 1] = right;
+        std::copy(parent->children + pos + 1, parent->children + inner_capacity + 1, children + pos + 2);
+
+        const std::size_t mid = (inner_capacity + 1) / 2;
+        inner_node* sibling = create_inner();
+
+        std::move(keys, keys + mid, parent->keys);
+        std::copy(children, children + mid + 1, parent->children);
+        parent->count = mid;
+
+        std::move(keys + mid + 1, keys + inner_capacity + 1, sibling->keys);
+        std::copy(children + mid + 1, children + inner_capacity + 2, sibling->children);
+        sibling->count = inner_capacity - mid;
+
+        // The middle key moves up a level
+        sep = std::move(keys[mid]);
+        right = sibling;
+        --depth;
+    }
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+bool bplus_tree<T, Alloc, NodeBytes>::remove(const T& dt) {
+    if (root == nullptr)
+        return false;
+
+    path_step path[max_depth];
+    leaf_node* lf = descend(dt, path);
+    const std::size_t idx = static_cast<std::size_t>(std::lower_bound(lf->keys, lf->keys + lf->count, dt) - lf->keys);
+    if (idx == lf->count || dt < lf->keys[idx])
+        return false;
+
+    std::move(lf->keys + idx + 1, lf->keys + lf->count, lf->keys + idx);
+    --lf->count;
+    --len;
+
+    // The root leaf may hold any amount of keys
+    if (height == 1) {
+        if (lf->count == 0) {
+            destroy_leaf(lf);
+            root = nullptr;
+            first_leaf = last_leaf = nullptr;
+            height = 0;
+        }
+        return true;
+    }
+
+    if (lf->count >= leaf_min)
+        return true;
+
+    // Too few keys left, borrow from a sibling or merge with it
+    inner_node* parent = path[height - 2].node;
+    const std::size_t pos = path[height - 2].child;
+    leaf_node* left = pos > 0 ? static_cast<leaf_node*>(parent->children[pos - 1]) : nullptr;
+    leaf_node* right = pos < parent->count ? static_cast<leaf_node*>(parent->children[pos + 1]) : nullptr;
+
+    if (left != nullptr && left->count > leaf_min) {
+        std::move_backward(lf->keys, lf->keys + lf->count, lf->keys + lf->count + 1);
+        lf->keys[0] = std::move(left->keys[left->count - 1]);
+        --left->count;
+        ++lf->count;
+        parent->keys[pos - 1] = lf->keys[0];
+        return true;
+    }
+
+    if (right != nullptr && right->count > leaf_min) {
+        lf->keys[lf->count] = std::move(right->keys[0]);
+        ++lf->count;
+        std::move(right->keys + 1, right->keys + right->count, right->keys);
+        --right->count;
+        parent->keys[pos] = right->keys[0];
+        return true;
+    }
+
+    // Merge the right one of the pair into the left one, and drop it from the parent
+    leaf_node* keep = left != nullptr ? left : lf;
+    leaf_node* gone = left != nullptr ? lf : right;
+    const std::size_t gone_pos = left != nullptr ? pos : pos + 1;
+
+    std::move(gone->keys, gone->keys + gone->count, keep->keys + keep->count);
+    keep->count += gone->count;
+    keep->next = gone->next;
+    if (gone->next != nullptr)
+        gone->next->prev = keep;
+    else
+        last_leaf = keep;
+    destroy_leaf(gone);
+
+    std::move(parent->keys + gone_pos, parent->keys + parent->count, parent->keys + gone_pos - 1);
+    std::copy(parent->children + gone_pos + 1, parent->children + parent->count + 1, parent->children + gone_pos);
+    --parent->count;
+
+    fix_inner(path, height - 2);
+    return true;
+}
+
+template <class T, class Alloc, std::size_t NodeBytes>
+void bplus_tree<T, Alloc, NodeBytes>::fix_inner(path_step* path, std::size_t depth) {
+    while (true) {
+        inner_node* nd = path[depth].node;
+
+        // An empty root only has a single child left, which becomes the new root
+        if (depth == 0) {
+            if (nd->count == 0) {
+                root = nd->children[0];
+                destroy_inner(nd);
+                --height;
+            }
+            return;
+        }
+
+        if (nd->count >= inner_min)
+            return;
+
+        inner_node* parent = path[depth - 1].node;
+        const std::size_t pos = path[depth - 1].child;
+        inner_node* left = pos > 0 ? static_cast<inner_node*>(parent->children[pos - 1]) : nullptr;
+        inner_node* right = pos < parent->count ? static_cast<inner_node*>(parent->children[pos + 1]) : nullptr;
+
+        // Rotate a key through the parent from the left sibling
+        if (left != nullptr && left->count > inner_min) {
+            std::move_backward(nd->keys, nd->keys + nd->count, nd->keys + nd->count + 1);
+            std::copy_backward(nd->children, nd->children + nd->count + 1, nd->children + nd->count + 2);
+            nd->keys[0] = std::move(parent->keys[pos - 1]);
+            nd->children[0] = left->children[left->count];
+            parent->keys[pos - 1] = std::move(left->keys[left->count - 1]);
+            --left->count;
+            ++nd->count;
+            return;
+        }
+
+        // Rotate a key through the parent from the right sibling
+        if (right != nullptr && right->count > inner_min) {
+            nd->keys[nd->count] = std::move(parent->keys[pos]);
+            nd->children[nd->count + 1] = right->children[0];
+            ++nd->count;
+            parent->keys[pos] = std::move(right->keys[0]);
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            std::copy(right->children + 1, right->children + right->count + 1, right->children);
+            --right->count;
+            return;
+        }
+
+        // Merge the pair, pulling their separator down from the parent
+        inner_node* keep = left != nullptr ? left : nd;
+        inner_node* gone = left != nullptr ? nd : right;
+        const std::size_t gone_pos = left != nullptr ? pos : pos + 1;
+
+        keep->keys[keep->count] = std::move(parent->keys[gone_pos - 1]);
+        std::move(gone->keys, gone->keys + gone->count, keep->keys + keep->count + 1);
+        std::copy(gone->children, gone->children + gone->count + 1, keep->children + keep->count + 1);
+        keep->count += gone->count + 1;
+        destroy_inner(gone);
+
+        std::move(parent->keys + gone_pos, parent->keys + parent->count, parent->keys + gone_pos - 1);
+        std::copy(parent->children + gone_pos + 1, parent->children + parent->count + 1, parent->children + gone_pos);
+        --parent->count;
+
+        --depth;
+    }
+}
+
+#endif // BPLUS_TREE_HPP
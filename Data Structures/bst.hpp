@@ -11,26 +11,55 @@
 #ifndef BST_HPP
 #define BST_HPP
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/**< Height of the sub-tree rooted at a node (a leaf has a height of 1), only stored in the nodes of balanced trees*/
+template <bool Stored>
+struct bst_node_height {
+  int height = 1;
+};
+
+template <>
+struct bst_node_height<false> { };
+
+/**< Amount of nodes in the sub-tree rooted at a node (a leaf has a size of 1), only stored in the nodes of ranked trees*/
+template <bool Stored>
+struct bst_node_size {
+  std::size_t size = 1;
+};
+
+template <>
+struct bst_node_size<false> { };
+
 /*!
  * @class bst_node
  * @brief Binary Search Tree Node class.
  * 
  * @details A Node class tailored to work with binary search trees.
+ * The height and sub-tree size only exist in nodes of trees which keep them up to date (they come from empty base classes otherwise), so a plain bst_node<T> is just three pointers and the data.
  * 
  * @tparam T typename
+ * @tparam Balanced Stores the height of the node's sub-tree [for balanced trees, see bst_avl]
+ * @tparam Ranked Stores the size of the node's sub-tree [for ranked trees]
  */
-template <class T>
-class bst_node {
+template <class T, bool Balanced = false, bool Ranked = false>
+class bst_node : public bst_node_height<Balanced>, public bst_node_size<Ranked> {
 public:
-  bst_node<T>* left;    /**< Pointer to the left branch of this node*/
-  bst_node<T>* right;   /**< Pointer to the right branch of this node.*/
-  bst_node<T>* parent;  /**< Pointer to the parent node of this node.*/
+  static constexpr bool balanced = Balanced;
+  static constexpr bool ranked = Ranked;
+
+  bst_node* left;       /**< Pointer to the left branch of this node*/
+  bst_node* right;      /**< Pointer to the right branch of this node.*/
+  bst_node* parent;     /**< Pointer to the parent node of this node.*/
   T data;               /**< Data that this node contains.*/
 
   /**
    * Creates a new bst_node object, that points to null in every direction, and has no data value.
    * @brief Default Constructor.
-   * @see bst_node(T dt)
+   * @see bst_node(const T& dt)
    */
   bst_node()
     : bst_node{T()} { }
@@ -40,21 +69,211 @@ public:
    * @brief Constructor.
    * @see bst_node()
    */
-  bst_node(T dt) 
+  bst_node(const T& dt) 
     : left{nullptr}, right{nullptr}, parent{nullptr}, data{dt} { }
+
+  /**
+   * Creates a new bst_node object, that points to null in every direction, and moves the provided data value into the node.
+   * @brief Constructor.
+   * @see bst_node(const T& dt)
+   */
+  bst_node(T&& dt) 
+    : left{nullptr}, right{nullptr}, parent{nullptr}, data{std::move(dt)} { }
+
+  /**
+   * Creates a new bst_node object, that points to null in every direction, and constructs it's data value in place.
+   * @brief Emplacing Constructor.
+   * @param args Arguments forwarded to T's constructor.
+   * @see bst_node(const T& dt)
+   */
+  template <class... Args>
+  explicit bst_node(std::in_place_t, Args&&... args)
+    : left{nullptr}, right{nullptr}, parent{nullptr}, data(std::forward<Args>(args)...) { }
+};
+
+/*!
+ * @class bst_unbalanced
+ * @brief Balancing policy for bst, which doesn't balance at all.
+ *
+ * @details Nodes stay exactly where they were inserted, so sorted input degenerates the tree into a linked list. This is the default policy of bst.
+ */
+struct bst_unbalanced {
+  static constexpr bool keeps_height = false;   /**< Nodes have no height*/
+
+  /**
+   * @brief Does nothing.
+   * @param root Root of the tree.
+   * @param nd Lowest node, which may have become unbalanced.
+   */
+  template <class Node>
+  static void rebalance(Node*& root, Node* nd) {
+    (void)root;
+    (void)nd;
+  }
 };
 
+/*!
+ * @class bst_avl
+ * @brief Balancing policy for bst, which keeps the tree [AVL](https://en.wikipedia.org/wiki/AVL_tree) balanced.
+ *
+ * @details The heights of two sibling sub-trees never differ by more than 1, so the tree's height stays below 1.44 * log2(n) and insert, find and remove are O(log n), even with sorted input.
+ * Rotations only re-link nodes, data values never move between nodes, so pointers to nodes (and successor/predecessor) stay valid.
+ * Rotations also carry the sub-tree sizes along (when the nodes have them), so the policy works with ranked trees as well.
+ */
+struct bst_avl {
+  static constexpr bool keeps_height = true;    /**< Nodes store the height of their sub-tree*/
+
+  /**
+   * @brief Walks up from the provided node to the root, fixing heights and rotating every sub-tree that became unbalanced.
+   * @param root Root of the tree, updated if a rotation moves it.
+   * @param nd Lowest node, which may have become unbalanced (the parent of an inserted or removed node).
+   */
+  template <class Node>
+  static void rebalance(Node*& root, Node* nd);
+
+private:
+  template <class Node>
+  static int height(const Node* nd) {
+    return nd == nullptr ? 0 : nd->height;
+  }
+
+  template <class Node>
+  static void update_height(Node* nd) {
+    const int left_height = height(nd->left);
+    const int right_height = height(nd->right);
+    nd->height = 1 + (left_height > right_height ? left_height : right_height);
+  }
+
+  template <class Node>
+  static std::size_t subtree_size(const Node* nd) {
+    return nd == nullptr ? 0 : nd->size;
+  }
+
+  /**
+   * @brief Fixes the sub-tree sizes of a rotated pair: the pivot now holds everything nd used to hold.
+   */
+  template <class Node>
+  static void update_size(Node* nd, Node* pivot) {
+    if constexpr (Node::ranked) {
+      pivot->size = nd->size;
+      nd->size = 1 + subtree_size(nd->left) + subtree_size(nd->right);
+    }
+    else {
+      (void)nd;
+      (void)pivot;
+    }
+  }
+
+  /**
+   * @brief Rotates the sub-tree rooted at nd to the left, and returns it's new root (nd's right child).
+   */
+  template <class Node>
+  static Node* rotate_left(Node*& root, Node* nd);
+
+  /**
+   * @brief Rotates the sub-tree rooted at nd to the right, and returns it's new root (nd's left child).
+   */
+  template <class Node>
+  static Node* rotate_right(Node*& root, Node* nd);
+};
+
+template <class Node>
+Node* bst_avl::rotate_left(Node*& root, Node* nd) {
+  Node* pivot = nd->right;
+
+  // The pivot's left branch becomes nd's right branch
+  nd->right = pivot->left;
+  if (pivot->left != nullptr)
+    pivot->left->parent = nd;
+
+  // The pivot takes nd's place under nd's parent
+  pivot->parent = nd->parent;
+  if (nd->parent == nullptr)
+    root = pivot;
+  else if (nd->parent->left == nd)
+    nd->parent->left = pivot;
+  else
+    nd->parent->right = pivot;
+
+  // And nd goes down to the left
+  pivot->left = nd;
+  nd->parent = pivot;
+
+  update_height(nd);
+  update_height(pivot);
+  update_size(nd, pivot);
+  return pivot;
+}
+
+template <class Node>
+Node* bst_avl::rotate_right(Node*& root, Node* nd) {
+  Node* pivot = nd->left;
+
+  // The pivot's right branch becomes nd's left branch
+  nd->left = pivot->right;
+  if (pivot->right != nullptr)
+    pivot->right->parent = nd;
+
+  // The pivot takes nd's place under nd's parent
+  pivot->parent = nd->parent;
+  if (nd->parent == nullptr)
+    root = pivot;
+  else if (nd->parent->left == nd)
+    nd->parent->left = pivot;
+  else
+    nd->parent->right = pivot;
+
+  // And nd goes down to the right
+  pivot->right = nd;
+  nd->parent = pivot;
+
+  update_height(nd);
+  update_height(pivot);
+  update_size(nd, pivot);
+  return pivot;
+}
+
+template <class Node>
+void bst_avl::rebalance(Node*& root, Node* nd) {
+  while (nd != nullptr) {
+    update_height(nd);
+    const int balance = height(nd->left) - height(nd->right);
+
+    // Left side is too tall
+    if (balance > 1) {
+      // Left-right case, turn it into a left-left case first
+      if (height(nd->left->left) < height(nd->left->right))
+        rotate_left(root, nd->left);
+      nd = rotate_right(root, nd);
+    }
+
+    // Right side is too tall
+    else if (balance < -1) {
+      // Right-left case, turn it into a right-right case first
+      if (height(nd->right->right) < height(nd->right->left))
+        rotate_right(root, nd->right);
+      nd = rotate_left(root, nd);
+    }
+
+    // Move up by 1 level
+    nd = nd->parent;
+  }
+}
+
 /*!
  * @class bst
  * @brief Binary Search Tree class.
  * 
  * @details A non-linear, hierarchical data structure class, a very simple and common data structure. Supports insertion, deletion, searching, and dynamic types.
+ * The tree owns all of it's nodes, and frees them on removal and on destruction.
  * 
- * @see bst_node<T>* insert(T dt)
- * @see bst_node<T>* insert(bst_node<T>* nd, T data)
+ * @see bst_node<T>* insert(const T& dt)
+ * @see bst_node<T>* insert(T&& dt)
+ * @see bst_node<T>* insert(bst_node<T>* nd, const T& data)
+ * @see bst_node<T>* emplace(Args&&... args)
  *
- * @see bst_node<T>* find(bst_node<T>* nd, T dt)
- * @see bst_node<T>* find(T dt)
+ * @see bst_node<T>* find(bst_node<T>* nd, const T& dt)
+ * @see bst_node<T>* find(const T& dt)
  *
  * @see bst_node<T>* min(bst_node<T>* nd)
  * @see bst_node<T>* min()
@@ -63,22 +282,165 @@ public:
  * @see bst_node<T>* max()
  *
  * @see bst_node<T>* successor(bst_node<T>* nd)
- * @see bst_node<T>* successor(T dt)
+ * @see bst_node<T>* successor(const T& dt)
  *
  * @see bst_node<T>* predecessor(bst_node<T>* nd)
- * @see bst_node<T>* predecessor(T dt)
+ * @see bst_node<T>* predecessor(const T& dt)
+ *
+ * @see const_iterator lower_bound(const T& dt)
+ * @see const_iterator upper_bound(const T& dt)
+ * @see std::pair<const_iterator, const_iterator> equal_range(const T& dt)
+ * @see void for_each_in_range(const T& lo, const T& hi, Visitor visit)
  *
- * @see bst_node<T>* remove(bst_node<T>* nd, T dt)
- * @see bst_node<T>* remove(T dt)
+ * @see bst_node<T>* remove(bst_node<T>* nd, const T& dt)
+ * @see bst_node<T>* remove(const T& dt)
+ *
+ * @see bst_node<T>* select(std::size_t k)
+ * @see std::size_t rank(const T& dt)
+ *
+ * @see iterator begin()
+ * @see iterator end()
  *
  * @see bst_node<T>* get_root()
+ * @see clear()
+ * @see get_allocator()
  * 
  * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes, rebound to bst_node<T> (see node_pool.hpp for a pooled one)
+ * @tparam Balance Balancing policy, bst_unbalanced (default) or bst_avl. See avl_tree.
+ * @tparam Ranked Keeps the sub-tree size of every node up to date, which enables select() and rank(). Costs an extra walk up to the root on every insert and remove. See ranked_avl_tree.
  */
-template <class T>
+template <class T, class Alloc = std::allocator<T>, class Balance = bst_unbalanced, bool Ranked = false>
 class bst {
+public:
+  using allocator_type = Alloc;
+  using value_type = T;
+  using node_type = bst_node<T, Balance::keeps_height, Ranked>;   /**< Node layout, with only the fields the policies use*/
+
+  /*!
+   * @class const_iterator
+   * @brief In-order bidirectional iterator over the data values of a bst.
+   *
+   * @details Steps with successor()/predecessor(), climbing through the parent pointers when needed. Every edge of the tree is walked at most twice during a full scan, so a step is amortized O(1).
+   * The data values are read-only, since changing them would break the tree's ordering. end() remembers it's tree, so it can be decremented back onto the largest value.
+   */
+  class const_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator()
+      : nd{nullptr}, tree{nullptr} { }
+
+    const_iterator(node_type* n, const bst* owner)
+      : nd{n}, tree{owner} { }
+
+    reference operator*() const {return nd->data;}
+    pointer operator->() const {return &nd->data;}
+
+    const_iterator& operator++() {
+      nd = bst::successor(nd);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++(*this);
+      return old;
+    }
+
+    const_iterator& operator--() {
+      // Stepping back from end() lands on the largest value
+      nd = (nd == nullptr) ? bst::max(tree->root) : bst::predecessor(nd);
+      return *this;
+    }
+
+    const_iterator operator--(int) {
+      const_iterator old = *this;
+      --(*this);
+      return old;
+    }
+
+    friend bool operator==(const const_iterator& a, const const_iterator& b) {return a.nd == b.nd;}
+    friend bool operator!=(const const_iterator& a, const const_iterator& b) {return a.nd != b.nd;}
+
+    /**
+     * @brief Returns the node the iterator points to [nullptr for end()].
+     */
+    node_type* get_node() const {return nd;}
+
+  private:
+    node_type* nd;    /**< Current node [nullptr past the end]*/
+    const bst* tree;    /**< Tree which is being iterated, used to step back from end()*/
+  };
+
+  using iterator = const_iterator;
+  using reverse_iterator = std::reverse_iterator<const_iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
 private:
-  bst_node<T>* root;  /**< Pointer to the root node of this tree*/
+  using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator alloc; /**< Allocator which creates and frees every node of the tree*/
+  node_type* root;    /**< Pointer to the root node of this tree*/
+
+  /**
+   * @brief Allocates a node using the tree's allocator, and constructs it's data value in place.
+   * @param args Arguments forwarded to T's constructor.
+   * @return The new node.
+   */
+  template <class... Args>
+  node_type* create_node(Args&&... args);
+
+  /**
+   * @brief Destroys and deallocates a node, that was created by create_node().
+   * @param nd Node to be freed.
+   */
+  void destroy_node(node_type* nd);
+
+  /**
+   * @brief Copies every node of the provided tree into this (empty) tree, keeping the same shape.
+   * @param tree Tree to copy from.
+   */
+  void copy_from(const bst& tree);
+
+  /**
+   * @brief Puts new_node (and it's sub-tree) in the place of old_node, under old_node's parent.
+   * @param old_node Node which is being replaced.
+   * @param new_node Node which replaces it [may be nullptr].
+   */
+  void transplant(node_type* old_node, node_type* new_node);
+
+  /**
+   * @brief Unlinks the provided node from the tree, frees it, and rebalances the tree.
+   * @param nd Node to be removed.
+   * @return The node which came after the removed node [nullptr if it was the largest one].
+   */
+  node_type* erase_node(node_type* nd);
+
+  /**
+   * @brief Links an already created node into the tree, walking down from the provided node, and rebalances the tree.
+   * @param nd Node from which to search for a valid place [nullptr to start from the root].
+   * @param inserted_node Node to be linked.
+   * @return The linked node.
+   */
+  node_type* link_node(node_type* nd, node_type* inserted_node);
+
+  /**
+   * @brief Adds delta to the sub-tree size of the provided node, and every node above it. Does nothing for trees which aren't ranked.
+   * @param nd Lowest node whose sub-tree changed.
+   * @param delta +1 after a node was linked, -1 after one was unlinked.
+   */
+  static void update_sizes(node_type* nd, int delta);
+
+  /**
+   * @brief Copies the height and sub-tree size of a node, for the ones the nodes have.
+   */
+  static void copy_augments(node_type* dst, const node_type* src);
 
 public:
   /**
@@ -87,43 +449,96 @@ public:
    * @see bst(T dt)
    */
   bst()
-    : root{nullptr} { }
+    : bst{Alloc()} { }
+
+  /**
+   * Creates a new bst object, that has a nullptr root, and allocates it's nodes with the provided allocator.
+   * @brief Constructor.
+   * @see bst()
+   */
+  explicit bst(const Alloc& allocator)
+    : alloc{allocator}, root{nullptr} { }
 
   /**
    * Creates a new bst object, that has a root with the provided data value.
    * @brief Constructor.
    * @see bst()
    */
-  bst(T dt)
-    : root{new bst_node<T>(dt)} { }
+  bst(const T& dt)
+    : alloc{}, root{create_node(dt)} { }
+
+  /**
+   * Creates a new bst object, with a copy of every node of the provided tree, in the same shape.
+   * @brief Copy Constructor.
+   */
+  bst(const bst& tree);
+
+  /**
+   * Creates a new bst object, by taking over the nodes of the provided tree, which is left empty.
+   * @brief Move Constructor.
+   */
+  bst(bst&& tree) noexcept;
+
+  /**
+   * @brief Replaces the tree's nodes with copies of the nodes of the provided tree.
+   */
+  bst& operator=(const bst& tree);
+
+  /**
+   * @brief Frees the tree's nodes, and takes over the nodes of the provided tree, which is left empty.
+   */
+  bst& operator=(bst&& tree) noexcept;
+
+  /**
+   * Frees every node of the tree.
+   * @brief Destructor.
+   */
+  ~bst();
   
   /**
    * @brief Inserts a node with the provided data value into the tree, starting from the root.
    * @param dt Node data value to be inserted.
-   * @return The newly inserted node [nullptr if no node was inserted].
+   * @return The newly inserted node.
    * @see bst_node<T>* insert(bst_node<T>* nd, T data).
    */
-  bst_node<T>* insert(T dt);
+  node_type* insert(const T& dt);
+
+  /**
+   * @brief Moves the provided data value into a new node, and inserts it into the tree, starting from the root.
+   * @param dt Node data value to be inserted.
+   * @return The newly inserted node.
+   * @see insert(const T& dt)
+   */
+  node_type* insert(T&& dt);
+
+  /**
+   * @brief Constructs a data value in place inside a new node, and inserts it into the tree, starting from the root.
+   * @param args Arguments forwarded to T's constructor.
+   * @return The newly inserted node.
+   * @see insert(const T& dt)
+   */
+  template <class... Args>
+  node_type* emplace(Args&&... args);
 
   /**
    * @brief Inserts a node with the provided data value into the tree, starting from the provided node.
-   * @note This function is used recursively for other purposes! Keep in mind, the value will be inserted from the provided node. This may break the list! Look at bst_node::insert(T dt).
-   * @param nd Node from which to search for a valid place to insert the node.
+   * @note Keep in mind, the value will be inserted from the provided node. This may break the tree's ordering! Look at bst_node::insert(T dt).
+   * @param nd Node from which to search for a valid place to insert the node [nullptr to start from the root].
    * @param dt Node data value to be inserted.
-   * @return The newly inserted node [nullptr if no node was inserted].
+   * @return The newly inserted node.
    * @see insert(T dt)
    */
-  bst_node<T>* insert(bst_node<T>* nd, T data);
+  node_type* insert(node_type* nd, const T& data);
 
   /**
    * @brief Returns the node which contains the provided data value, starting from the provided node.
-   * @note This function is used recursively for other purposes! Keep in mind, the data value will be looked for from the provided node. This may not find the node! Look at bst_node::find(T dt).
+   * @note Keep in mind, the data value will be looked for from the provided node. This may not find the node! Look at bst_node::find(T dt).
    * @param nd Node from which to search for the desired value.
    * @param dt Node data value to be found.
    * @return The found node [nullptr if no node was found or didn't exist].
    * @see find(T dt)
    */
-  bst_node<T>* find(bst_node<T>* nd, T dt);
+  node_type* find(node_type* nd, const T& dt);
 
   /**
    * @brief Returns the node which contains the provided data value, starting from the root.
@@ -131,7 +546,7 @@ public:
    * @return The found node [nullptr if no node was found or didn't exist].
    * @see find(bst_node<T>* nd, T dt)
    */
-  bst_node<T>* find(T dt);
+  node_type* find(const T& dt);
 
   /**
    * @brief Returns the smallest data value in the tree, starting from the provided node.
@@ -139,14 +554,14 @@ public:
    * @return The node with the smallest data value.
    * @see min(bst_node<T>* nd)
    */
-  bst_node<T>* min(bst_node<T>* nd);
+  static node_type* min(node_type* nd);
 
   /**
    * @brief Returns the smallest data value in the tree, starting from the root.
    * @return Node with the smallest data value.
    * @see min(bst_node<T>* nd)
    */
-  bst_node<T>* min();
+  node_type* min();
 
   /**
    * @brief Returns the largest data value in the tree, starting from the provided node.
@@ -154,172 +569,511 @@ public:
    * @return The node with the largest data value.
    * @see max()
    */
-  bst_node<T>* max(bst_node<T>* nd);
+  static node_type* max(node_type* nd);
 
   /**
    * @brief Returns the largest data value in the tree, starting from the root.
    * @return Node with the largest data value.
    * @see min(bst_node<T>* nd)
    */
-  bst_node<T>* max();
+  node_type* max();
 
   /**
    * @brief Returns the [successor](https://www.geeksforgeeks.org/inorder-successor-in-binary-search-tree/) of the provided node.
    * @param nd Node who's successor is looked for.
    * @return Pointer to the successor.
    */
-  bst_node<T>* successor(bst_node<T>* nd);
+  static node_type* successor(node_type* nd);
 
   /**
    * @brief Returns the [successor](https://www.geeksforgeeks.org/inorder-successor-in-binary-search-tree/) of the node, which contains the provided data value.
    * @param dt The data value of the node who's successor is looked for.
    * @return Pointer to the successor.
    */
-  bst_node<T>* successor(T dt);
+  node_type* successor(const T& dt);
 
   /**
    * @brief Returns the [predecessor](https://www.geeksforgeeks.org/inorder-predecessor-successor-given-key-bst/) of the provided node.
    * @param nd Node who's predecessor is looked for.
    * @return Pointer to the predecessor.
    */
-  bst_node<T>* predecessor(bst_node<T>* nd);
+  static node_type* predecessor(node_type* nd);
 
   /**
    * @brief Returns the [predecessor](https://www.geeksforgeeks.org/inorder-predecessor-successor-given-key-bst/) of the node, which contains the provided data value.
    * @param dt The data value of the node who's predecessor is looked for.
    * @return Pointer to the predecessor.
    */
-  bst_node<T>* predecessor(T dt);
+  node_type* predecessor(const T& dt);
+
+  /**
+   * @brief Returns an iterator to the first data value, which is not smaller than the provided one.
+   * @param dt Data value to compare against.
+   * @return Iterator to the found value [end() if every value is smaller].
+   * @see upper_bound(const T& dt)
+   */
+  const_iterator lower_bound(const T& dt) const;
+
+  /**
+   * @brief Returns an iterator to the first data value, which is larger than the provided one.
+   * @param dt Data value to compare against.
+   * @return Iterator to the found value [end() if no value is larger].
+   * @see lower_bound(const T& dt)
+   */
+  const_iterator upper_bound(const T& dt) const;
+
+  /**
+   * @brief Returns the range of data values, which are equal to the provided one.
+   * @param dt Data value to look for.
+   * @return Pair of lower_bound(dt) and upper_bound(dt) [both are equal if the value isn't in the tree].
+   */
+  std::pair<const_iterator, const_iterator> equal_range(const T& dt) const;
+
+  /**
+   * @brief Calls visit(value) for every data value in [lo, hi), in order.
+   * @details Descends from the root only once, to find lo, and then steps along successors, so the whole scan costs O(log n + k) for k visited values.
+   * @param lo Smallest data value to visit.
+   * @param hi Data value at which to stop (not visited).
+   * @param visit Callable, which takes a const T&.
+   */
+  template <class Visitor>
+  void for_each_in_range(const T& lo, const T& hi, Visitor visit) const;
 
   /**
    * @brief Removes the node that contains the provided data value from the provided node.
+   * @note Nodes are re-linked, not copied, so pointers to every other node stay valid.
    * @param nd Node from which to look for the node to be removed
    * @param dt The data value of the node which is being deleted
-   * @return The deleted node
+   * @return The node which came after the deleted node [nullptr if it was the largest one, or if nothing was deleted]
    */
-  bst_node<T>* remove(bst_node<T>* nd, T dt);
+  node_type* remove(node_type* nd, const T& dt);
 
   /**
    * @brief Removes the node that contains the provided data value from the root.
    * @param dt The data value of the node which is being deleted
-   * @return The deleted node
+   * @return The node which came after the deleted node [nullptr if it was the largest one, or if nothing was deleted]
+   */
+  node_type* remove(const T& dt);
+
+  /**
+   * @brief Returns the node with the k-th smallest data value (counting from 0), in O(height).
+   * @note Only available for ranked trees.
+   * @param k Amount of values which come before the wanted one.
+   * @return The found node [nullptr if the tree has k or fewer nodes].
+   * @see rank(const T& dt)
    */
-  bst_node<T>* remove(T dt);
+  node_type* select(std::size_t k) const;
+
+  /**
+   * @brief Returns the amount of data values, which are smaller than the provided one, in O(height).
+   * @note Only available for ranked trees. The value itself doesn't have to be in the tree.
+   * @param dt Data value to compare against.
+   * @return Position the value has (or would have) in the sorted order.
+   * @see select(std::size_t k)
+   */
+  std::size_t rank(const T& dt) const;
 
   /**
    * @brief Returns pointer to the root of this tree.
    * @return The pointer to the root.
    */
-  bst_node<T>* get_root() const {return root;}
+  node_type* get_root() const {return root;}
+
+  /**
+   * @brief Returns an iterator to the smallest data value.
+   * @return Iterator to the smallest value [end() if the tree is empty].
+   */
+  const_iterator begin() const {return const_iterator(min(root), this);}
+  const_iterator cbegin() const {return begin();}
+
+  /**
+   * @brief Returns an iterator past the largest data value.
+   * @return Iterator which points to nothing, but can be decremented onto the largest value.
+   */
+  const_iterator end() const {return const_iterator(nullptr, this);}
+  const_iterator cend() const {return end();}
+
+  /**
+   * @brief Returns reverse iterators, which walk the tree from the largest to the smallest value.
+   */
+  const_reverse_iterator rbegin() const {return const_reverse_iterator(end());}
+  const_reverse_iterator rend() const {return const_reverse_iterator(begin());}
+
+  /**
+   * @brief Frees every node of the tree, leaving it empty.
+   * @note Walks the tree using the parent pointers, so it doesn't depend on the tree's height.
+   */
+  void clear();
+
+  /**
+   * @brief Returns a copy of the allocator used by the tree.
+   * @return The tree's allocator.
+   */
+  allocator_type get_allocator() const {return allocator_type(alloc);}
 };
 
-template <class T>
-bst_node<T>* bst<T>::insert(bst_node<T>* nd, T dt) {
-  // If a point where the node should be inserted has been reached
-  if (nd == nullptr)
-    nd = new bst_node<T>(dt);
+template <class T, class Alloc, class Balance, bool Ranked>
+template <class... Args>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::create_node(Args&&... args) {
+  node_type* nd = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, nd, std::in_place, std::forward<Args>(args)...);
+  }
+  catch (...) {
+    node_traits::deallocate(alloc, nd, 1);
+    throw;
+  }
+  return nd;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::destroy_node(node_type* nd) {
+  node_traits::destroy(alloc, nd);
+  node_traits::deallocate(alloc, nd, 1);
+}
 
-  // If the node should be right of the current node,
-  // And update the parent status of the nodes (there might've been a divorce)
-  else if (nd->data < dt) {
-    nd->right = insert(nd->right, dt);
-    nd->right->parent = nd;
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::copy_from(const bst& tree) {
+  if (tree.root == nullptr)
+    return;
+
+  root = create_node(tree.root->data);
+  copy_augments(root, tree.root);
+
+  // Walk both trees in lock-step (pre-order), using the parent pointers to climb back up
+  const node_type* src = tree.root;
+  node_type* dst = root;
+  while (src != nullptr) {
+    // Copy the left branch first...
+    if (src->left != nullptr && dst->left == nullptr) {
+      dst->left = create_node(src->left->data);
+      dst->left->parent = dst;
+      copy_augments(dst->left, src->left);
+      src = src->left;
+      dst = dst->left;
+    }
+    // ...then the right one...
+    else if (src->right != nullptr && dst->right == nullptr) {
+      dst->right = create_node(src->right->data);
+      dst->right->parent = dst;
+      copy_augments(dst->right, src->right);
+      src = src->right;
+      dst = dst->right;
+    }
+    // ...and go back up, once both are done
+    else {
+      src = src->parent;
+      dst = dst->parent;
+    }
   }
+}
 
-  // Opposite is true for the left side
-  else {
-    nd->left = insert(nd->left, dt);
-    nd->left->parent = nd;
+template <class T, class Alloc, class Balance, bool Ranked>
+bst<T, Alloc, Balance, Ranked>::bst(const bst& tree)
+  : alloc{node_traits::select_on_container_copy_construction(tree.alloc)}, root{nullptr} {
+  copy_from(tree);
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+bst<T, Alloc, Balance, Ranked>::bst(bst&& tree) noexcept
+  : alloc{std::move(tree.alloc)}, root{tree.root} {
+  tree.root = nullptr;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+bst<T, Alloc, Balance, Ranked>& bst<T, Alloc, Balance, Ranked>::operator=(const bst& tree) {
+  if (this != &tree) {
+    clear();
+    copy_from(tree);
   }
+  return *this;
+}
 
-  // This point will only be reached when nd == nullptr,
-  // In which case, the newly creted node is returned
-  return nd;
+template <class T, class Alloc, class Balance, bool Ranked>
+bst<T, Alloc, Balance, Ranked>& bst<T, Alloc, Balance, Ranked>::operator=(bst&& tree) noexcept {
+  if (this != &tree) {
+    // Our nodes have to be freed with our own allocator, before it gets replaced
+    clear();
+    alloc = std::move(tree.alloc);
+    root = tree.root;
+    tree.root = nullptr;
+  }
+  return *this;
 }
 
-template <class T>
-bst_node<T>* bst<T>::insert(T dt) {
-  // Traverses the whole list until a suitable position is found
-  // And updates the root to hold the updated tree
-  bst_node<T>* inserted_node = insert(root, dt);
-  root = inserted_node;
-  return inserted_node;
-} 
+template <class T, class Alloc, class Balance, bool Ranked>
+bst<T, Alloc, Balance, Ranked>::~bst() {
+  clear();
+}
 
-template <class T>
-bst_node<T>* bst<T>::find(bst_node<T>* nd, T dt) {
-  // Found it :)
-  if (nd->data == dt)
-    return nd;
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::clear() {
+  node_type* curr_node = root;
 
-  // If we've reached a dead end, return null
-  else if (nd == nullptr)
-    return nullptr;
+  // Free the tree bottom-up, without recursion
+  while (curr_node != nullptr) {
+    // Go down as far as possible
+    if (curr_node->left != nullptr)
+      curr_node = curr_node->left;
+    else if (curr_node->right != nullptr)
+      curr_node = curr_node->right;
 
-  // If we can go left, then do so 
-  else if (dt > nd->data)
-    return find(nd->right, dt);
-  
-  // Go right I guess...
+    // A leaf can be freed, after unhooking it from it's parent
+    else {
+      node_type* parent_node = curr_node->parent;
+      if (parent_node != nullptr) {
+        if (parent_node->left == curr_node)
+          parent_node->left = nullptr;
+        else
+          parent_node->right = nullptr;
+      }
+      destroy_node(curr_node);
+      curr_node = parent_node;
+    }
+  }
+
+  root = nullptr;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::link_node(node_type* nd, node_type* inserted_node) {
+  // Traverse down until a suitable position is found
+  node_type* parent_node = (nd == nullptr) ? nullptr : nd->parent;
+  node_type* curr_node = (nd == nullptr) ? root : nd;
+  while (curr_node != nullptr) {
+    parent_node = curr_node;
+    curr_node = (curr_node->data < inserted_node->data) ? curr_node->right : curr_node->left;
+  }
+
+  // Hook the node onto it's new parent (or make it the root of an empty tree)
+  inserted_node->parent = parent_node;
+  if (parent_node == nullptr)
+    root = inserted_node;
+  else if (parent_node->data < inserted_node->data)
+    parent_node->right = inserted_node;
   else
-    return find(nd->left, dt);
+    parent_node->left = inserted_node;
+
+  // Sizes have to be right before the rotations start carrying them around
+  update_sizes(parent_node, 1);
+  Balance::rebalance(root, parent_node);
+  return inserted_node;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::update_sizes(node_type* nd, int delta) {
+  if constexpr (Ranked) {
+    // Every ancestor gained (or lost) exactly one node
+    for (; nd != nullptr; nd = nd->parent)
+      nd->size += delta;
+  }
+  else {
+    (void)nd;
+    (void)delta;
+  }
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::copy_augments(node_type* dst, const node_type* src) {
+  if constexpr (node_type::balanced)
+    dst->height = src->height;
+  if constexpr (node_type::ranked)
+    dst->size = src->size;
+  (void)dst;
+  (void)src;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::insert(node_type* nd, const T& dt) {
+  return link_node(nd, create_node(dt));
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::insert(const T& dt) {
+  return emplace(dt);
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::insert(T&& dt) {
+  return emplace(std::move(dt));
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+template <class... Args>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::emplace(Args&&... args) {
+  // Build the data value inside of the node first, so it never has to be copied
+  return link_node(root, create_node(std::forward<Args>(args)...));
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::find(node_type* nd, const T& dt) {
+  // Walk down until we either find it, or hit a dead end (nullptr)
+  while (nd != nullptr) {
+    // Found it :)
+    if (nd->data == dt)
+      return nd;
+
+    // Go right if the value is larger, left otherwise
+    nd = (nd->data < dt) ? nd->right : nd->left;
+  }
+
+  return nullptr;
 }
 
-template <class T>
-bst_node<T>* bst<T>::find(T dt) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::find(const T& dt) {
   // Search from the root
   return find(root, dt);
 }
 
-template <class T>
-bst_node<T>* bst<T>::min(bst_node<T>* nd) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::const_iterator bst<T, Alloc, Balance, Ranked>::lower_bound(const T& dt) const {
+  node_type* nd = root;
+  node_type* found = nullptr;
+
+  // Every node that isn't smaller is a candidate, the smaller ones can only be further left
+  while (nd != nullptr) {
+    if (nd->data < dt)
+      nd = nd->right;
+    else {
+      found = nd;
+      nd = nd->left;
+    }
+  }
+
+  return const_iterator(found, this);
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::const_iterator bst<T, Alloc, Balance, Ranked>::upper_bound(const T& dt) const {
+  node_type* nd = root;
+  node_type* found = nullptr;
+
+  // Same as lower_bound(), but equal values are skipped too
+  while (nd != nullptr) {
+    if (dt < nd->data) {
+      found = nd;
+      nd = nd->left;
+    }
+    else
+      nd = nd->right;
+  }
+
+  return const_iterator(found, this);
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+std::pair<typename bst<T, Alloc, Balance, Ranked>::const_iterator, typename bst<T, Alloc, Balance, Ranked>::const_iterator>
+bst<T, Alloc, Balance, Ranked>::equal_range(const T& dt) const {
+  return {lower_bound(dt), upper_bound(dt)};
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+template <class Visitor>
+void bst<T, Alloc, Balance, Ranked>::for_each_in_range(const T& lo, const T& hi, Visitor visit) const {
+  // One descent to find where to start, then only successor steps
+  node_type* nd = lower_bound(lo).get_node();
+
+  while (nd != nullptr && nd->data < hi) {
+    visit(static_cast<const T&>(nd->data));
+    nd = successor(nd);
+  }
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::select(std::size_t k) const {
+  static_assert(Ranked, "select() needs a ranked bst, which keeps sub-tree sizes");
+  node_type* nd = root;
+
+  while (nd != nullptr) {
+    const std::size_t left_size = (nd->left == nullptr) ? 0 : nd->left->size;
+
+    // The k-th value is somewhere on the left
+    if (k < left_size)
+      nd = nd->left;
+    // Exactly k values come before this one
+    else if (k == left_size)
+      return nd;
+    // Skip the whole left side and this node
+    else {
+      k -= left_size + 1;
+      nd = nd->right;
+    }
+  }
+
+  return nullptr;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+std::size_t bst<T, Alloc, Balance, Ranked>::rank(const T& dt) const {
+  static_assert(Ranked, "rank() needs a ranked bst, which keeps sub-tree sizes");
+  node_type* nd = root;
+  std::size_t smaller = 0;
+
+  // Same descent as lower_bound(), counting everything we pass on the left
+  while (nd != nullptr) {
+    if (nd->data < dt) {
+      smaller += 1 + ((nd->left == nullptr) ? 0 : nd->left->size);
+      nd = nd->right;
+    }
+    else
+      nd = nd->left;
+  }
+
+  return smaller;
+}
+
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::min(node_type* nd) {
   // If the procided node was null
   if (nd == nullptr)
     return nullptr;
 
-  // If we've hit a leaf node - return it
-  if (nd->left == nullptr)
-    return nd;
+  // Keep going left, until there is nowhere left to go
+  while (nd->left != nullptr)
+    nd = nd->left;
 
-  // Otherwise keep searching
-  return min(nd->left);
+  return nd;
 }
 
-template <class T>
-bst_node<T>* bst<T>::min() {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::min() {
   // Search from the top
   return min(root);
 }
 
-template <class T>
-bst_node<T>* bst<T>::max(bst_node<T>* nd) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::max(node_type* nd) {
   // If the procided node was null
   if (nd == nullptr)
     return nullptr;
 
-  // If we've hit a leaf node - return it
-  if (nd->right == nullptr)
-    return nd;
+  // Keep going right, until there is nowhere left to go
+  while (nd->right != nullptr)
+    nd = nd->right;
 
-  // Otherwise keep searching
-  return max(nd->right);
+  return nd;
 }
 
-template <class T>
-bst_node<T>* bst<T>::max() {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::max() {
   // Search from the top
   return max(root);
 }
 
-template <class T>
-bst_node<T>* bst<T>::successor(bst_node<T>* nd) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::successor(node_type* nd) {
+  // Nothing comes after nothing
+  if (nd == nullptr)
+    return nullptr;
+
   // If the node has a right sub-tree - find the smallest value within that sub-tree
   if (nd->right != nullptr)
     return min(nd->right);
 
   else {
-    bst_node<T>* parent_node = nd->parent;
-    bst_node<T>* curr_node = nd;
+    node_type* parent_node = nd->parent;
+    node_type* curr_node = nd;
 
     // While we can still traverse ancestors
     // And while traversing, we're going UP in data value
@@ -337,25 +1091,29 @@ bst_node<T>* bst<T>::successor(bst_node<T>* nd) {
   }
 }
 
-template <class T>
-bst_node<T>* bst<T>::successor(T dt) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::successor(const T& dt) {
   // Get the node which we're trying to find the successor of
-  bst_node<T>* who_to_find = find(root, dt);
+  node_type* who_to_find = find(root, dt);
 
   // Should be pretty clear...
   // ...otherwise, what are you doing here?
   return successor(who_to_find);
 }
 
-template <class T>
-bst_node<T>* bst<T>::predecessor(bst_node<T>* nd) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::predecessor(node_type* nd) {
+  // Nothing comes before nothing
+  if (nd == nullptr)
+    return nullptr;
+
   // If the node has a left sub-tree - find the largest value within that sub-tree
   if (nd->left != nullptr)
     return max(nd->left);
 
   else {
-    bst_node<T>* parent_node = nd->parent;
-    bst_node<T>* curr_node = nd;
+    node_type* parent_node = nd->parent;
+    node_type* curr_node = nd;
 
     // While we can still traverse ancestors
     // And while traversing, we're going DOWN in data value
@@ -373,72 +1131,100 @@ bst_node<T>* bst<T>::predecessor(bst_node<T>* nd) {
   }
 }
 
-template <class T>
-bst_node<T>* bst<T>::predecessor(T dt) {
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::predecessor(const T& dt) {
   // Node which to find
-  bst_node<T>* who_to_find = find(root, dt);
+  node_type* who_to_find = find(root, dt);
 
   // Welp, good luck figuring this out
   return predecessor(who_to_find);
 }
 
-template <class T>
-bst_node<T>* bst<T>::remove(bst_node<T>* nd, T dt) {
-  // If the node doesn't exist
-  if (nd == nullptr)
-    return nullptr;
+template <class T, class Alloc, class Balance, bool Ranked>
+void bst<T, Alloc, Balance, Ranked>::transplant(node_type* old_node, node_type* new_node) {
+  // Hook the new node onto the old node's parent
+  if (old_node->parent == nullptr)
+    root = new_node;
+  else if (old_node->parent->left == old_node)
+    old_node->parent->left = new_node;
+  else
+    old_node->parent->right = new_node;
 
-  // If the desired node has been reached 
-  if (nd->data == dt) {
-    // If the node is a leaf node
-    if (nd->left == nullptr && nd->right == nullptr)
-      nd = nullptr;
+  if (new_node != nullptr)
+    new_node->parent = old_node->parent;
+}
 
-    // If the node only has a right child
-    else if (nd->left == nullptr && nd->right != nullptr) {
-      // Move the child one level up
-      nd->right->parent = nd->parent;
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::erase_node(node_type* nd) {
+  // Remember what comes after the node, before the tree gets shuffled around
+  node_type* next_node = successor(nd);
+  // Lowest node whose sub-tree got shorter
+  node_type* changed_node = nd->parent;
 
-      // Move over
-      nd = nd->right;
-    }
+  // If the node has at most one child, that child simply moves one level up
+  if (nd->left == nullptr)
+    transplant(nd, nd->right);
+  else if (nd->right == nullptr)
+    transplant(nd, nd->left);
 
-    // If the node only has a left child
-    else if (nd->left != nullptr && nd->right == nullptr) {
-      // Move the child one level up
-      nd->left->parent = nd->parent;
-      
-      // Move over
-      nd = nd->left;
+  // Otherwise the successor (the smallest node on the right) takes the node's place
+  else {
+    node_type* succ = next_node;
+    if (succ->parent != nd) {
+      // Pull the successor out, it never has a left child
+      changed_node = succ->parent;
+      transplant(succ, succ->right);
+      succ->right = nd->right;
+      succ->right->parent = succ;
     }
+    else
+      changed_node = succ;
 
-    else {
-      // Get the desired node's successor
-      bst_node<T>* curr_succ = successor(dt);
-      // Set the current node's data to the desired node's successor data
-      nd->data = curr_succ->data;
-      // Keep looking down right
-      nd->right = remove(nd->right, curr_succ->data);
-    }
+    transplant(nd, succ);
+    succ->left = nd->left;
+    succ->left->parent = succ;
+    copy_augments(succ, nd);
   }
 
-  // If the desired node is on the right side, look there ig...
-  else if (nd->data < dt)
-    nd->right = remove(nd->right, dt);
+  // Give the node back to the allocator, and fix the balance of the tree
+  destroy_node(nd);
+  update_sizes(changed_node, -1);
+  Balance::rebalance(root, changed_node);
+  return next_node;
+}
 
-  // If all else fails, go left, since it's the only one left
-  else
-    nd->left = remove(nd->left, dt);
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::remove(node_type* nd, const T& dt) {
+  // Look for the node which contains the data value
+  while (nd != nullptr && !(nd->data == dt))
+    nd = (nd->data < dt) ? nd->right : nd->left;
 
-  // Return the deleted node
-  return nd;
+  // If the node doesn't exist
+  if (nd == nullptr)
+    return nullptr;
+
+  return erase_node(nd);
 }
 
-template <class T>
-bst_node<T>* bst<T>::remove(T dt) {
-  bst_node<T>* deleted_node = remove(root, dt);
-  root = deleted_node;
-  return deleted_node;
+template <class T, class Alloc, class Balance, bool Ranked>
+typename bst<T, Alloc, Balance, Ranked>::node_type* bst<T, Alloc, Balance, Ranked>::remove(const T& dt) {
+  return remove(root, dt);
 }
 
+/**
+ * @brief A bst which stays AVL balanced, see bst_avl.
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes
+ */
+template <class T, class Alloc = std::allocator<T>>
+using avl_tree = bst<T, Alloc, bst_avl>;
+
+/**
+ * @brief An AVL balanced bst, which also keeps sub-tree sizes for select() and rank() (an order statistic tree).
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes
+ */
+template <class T, class Alloc = std::allocator<T>>
+using ranked_avl_tree = bst<T, Alloc, bst_avl, true>;
+
 #endif // BST_HPP
\ No newline at end of file
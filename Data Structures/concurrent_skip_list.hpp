@@ -0,0 +1,503 @@
+/**
+ * @file concurrent_skip_list.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a lock-free ordered set, built on a skip list, which can be shared between threads
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef CONCURRENT_SKIP_LIST_H
+#define CONCURRENT_SKIP_LIST_H
+
+#include "epoch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+/*!
+ * @class concurrent_skip_node
+ * @brief Concurrent Skip List Node class.
+ *
+ * @details Like skip_node, the tower of links sits right behind the node, in the same allocation. The links are atomic, and the lowest bit of a link marks the node as removed on that level,
+ * which freezes the link, so nobody can insert right after a node that's being removed.
+ * The node also counts the levels it's linked on (plus one, while it's inserter is still linking it), and it's only retired once that count drops to zero.
+ *
+ * @fn get_data()
+ * @fn get_height()
+ * @fn links()
+ * @tparam T typename
+ */
+template <class T>
+class alignas(T) alignas(std::atomic<std::uintptr_t>) concurrent_skip_node {
+public:
+    using link_type = std::atomic<std::uintptr_t>;
+
+    /**
+     * Creates a node with a tower of the provided height, and constructs it's data in place. The links have to be constructed by whoever allocated the node.
+     * @brief Emplacing constructor.
+     */
+    template <class... Args>
+    explicit concurrent_skip_node(std::size_t h, std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), refs{1}, height{static_cast<std::uint8_t>(h)} { }
+
+    concurrent_skip_node(const concurrent_skip_node&) = delete;
+    concurrent_skip_node& operator=(const concurrent_skip_node&) = delete;
+
+    /**
+     * @brief Returns the data, which never changes once the node is shared.
+     */
+    const T& get_data() const {return data;}
+
+    std::size_t get_height() const {return height;}
+
+    /**
+     * @brief Returns the amount of levels the node is linked on, plus one while it's still being inserted.
+     */
+    std::atomic<std::uint32_t>& references() {return refs;}
+
+    /**
+     * @brief Returns the tower of links, which sits right behind the node.
+     */
+    link_type* links() const {
+        return std::launder(reinterpret_cast<link_type*>(const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(this)) + sizeof(concurrent_skip_node)));
+    }
+
+private:
+    T data;                             /**< Data that this node contains*/
+    std::atomic<std::uint32_t> refs;    /**< Levels the node is linked on, plus one for it's inserter*/
+    std::uint8_t height;                /**< Amount of links in the tower*/
+};
+
+/*!
+ * @class concurrent_skip_list
+ * @brief Lock-free ordered set class, built on a skip list [Harris/Fraser style].
+ *
+ * @details Stores unique values in sorted order, like skip_list, but any amount of threads can insert, remove and look up values at the same time, without a mutex.
+ * A node is inserted by linking it on the lowest level with compare-and-swap (which is the moment it becomes part of the set), and then on every level above.
+ * It's removed by marking it's links from the top down, the thread whose mark lands on the lowest level is the one that removed it. Marked nodes are unlinked by every thread that walks past them during insert and remove.
+ * Lookups (contains, find, successor, min) never write anything, they just step over marked nodes, so they're wait-free: no other thread can make them retry.
+ * Unlinked nodes are retired into an epoch_domain (epoch.hpp), so a thread that is still looking at a node never reads freed memory.
+ *
+ * @note Values are handed out as copies, never as references or nodes, since another thread may remove them right after.
+ * @note size() and empty() are only snapshots, other threads may change the set right after they return.
+ *
+ * @fn insert(const T& dt)
+ * @fn emplace(Args&&... args)
+ * @fn contains(const T& dt)
+ * @fn find(const T& dt, T& out)
+ * @fn remove(const T& dt)
+ * @fn successor(const T& dt, T& out)
+ * @fn min(T& out)
+ * @tparam T typename
+ * @tparam Compare Strict weak ordering of the values
+ * @tparam Alloc Allocator used for the nodes, rebound to concurrent_skip_node<T>
+ */
+template <class T, class Compare = std::less<T>, class Alloc = std::allocator<T>>
+class concurrent_skip_list {
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using allocator_type = Alloc;
+    using node_type = concurrent_skip_node<T>;
+
+    /**< Highest tower a node can get*/
+    static constexpr std::size_t max_height = 32;
+
+private:
+    using link_type = typename node_type::link_type;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc;                           /**< Allocator which creates and frees every node [declared before the domain, which still uses it while being destroyed]*/
+    mutable epoch_domain reclaimer;                 /**< Holds unlinked nodes until no thread can be reading them [lookups pin it too]*/
+    Compare comp;                                   /**< Orders the values*/
+    alignas(64) link_type head[max_height];         /**< Tower of the head, never marked*/
+    std::atomic<std::size_t> levels;                /**< Amount of levels in use [only ever grows]*/
+    alignas(64) std::atomic<std::size_t> len;       /**< Amount of values, on it's own cache line since every change writes it*/
+
+    static node_type* pointer_of(std::uintptr_t link) {return reinterpret_cast<node_type*>(link & ~std::uintptr_t{1});}
+    static bool is_marked(std::uintptr_t link) {return (link & 1) != 0;}
+    static std::uintptr_t link_to(node_type* nd) {return reinterpret_cast<std::uintptr_t>(nd);}
+
+    /**
+     * @brief Returns the links of a node [the head tower for nullptr].
+     */
+    link_type* links_of(node_type* nd) const {return nd == nullptr ? const_cast<link_type*>(head) : nd->links();}
+
+    /**
+     * @brief Picks the height of a new node, every level 4 times rarer than the one under it. Every thread has it's own generator, so this doesn't need to be synchronized.
+     */
+    static std::size_t random_height();
+
+    template <class... Args>
+    node_type* create_node(std::size_t height, Args&&... args);
+
+    /**
+     * @brief Destroys and deallocates a node. Matches the deleter signature of epoch_domain.
+     * @param nd Node to be freed.
+     * @param self The list which owns the node.
+     */
+    static void destroy_node(void* nd, void* self);
+
+    /**
+     * @brief Drops one reference of a node, and retires it if that was the last one.
+     */
+    void release(node_type* nd, epoch_domain::guard& guard);
+
+    /**
+     * @brief One attempt of find_window().
+     * @return false if another thread got in the way, and the search has to start over.
+     */
+    bool try_find_window(const T& dt, node_type** preds, node_type** succs, epoch_domain::guard& guard);
+
+    /**
+     * @brief Finds, on every level in use, the last node before dt (preds) and the first one that isn't (succs), unlinking every marked node on the way.
+     * @return true if succs[0] holds dt.
+     */
+    bool find_window(const T& dt, node_type** preds, node_type** succs, epoch_domain::guard& guard) {
+        while (!try_find_window(dt, preds, succs, guard)) { }
+        return succs[0] != nullptr && !comp(dt, succs[0]->get_data());
+    }
+
+    /**
+     * @brief Returns the first node which isn't marked, and doesn't come before dt [or comes after it, if strict]. Never writes, so it's wait-free.
+     * @note The caller has to be pinned.
+     */
+    node_type* first_not_before(const T& dt, bool strict) const;
+
+public:
+    /**
+     * Creates a new, empty set.
+     * @brief Default constructor.
+     */
+    explicit concurrent_skip_list(const Compare& compare = Compare(), const Alloc& allocator = Alloc())
+        : alloc{allocator}, reclaimer{}, comp{compare}, levels{1}, len{0} {
+        for (std::size_t i = 0; i < max_height; ++i)
+            head[i].store(0, std::memory_order_relaxed);
+    }
+
+    concurrent_skip_list(const concurrent_skip_list&) = delete;
+    concurrent_skip_list& operator=(const concurrent_skip_list&) = delete;
+
+    /**
+     * @brief Frees every node.
+     * @note No other thread may use the set anymore.
+     */
+    ~concurrent_skip_list();
+
+    /**
+     * @brief Inserts a copy of the value, unless an equal one is already in the set.
+     * @return true if the value was inserted.
+     */
+    bool insert(const T& dt) {return emplace(dt);}
+
+    /**
+     * @brief Moves the value into the set, unless an equal one is already in it.
+     * @return true if the value was inserted.
+     */
+    bool insert(T&& dt) {return emplace(std::move(dt));}
+
+    /**
+     * @brief Constructs a value in place, and inserts it unless an equal one is already in the set.
+     * @param args Arguments forwarded to T's constructor.
+     * @return true if the value was inserted.
+     */
+    template <class... Args>
+    bool emplace(Args&&... args);
+
+    /**
+     * @brief Returns true if an equal value is in the set. Wait-free.
+     */
+    bool contains(const T& dt) const;
+
+    /**
+     * @brief Copies the value equal to dt, if there is one [useful when Compare only looks at part of T, like the key of a pair]. Wait-free.
+     * @return true if a value was found.
+     */
+    bool find(const T& dt, T& out) const;
+
+    /**
+     * @brief Removes the value equal to dt.
+     * @return true if this call removed it, false if it wasn't in the set [or another thread removed it first].
+     */
+    bool remove(const T& dt);
+
+    /**
+     * @brief Copies the smallest value that comes after dt [dt doesn't have to be in the set]. Wait-free.
+     * @return true if there is one.
+     */
+    bool successor(const T& dt, T& out) const;
+
+    /**
+     * @brief Copies the smallest value. Wait-free.
+     * @return true if the set wasn't empty.
+     */
+    bool min(T& out) const;
+
+    std::size_t size() const {return len.load(std::memory_order_relaxed);}
+    bool empty() const {return size() == 0;}
+
+    allocator_type get_allocator() const {return allocator_type(alloc);}
+};
+
+template <class T, class Compare, class Alloc>
+std::size_t concurrent_skip_list<T, Compare, Alloc>::random_height() {
+    // xorshift64*, like skip_list, with a different stream for every thread
+    static std::atomic<std::uint64_t> streams{0};
+    thread_local std::uint64_t seed = (streams.fetch_add(1, std::memory_order_relaxed) + 1) * 0x9E3779B97F4A7C15ull;
+
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    std::uint64_t bits = seed * 0x2545F4914F6CDD1Dull;
+
+    std::size_t height = 1;
+    while (height < max_height && (bits & 3) == 0) {
+        ++height;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template <class T, class Compare, class Alloc>
+template <class... Args>
+typename concurrent_skip_list<T, Compare, Alloc>::node_type* concurrent_skip_list<T, Compare, Alloc>::create_node(std::size_t height, Args&&... args) {
+    // The node and it's tower come out of one allocation, counted in whole nodes
+    const std::size_t units = 1 + (height * sizeof(link_type) + sizeof(node_type) - 1) / sizeof(node_type);
+    node_type* nd = node_traits::allocate(alloc, units);
+    try {
+        node_traits::construct(alloc, nd, height, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, units);
+        throw;
+    }
+
+    link_type* tower = reinterpret_cast<link_type*>(reinterpret_cast<unsigned char*>(nd) + sizeof(node_type));
+    for (std::size_t i = 0; i < height; ++i)
+        ::new (static_cast<void*>(tower + i)) link_type{0};
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+void concurrent_skip_list<T, Compare, Alloc>::destroy_node(void* nd, void* self) {
+    concurrent_skip_list* owner = static_cast<concurrent_skip_list*>(self);
+    node_type* freed = static_cast<node_type*>(nd);
+    const std::size_t units = 1 + (freed->get_height() * sizeof(link_type) + sizeof(node_type) - 1) / sizeof(node_type);
+    node_traits::destroy(owner->alloc, freed);
+    node_traits::deallocate(owner->alloc, freed, units);
+}
+
+template <class T, class Compare, class Alloc>
+void concurrent_skip_list<T, Compare, Alloc>::release(node_type* nd, epoch_domain::guard& guard) {
+    if (nd->references().fetch_sub(1, std::memory_order_acq_rel) == 1)
+        guard.retire(nd, &destroy_node, this);
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::try_find_window(const T& dt, node_type** preds, node_type** succs, epoch_domain::guard& guard) {
+    // Everything that writes uses sequentially consistent operations [free for loads on x86]. An inserter that links a node after it's remover walked past relies on that to see the mark, see emplace().
+    node_type* pred = nullptr;
+    for (std::size_t level = levels.load(); level-- > 0;) {
+        node_type* curr = pointer_of(links_of(pred)[level].load());
+
+        while (curr != nullptr) {
+            std::uintptr_t next = curr->links()[level].load();
+
+            // curr is being removed, so unlink it on this level. If pred changed (or got marked itself) in the meantime, start over.
+            if (is_marked(next)) {
+                std::uintptr_t expected = link_to(curr);
+                if (!links_of(pred)[level].compare_exchange_strong(expected, next & ~std::uintptr_t{1}))
+                    return false;
+                release(curr, guard);
+                curr = pointer_of(next);
+                continue;
+            }
+
+            if (!comp(curr->get_data(), dt))
+                break;
+            pred = curr;
+            curr = pointer_of(next);
+        }
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return true;
+}
+
+template <class T, class Compare, class Alloc>
+typename concurrent_skip_list<T, Compare, Alloc>::node_type* concurrent_skip_list<T, Compare, Alloc>::first_not_before(const T& dt, bool strict) const {
+    // Like try_find_window(), but marked nodes are stepped over instead of unlinked. Their links are frozen, so they still lead forward.
+    node_type* pred = nullptr;
+    node_type* curr = nullptr;
+    for (std::size_t level = levels.load(std::memory_order_acquire); level-- > 0;) {
+        curr = pointer_of(links_of(pred)[level].load(std::memory_order_acquire));
+
+        while (curr != nullptr) {
+            const std::uintptr_t next = curr->links()[level].load(std::memory_order_acquire);
+            if (is_marked(next)) {
+                curr = pointer_of(next);
+                continue;
+            }
+
+            if (strict ? comp(dt, curr->get_data()) : !comp(curr->get_data(), dt))
+                break;
+            pred = curr;
+            curr = pointer_of(next);
+        }
+    }
+    return curr;
+}
+
+template <class T, class Compare, class Alloc>
+template <class... Args>
+bool concurrent_skip_list<T, Compare, Alloc>::emplace(Args&&... args) {
+    epoch_domain::guard guard = reclaimer.pin();
+
+    // The value is needed to search, so the node is built first, and freed again if the value turns out to be taken
+    const std::size_t height = random_height();
+    node_type* nd = create_node(height, std::forward<Args>(args)...);
+    const T& dt = nd->get_data();
+
+    std::size_t used = levels.load(std::memory_order_relaxed);
+    while (used < height && !levels.compare_exchange_weak(used, height)) { }
+
+    node_type* preds[max_height];
+    node_type* succs[max_height];
+    link_type* tower = nd->links();
+
+    // The lowest level decides whether the value is in the set
+    for (;;) {
+        if (find_window(dt, preds, succs, guard)) {
+            destroy_node(nd, this);
+            return false;
+        }
+
+        // Nobody can see the node yet
+        for (std::size_t level = 0; level < height; ++level)
+            tower[level].store(link_to(succs[level]), std::memory_order_relaxed);
+        nd->references().store(2, std::memory_order_relaxed);
+
+        std::uintptr_t expected = link_to(succs[0]);
+        if (links_of(preds[0])[0].compare_exchange_strong(expected, link_to(nd)))
+            break;
+    }
+    len.fetch_add(1, std::memory_order_relaxed);
+
+    // The upper levels only make searches faster. If the node gets removed meanwhile, it's links are marked and the rest of them are skipped.
+    bool removed = false;
+    for (std::size_t level = 1; level < height && !removed; ++level) {
+        for (;;) {
+            // Point our link at the latest successor, unless it has been marked
+            std::uintptr_t mine = tower[level].load();
+            if (is_marked(mine) || !tower[level].compare_exchange_strong(mine, link_to(succs[level]))) {
+                removed = true;
+                break;
+            }
+
+            // The reference is taken before linking, so a thread that unlinks us straight away can't drop the count to zero
+            nd->references().fetch_add(1, std::memory_order_relaxed);
+            std::uintptr_t expected = link_to(succs[level]);
+            if (links_of(preds[level])[level].compare_exchange_strong(expected, link_to(nd)))
+                break;
+            nd->references().fetch_sub(1, std::memory_order_relaxed);
+
+            find_window(dt, preds, succs, guard);
+        }
+    }
+
+    // If the node was removed while we linked it, it's remover may have already walked past the levels we linked since, so unlink them ourselves
+    if (is_marked(tower[0].load()))
+        find_window(dt, preds, succs, guard);
+    release(nd, guard);
+    return true;
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::remove(const T& dt) {
+    epoch_domain::guard guard = reclaimer.pin();
+
+    node_type* preds[max_height];
+    node_type* succs[max_height];
+    if (!find_window(dt, preds, succs, guard))
+        return false;
+
+    // Mark from the top down, the lowest level goes last, and whoever marks it removed the value
+    node_type* victim = succs[0];
+    link_type* tower = victim->links();
+    for (std::size_t level = victim->get_height(); level-- > 1;)
+        tower[level].fetch_or(1);
+    if (is_marked(tower[0].fetch_or(1)))
+        return false;
+    len.fetch_sub(1, std::memory_order_relaxed);
+
+    // Searching for the value again unlinks it on every level
+    find_window(dt, preds, succs, guard);
+    return true;
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::contains(const T& dt) const {
+    epoch_domain::guard guard = reclaimer.pin();
+    const node_type* nd = first_not_before(dt, false);
+    return nd != nullptr && !comp(dt, nd->get_data());
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::find(const T& dt, T& out) const {
+    epoch_domain::guard guard = reclaimer.pin();
+    const node_type* nd = first_not_before(dt, false);
+    if (nd == nullptr || comp(dt, nd->get_data()))
+        return false;
+    out = nd->get_data();
+    return true;
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::successor(const T& dt, T& out) const {
+    epoch_domain::guard guard = reclaimer.pin();
+    const node_type* nd = first_not_before(dt, true);
+    if (nd == nullptr)
+        return false;
+    out = nd->get_data();
+    return true;
+}
+
+template <class T, class Compare, class Alloc>
+bool concurrent_skip_list<T, Compare, Alloc>::min(T& out) const {
+    epoch_domain::guard guard = reclaimer.pin();
+
+    // The first node which isn't marked
+    node_type* nd = pointer_of(head[0].load(std::memory_order_acquire));
+    while (nd != nullptr) {
+        const std::uintptr_t next = nd->links()[0].load(std::memory_order_acquire);
+        if (!is_marked(next)) {
+            out = nd->get_data();
+            return true;
+        }
+        nd = pointer_of(next);
+    }
+    return false;
+}
+
+template <class T, class Compare, class Alloc>
+concurrent_skip_list<T, Compare, Alloc>::~concurrent_skip_list() {
+    // Nobody else is around anymore, so a node is freed directly once every level it's linked on has been walked. Retired ones are freed by the domain.
+    for (std::size_t level = levels.load(std::memory_order_relaxed); level-- > 0;) {
+        node_type* nd = pointer_of(head[level].load(std::memory_order_relaxed));
+        while (nd != nullptr) {
+            node_type* next = pointer_of(nd->links()[level].load(std::memory_order_relaxed));
+            if (nd->references().fetch_sub(1, std::memory_order_relaxed) == 1)
+                destroy_node(nd, this);
+            nd = next;
+        }
+    }
+}
+
+#endif // CONCURRENT_SKIP_LIST_H
@@ -0,0 +1,178 @@
+/**
+ * @file concurrent_stack.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a lock-free stack class, which can be shared between threads
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include "node.hpp"
+#include "epoch.hpp"
+#include <atomic>
+#include <memory>
+#include <utility>
+
+/*!
+ * @class concurrent_stack
+ * @brief Lock-free stack class [Treiber stack].
+ *
+ * @details A LIFO stack that any amount of threads can push to and pop from at the same time, without a mutex. The top of the stack is a single atomic pointer,
+ * which is swung with compare-and-swap. The items are linked through node<T>'s next pointer, which is set before a node is published and never changes after that.
+ * Popped nodes are retired into an epoch_domain (epoch.hpp) instead of being freed, so a thread that is still looking at a node never reads freed memory,
+ * and a node's address can't be reused while someone still holds it (which rules out the ABA problem).
+ *
+ * @note empty() is only a snapshot, other threads may change the stack right after it returns.
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn emplace(Args&&... args)
+ * @fn try_pop(T& out)
+ * @fn empty()
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes, rebound to node<T>
+ */
+template <class T, class Alloc = std::allocator<T>>
+class concurrent_stack {
+private:
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node<T>>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc;               /**< Allocator which creates and frees every node [declared before the domain, which still uses it while being destroyed]*/
+    epoch_domain reclaimer;             /**< Holds popped nodes until no thread can be reading them*/
+    alignas(64) std::atomic<node<T>*> head;   /**< Top of the stack, on it's own cache line*/
+
+    /**
+     * @brief Allocates a node using the stack's allocator, and constructs it's data in place.
+     */
+    template <class... Args>
+    node<T>* create_node(Args&&... args);
+
+    /**
+     * @brief Destroys and deallocates a node. Matches the deleter signature of epoch_domain.
+     * @param nd Node to be freed.
+     * @param self The stack which owns the node.
+     */
+    static void destroy_node(void* nd, void* self);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    /**
+     * Creates a new, empty stack.
+     * @brief Default constructor.
+     */
+    concurrent_stack()
+        : alloc{}, reclaimer{}, head{nullptr} { }
+
+    concurrent_stack(const concurrent_stack&) = delete;
+    concurrent_stack& operator=(const concurrent_stack&) = delete;
+
+    /**
+     * @brief Frees every node.
+     * @note No other thread may use the stack anymore.
+     */
+    ~concurrent_stack();
+
+    /**
+     * @brief Pushes a copy of the value onto the top of the stack.
+     * @param dt Data to push.
+     */
+    void push(const T& dt) {emplace(dt);}
+
+    /**
+     * @brief Moves the value onto the top of the stack.
+     * @param dt Data to push.
+     */
+    void push(T&& dt) {emplace(std::move(dt));}
+
+    /**
+     * @brief Constructs a value in place on the top of the stack.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Pops the value from the top of the stack, if there is one.
+     * @param out Where the popped value is moved to.
+     * @return true if a value was popped, false if the stack was empty.
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Returns true if the stack was empty at the time of the call.
+     */
+    bool empty() const {return head.load(std::memory_order_acquire) == nullptr;}
+};
+
+template <class T, class Alloc>
+template <class... Args>
+node<T>* concurrent_stack<T, Alloc>::create_node(Args&&... args) {
+    node<T>* nd = node_traits::allocate(alloc, 1);
+    try {
+        node_traits::construct(alloc, nd, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Alloc>
+void concurrent_stack<T, Alloc>::destroy_node(void* nd, void* self) {
+    concurrent_stack* owner = static_cast<concurrent_stack*>(self);
+    node<T>* freed = static_cast<node<T>*>(nd);
+    node_traits::destroy(owner->alloc, freed);
+    node_traits::deallocate(owner->alloc, freed, 1);
+}
+
+template <class T, class Alloc>
+template <class... Args>
+void concurrent_stack<T, Alloc>::emplace(Args&&... args) {
+    // The node isn't shared yet, so it can be built without any care
+    node<T>* nd = create_node(std::forward<Args>(args)...);
+    node<T>* top = head.load(std::memory_order_relaxed);
+
+    // Publish it, release makes the data and the next pointer visible to whoever pops it
+    do {
+        nd->set_next(top);
+    } while (!head.compare_exchange_weak(top, nd, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <class T, class Alloc>
+bool concurrent_stack<T, Alloc>::try_pop(T& out) {
+    // Nodes we read can't be freed while we're pinned
+    epoch_domain::guard guard = reclaimer.pin();
+    node<T>* top = head.load(std::memory_order_acquire);
+
+    while (top != nullptr) {
+        // Whoever wins the CAS owns the node, the others retry with the new top
+        if (head.compare_exchange_weak(top, top->get_next(), std::memory_order_acquire, std::memory_order_acquire)) {
+            // Other threads may still read the next pointer, but never the data
+            out = std::move(top->get_data());
+            guard.retire(top, &destroy_node, this);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class T, class Alloc>
+concurrent_stack<T, Alloc>::~concurrent_stack() {
+    // Nobody else is around anymore, so nodes can be freed directly. Retired ones are freed by the domain.
+    node<T>* nd = head.load(std::memory_order_relaxed);
+    while (nd != nullptr) {
+        node<T>* next = nd->get_next();
+        destroy_node(nd, this);
+        nd = next;
+    }
+}
+
+#endif // CONCURRENT_STACK_H
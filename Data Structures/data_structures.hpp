@@ -1,6 +1,21 @@
 // ver: 0.3
 
-#include "sl_list.hpp"      // Includes node.hpp, <cstddef>, <stdexcept>     
-#include "dl_list.hpp"      // Includes double_node.hpp, <cstddef>, <stdexcept>
+#include "sl_list.hpp"      // Includes node.hpp, <cstddef>, <memory>, <stdexcept>
+#include "dl_list.hpp"      // Includes double_node.hpp, <cstddef>, <memory>, <stdexcept>
 #include "bst.hpp"
-#include "stack.hpp"
\ No newline at end of file
+#include "stack.hpp"
+#include "node_pool.hpp"    // Slab/free-list allocator for the node based containers
+#include "bplus_tree.hpp"
+#include "concurrent_stack.hpp" // Lock-free stack, includes epoch.hpp (epoch-based reclamation) and <atomic>
+#include "queue.hpp"            // Queue on sl_list, plus the spsc_queue and mpmc_queue ring buffers
+#include "heap.hpp"             // d_ary_heap and indexed_heap (decrease_key/erase through handles)
+#include "pairing_heap.hpp"     // Mergeable node based heap, nodes come from node_pool by default
+#include "matrix.hpp"           // Dense matrix, blocked SIMD GEMM and expression templates, includes thread_pool.hpp
+#include "sparse_matrix.hpp"    // CSR/CSC sparse matrices built from a coo_builder, SpMV and sparse x dense
+#include "graph.hpp"            // Graph builder frozen into a CSR graph: BFS, DFS, Dijkstra and a direction-optimizing parallel BFS
+#include "fenwick_tree.hpp"     // Fenwick trees: point update, range update (two trees) and 2D, with lower_bound
+#include "kd_tree.hpp"          // Bulk built kd-tree in a flat implicit array: k-nearest and radius queries
+#include "generic_tree.hpp"     // n-ary tree in first-child/next-sibling form, nodes from one node_pool arena
+#include "unrolled_list.hpp"    // dl_list interface on blocks of values sized to cache lines
+#include "skip_list.hpp"        // skip_list ordered set, and indexed_skip_list with O(log n) positional insert/erase
+#include "concurrent_skip_list.hpp" // Lock-free ordered set with wait-free lookups, includes epoch.hpp
@@ -10,7 +10,11 @@
 
 #include "double_node.hpp"
 #include <cstddef>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 /*!
  * @class dl_list
@@ -18,27 +22,132 @@
  * 
  * @details A Doubly-linked list data structure class, which supports insertion, removal, and dynamic types. Due to being Doubly-linked it can only be used with double_node<T>. See double_node.h on how to use them.
  * 
+ * Ownership: the list owns every node that is linked into it, and frees them when they are popped or when the list is destroyed.
+ * The value overloads (push_front(const T& dt) and friends) allocate exactly one node. The node-pointer overloads link the node they are given and take it over,
+ * so that node has to come from an allocator which is equal to the list's allocator (with the default std::allocator, that is a plain `new double_node<T>(...)`).
+ * 
  * @fn get_head()
  * @fn set_head(double_node<T>* const nd)
+ * @fn get_tail()
  * 
  * @fn push_front(double_node<T>* const nd)
- * @fn push_front(const T dt)
+ * @fn push_front(const T& dt)
+ * @fn push_front(T&& dt)
+ * @fn emplace_front(Args&&... args)
  * @fn push_back(double_node<T>* const nd)
- * @fn push_back(const T dt)
+ * @fn push_back(const T& dt)
+ * @fn push_back(T&& dt)
+ * @fn emplace_back(Args&&... args)
  * @fn insert_node(double_node<T>* const nd)
- * @fn insert_node(const T dt)
+ * @fn insert_node(const T& dt)
+ * @fn insert_node(T&& dt)
  * 
  * @fn pop_front()
  * @fn pop_back()
  * 
+ * @fn begin()
+ * @fn end()
+ * @fn rbegin()
+ * @fn rend()
+ * 
  * @fn size()
+ * @fn clear()
+ * @fn get_allocator()
  * @tparam T class
+ * @tparam Alloc Allocator used for the nodes, rebound to double_node<T> (see node_pool.hpp for a pooled one)
  */
-template <class T>
+template <class T, class Alloc = std::allocator<T>>
 class dl_list {
 
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+
+    /*!
+     * @class basic_iterator
+     * @brief Bidirectional iterator over the values of a dl_list.
+     * 
+     * @details Walks the node chain directly, so std algorithms and range-for work on the list without copying anything. end() remembers it's list, so it can be decremented back onto the tail. Use iterator and const_iterator, rather than this class directly.
+     * @tparam IsConst true for a read-only iterator
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        basic_iterator()
+            : nd{nullptr}, list{nullptr} { }
+
+        basic_iterator(double_node<T>* const n, const dl_list* const owner)
+            : nd{n}, list{owner} { }
+
+        /**
+         * @brief Allows an iterator to be used wherever a const_iterator is expected.
+         */
+        template <bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+        basic_iterator(const basic_iterator<WasConst>& it)
+            : nd{it.get_node()}, list{it.get_list()} { }
+
+        reference operator*() const {return nd->get_data();}
+        pointer operator->() const {return &nd->get_data();}
+
+        basic_iterator& operator++() {
+            nd = nd->get_next();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        basic_iterator& operator--() {
+            // Stepping back from end() lands on the tail
+            nd = (nd == nullptr) ? list->get_tail() : nd->get_prev();
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {return a.nd == b.nd;}
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {return a.nd != b.nd;}
+
+        /**
+         * @brief Returns the node the iterator points to [nullptr for end()].
+         */
+        double_node<T>* get_node() const {return nd;}
+
+        /**
+         * @brief Returns the list the iterator belongs to.
+         */
+        const dl_list* get_list() const {return list;}
+
+    private:
+        double_node<T>* nd;     /**< Current node [nullptr past the end]*/
+        const dl_list* list;    /**< List which is being iterated, used to step back from end()*/
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
 private:
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<double_node<T>>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc;      /**< Allocator which creates and frees every node of the list*/
     double_node<T>* head;      /**< Pointer to the head (or root) node [double_node<T>*]*/         
+    double_node<T>* tail;      /**< Pointer to the last node, kept in sync by every mutator [double_node<T>*]*/
     unsigned int len;          /**< List's length [unsigned int]*/
 
 public:
@@ -48,31 +157,84 @@ public:
      * @see dl_list(const double_node<T>& nd)
      */
     dl_list() 
-        : head{nullptr}, len{0} {}
+        : dl_list{Alloc()} {}
+
+    /**
+     * Creates a new, empty dl-list, which will allocate it's nodes using the provided allocator
+     * @brief Constructor.
+     * @param allocator Allocator for the nodes
+     * @see dl_list()
+     */
+    explicit dl_list(const Alloc& allocator)
+        : alloc{allocator}, head{nullptr}, tail{nullptr}, len{0} {}
 
     /**
-     * Constructs a new sl-list from another dl_list object
+     * Constructs a new dl-list from another dl_list object, by copying every value into new nodes
      * @brief Copy constructor.
      * @see dl_list()
      */
     dl_list(const dl_list& list);
 
+    /**
+     * Constructs a new dl-list by taking over the nodes of another dl_list object, which is left empty
+     * @brief Move constructor.
+     * @see dl_list(const dl_list& list)
+     */
+    dl_list(dl_list&& list) noexcept;
+
+    /**
+     * Replaces the list's values with copies of the values of another list
+     * @brief Copy assignment.
+     */
+    dl_list& operator=(const dl_list& list);
+
+    /**
+     * Frees the list's nodes and takes over the nodes of another list, which is left empty
+     * @brief Move assignment.
+     */
+    dl_list& operator=(dl_list&& list) noexcept;
+
+    /**
+     * Frees every node of the list
+     * @brief Destructor.
+     */
+    ~dl_list();
+
     /**
      * Adds a node with the provided value to the end of the list
      * @param T node data
      * @returns The new list's tail
      * @see push_back(double_node<T>* const nd)
-     * @see push_front(T dt)
+     * @see push_front(const T& dt)
      * @see push_front(double_node<T>* const nd)
      * */     
-    double_node<T>* push_back(T dt);
+    double_node<T>* push_back(const T& dt);
+
+    /**
+     * Moves the provided value into a new node at the end of the list
+     * @param T node data
+     * @returns The new list's tail
+     * @see push_back(const T& dt)
+     * */     
+    double_node<T>* push_back(T&& dt);
+
+    /**
+     * Constructs a value in place, inside a new node at the end of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns The new list's tail
+     * @see push_back(const T& dt)
+     * @see emplace_front(Args&&... args)
+     * */     
+    template <class... Args>
+    double_node<T>* emplace_back(Args&&... args);
 
     /**
      * Adds a node with the to the end of the list
+     * @note The list takes ownership of the node and links it as is, no copies are made
      * @param nd Node to be added
      * @returns The new list's tail
-     * @see push_back(T dt)
-     * @see push_front(T dt)
+     * @see push_back(const T& dt)
+     * @see push_front(const T& dt)
      * @see push_front(double_node<T>* const nd)
      * */  
     double_node<T>* push_back(double_node<T>* const nd);
@@ -82,17 +244,36 @@ public:
      * @param T node data
      * @returns The new list's head
      * @see push_front(double_node<T>* const nd)
-     * @see push_back(T dt)
+     * @see push_back(const T& dt)
      * @see push_back(double_node<T>* const nd)
      * */  
-    double_node<T>* push_front(T dt);
+    double_node<T>* push_front(const T& dt);
+
+    /**
+     * Moves the provided value into a new node at the front of the list
+     * @param T node data
+     * @returns The new list's head
+     * @see push_front(const T& dt)
+     * */  
+    double_node<T>* push_front(T&& dt);
+
+    /**
+     * Constructs a value in place, inside a new node at the front of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns The new list's head
+     * @see push_front(const T& dt)
+     * @see emplace_back(Args&&... args)
+     * */  
+    template <class... Args>
+    double_node<T>* emplace_front(Args&&... args);
 
     /**
      * Adds a node with the to the front of the list
+     * @note The list takes ownership of the node and links it as is, no copies are made
      * @param nd Node to be added
      * @returns The new list's head
-     * @see push_front(T dt)
-     * @see push_back(T dt)
+     * @see push_front(const T& dt)
+     * @see push_back(const T& dt)
      * @see push_back(double_node<T>* const nd)
      * */  
     double_node<T>* push_front(double_node<T>* const nd);
@@ -114,16 +295,23 @@ public:
     /**
      * Returns the head of the dl_list
      * @returns Head node
-     * @see set_head(T dt)
+     * @see set_head(const T& dt)
      * @see set_head(double_node<T>* const nd)
      * */  
     double_node<T>* get_head() const; 
 
     /**
-     * Sets the provided node to be the list's head
-     * @note This may ruin the list, be careful. If you want to swap values, look at void dl_list<T>::set_head(T dt)
+     * Returns the tail (last node) of the dl_list
+     * @returns Tail node [nullptr if the list is empty]
+     * @see get_head()
+     * */  
+    double_node<T>* get_tail() const;
+
+    /**
+     * Frees the current head, and links the provided node as the list's head
+     * @note The list takes ownership of the node. If you want to swap values, look at void dl_list<T>::set_head(const T& dt)
      * @param nd Node to be the new head
-     * @see set_head(T dt)
+     * @see set_head(const T& dt)
      * @see get_head()
     */
     void set_head(double_node<T>* const nd);
@@ -134,10 +322,11 @@ public:
      * @see set_head(double_node<T>* const nd)
      * @see get_head()
     */
-    void set_head(T dt);
+    void set_head(const T& dt);
 
     /**
      * Inserts the Node into the index provided
+     * @note The list takes ownership of the node, unless an exception is thrown
      * @param nd Node to be inserted
      * @param idx Index where the Node will be inserted
      * @return Pointer to the Node that is behind the inserted Node
@@ -150,68 +339,249 @@ public:
      * @param idx Index where the Node will be inserted
      * @return Pointer to the Node that is behind the inserted Node 
      */
-    double_node<T>* insert_node(T dt, unsigned int idx);
+    double_node<T>* insert_node(const T& dt, unsigned int idx);
+
+    /** 
+     * Moves a value into the index provided
+     * @param dt Value to be inserted into the list
+     * @param idx Index where the Node will be inserted
+     * @return Pointer to the Node that is behind the inserted Node 
+     */
+    double_node<T>* insert_node(T&& dt, unsigned int idx);
+
     /**
      * Returns the length of the dl list
      * @return Length of the list
      */
-    unsigned int size() {return len;}
+    unsigned int size() const {return len;}
+
+    /**
+     * Returns an iterator to the first value of the list
+     * @return Iterator to the head [end() if the list is empty]
+     * @see end()
+     */
+    iterator begin() {return iterator(head, this);}
+    const_iterator begin() const {return const_iterator(head, this);}
+    const_iterator cbegin() const {return const_iterator(head, this);}
+
+    /**
+     * Returns an iterator past the last value of the list
+     * @return Iterator which points to nothing, but can be decremented onto the tail
+     * @see begin()
+     */
+    iterator end() {return iterator(nullptr, this);}
+    const_iterator end() const {return const_iterator(nullptr, this);}
+    const_iterator cend() const {return const_iterator(nullptr, this);}
+
+    /**
+     * Returns reverse iterators, which walk the list from the tail to the head
+     */
+    reverse_iterator rbegin() {return reverse_iterator(end());}
+    const_reverse_iterator rbegin() const {return const_reverse_iterator(end());}
+    reverse_iterator rend() {return reverse_iterator(begin());}
+    const_reverse_iterator rend() const {return const_reverse_iterator(begin());}
+
+    /**
+     * Frees every node of the list, leaving it empty
+     * @see ~dl_list()
+     */
+    void clear();
+
+    /**
+     * Returns a copy of the allocator used by the list
+     * @return The list's allocator
+     */
+    allocator_type get_allocator() const {return allocator_type(alloc);}
+
+private:
+    /**
+     * Allocates a node using the list's allocator, and constructs it's data in place
+     * @param args Arguments forwarded to T's constructor
+     * @return The new node
+     */
+    template <class... Args>
+    double_node<T>* create_node(Args&&... args);
+
+    /**
+     * Links an already created node to the front of the list
+     * @param nd Node to be linked
+     * @return The list's new head
+     */
+    double_node<T>* link_front(double_node<T>* const nd);
+
+    /**
+     * Links an already created node to the end of the list
+     * @param nd Node to be linked
+     * @return The list's new tail
+     */
+    double_node<T>* link_back(double_node<T>* const nd);
+
+    /**
+     * Destroys and deallocates a node, that was created by create_node()
+     * @param nd Node to be freed
+     */
+    void destroy_node(double_node<T>* const nd);
 };
 
-template <class T>
-dl_list<T>::dl_list(const dl_list& list) {
-    len = list.len;
-    double_node<T>* newNd = new double_node<T>(*(list.get_head()));
-    head = newNd;
+template <class T, class Alloc>
+template <class... Args>
+double_node<T>* dl_list<T, Alloc>::create_node(Args&&... args) {
+    double_node<T>* nd = node_traits::allocate(alloc, 1);
+    try {
+        node_traits::construct(alloc, nd, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Alloc>
+void dl_list<T, Alloc>::destroy_node(double_node<T>* const nd) {
+    node_traits::destroy(alloc, nd);
+    node_traits::deallocate(alloc, nd, 1);
+}
+
+template <class T, class Alloc>
+dl_list<T, Alloc>::dl_list(const dl_list& list)
+    : alloc{node_traits::select_on_container_copy_construction(list.alloc)}, head{nullptr}, tail{nullptr}, len{0} {
+    // Copy every value into a node of our own
+    for (double_node<T>* currNode = list.head; currNode != nullptr; currNode = currNode->get_next())
+        emplace_back(currNode->get_data());
 };
 
-template <class T>
-double_node<T>* dl_list<T>::push_front(T dt) {
-    return push_front(new double_node<T>(dt));
+template <class T, class Alloc>
+dl_list<T, Alloc>::dl_list(dl_list&& list) noexcept
+    : alloc{std::move(list.alloc)}, head{list.head}, tail{list.tail}, len{list.len} {
+    list.head = list.tail = nullptr;
+    list.len = 0;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::push_front(double_node<T>* const nd) {
-    // Create new node to insert
-    double_node<T>* newNode = new double_node<T>();
+template <class T, class Alloc>
+dl_list<T, Alloc>& dl_list<T, Alloc>::operator=(const dl_list& list) {
+    if (this != &list) {
+        clear();
+        for (double_node<T>* currNode = list.head; currNode != nullptr; currNode = currNode->get_next())
+            emplace_back(currNode->get_data());
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+dl_list<T, Alloc>& dl_list<T, Alloc>::operator=(dl_list&& list) noexcept {
+    if (this != &list) {
+        // Our nodes have to be freed with our own allocator, before it gets replaced
+        clear();
+        alloc = std::move(list.alloc);
+        head = list.head;
+        tail = list.tail;
+        len = list.len;
+        list.head = list.tail = nullptr;
+        list.len = 0;
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+dl_list<T, Alloc>::~dl_list() {
+    clear();
+}
+
+template <class T, class Alloc>
+void dl_list<T, Alloc>::clear() {
+    // Free the nodes front to back
+    while (head != nullptr) {
+        double_node<T>* temp = head;
+        head = head->get_next();
+        destroy_node(temp);
+    }
+    tail = nullptr;
+    len = 0;
+}
 
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::link_front(double_node<T>* const nd) {
     // Make new head
-    newNode->set_data(nd->get_data());
-    newNode->set_next(head);
+    nd->set_prev(nullptr);
+    nd->set_next(head);
+    if (head != nullptr)
+        head->set_prev(nd);
+    else
+        tail = nd;
     
     // Replace old head with new
-    head = newNode;
+    head = nd;
     ++len;
 
     return head;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::push_back(T dt) {
-    return push_back(new double_node<T>(dt));
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::link_back(double_node<T>* const nd) {
+    nd->set_next(nullptr);
+    nd->set_prev(tail);
+
+    // Add the Node to the end, no traversal needed
+    if (tail == nullptr)
+        head = nd;
+    else
+        tail->set_next(nd);
+    tail = nd;
+    ++len;
+
+    // Return the new "tail"
+    return tail;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::push_back(double_node<T>* const nd) {
-    // Set pointer node
-    double_node<T>* currNode = head;
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_front(const T& dt) {
+    return emplace_front(dt);
+}
 
-    double_node<T>* newTail = new double_node<T>(nd->get_data());
-    // Traverse the list
-    while (currNode->get_next() != nullptr)
-        currNode = currNode->get_next();
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_front(T&& dt) {
+    return emplace_front(std::move(dt));
+}
 
-    // Add the Node to the end
-    currNode->set_next(newTail);
-    newTail->set_prev(currNode);
-    ++len;
+template <class T, class Alloc>
+template <class... Args>
+double_node<T>* dl_list<T, Alloc>::emplace_front(Args&&... args) {
+    // The data is built directly inside of the node, no copies
+    return link_front(create_node(std::forward<Args>(args)...));
+}
 
-    // Return the new "tail"
-    return newTail;
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_front(double_node<T>* const nd) {
+    // The node is ours now, so it gets linked as is
+    return link_front(nd);
+}
+
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_back(const T& dt) {
+    return emplace_back(dt);
+}
+
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_back(T&& dt) {
+    return emplace_back(std::move(dt));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+double_node<T>* dl_list<T, Alloc>::emplace_back(Args&&... args) {
+    // The data is built directly inside of the node, no copies
+    return link_back(create_node(std::forward<Args>(args)...));
 }
 
-template <class T>
-double_node<T>* dl_list<T>::pop_back() {
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::push_back(double_node<T>* const nd) {
+    // The node is ours now, so it gets linked as is
+    return link_back(nd);
+}
+
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::pop_back() {
     // Error case
     if (len <= 0) {
         throw std::invalid_argument("Invalid removal. List length is 0.\n");
@@ -219,41 +589,44 @@ double_node<T>* dl_list<T>::pop_back() {
 
     else if (len == 1) {
         --len;
-        delete head;
+        destroy_node(head);
+        head = tail = nullptr;
         return nullptr;
     }
 
-    // Set pointer node
-    node<T>* currNode = head;
-
-    // Traversing until the second-to-last list Node
-    while (currNode->get_next()->get_next() != nullptr)
-        currNode = currNode->get_next();
+    // The tail knows it's predecessor, no traversal needed
+    double_node<T>* currNode = tail->get_prev();
 
     // Set last list member to null
-    delete(currNode->get_next());
+    destroy_node(tail);
     currNode->set_next(nullptr);
+    tail = currNode;
     --len;
 
     // Return the new last member
     return currNode;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::pop_front() {
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::pop_front() {
     // Self-explanatory
     if (head == nullptr)
          return nullptr;
 
     // Move over head by one node, and return it
-    node<T>* temp = head;
+    double_node<T>* temp = head;
     head = head->get_next();
-    delete temp;
+    if (head == nullptr)
+        tail = nullptr;
+    else
+        head->set_prev(nullptr);
+    destroy_node(temp);
+    --len;
     return head;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::insert_node(double_node<T>* const nd, unsigned int idx) {
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::insert_node(double_node<T>* const nd, unsigned int idx) {
     if (idx == 0) {
         this->push_front(nd);
         return head;
@@ -281,25 +654,55 @@ double_node<T>* dl_list<T>::insert_node(double_node<T>* const nd, unsigned int i
     return currentNode;
 }
 
-template <class T>
-double_node<T>* dl_list<T>::insert_node(const T dt, unsigned int idx) {
-    return insert_node(new double_node<T>(dt), idx);
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::insert_node(const T& dt, unsigned int idx) {
+    double_node<T>* nd = create_node(dt);
+    try {
+        return insert_node(nd, idx);
+    }
+    catch (...) {
+        // Out of range, the node never made it into the list
+        destroy_node(nd);
+        throw;
+    }
 }
 
-template <class T>
-double_node<T>* dl_list<T>::get_head() const {
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::insert_node(T&& dt, unsigned int idx) {
+    double_node<T>* nd = create_node(std::move(dt));
+    try {
+        return insert_node(nd, idx);
+    }
+    catch (...) {
+        // Out of range, the node never made it into the list
+        destroy_node(nd);
+        throw;
+    }
+}
+
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::get_head() const {
     return head;
 }
 
-template <class T>
-void dl_list<T>::set_head(double_node<T>* const nd) {
-    head = nd;
+template <class T, class Alloc>
+double_node<T>* dl_list<T, Alloc>::get_tail() const {
+    return tail;
 }
 
-template <class T> 
-void dl_list<T>::set_head(T dt) {
-    this->pop_front();
-    this->push_front(dt);
+template <class T, class Alloc>
+void dl_list<T, Alloc>::set_head(double_node<T>* const nd) {
+    pop_front();
+    push_front(nd);
+}
+
+template <class T, class Alloc>
+void dl_list<T, Alloc>::set_head(const T& dt) {
+    // Overwrite the data in place, instead of re-allocating the head
+    if (head == nullptr)
+        this->push_front(dt);
+    else
+        head->set_data(dt);
 }
 
 #endif // DOUBLY_LINKED_LIST_H
\ No newline at end of file
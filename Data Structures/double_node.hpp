@@ -11,6 +11,8 @@
 #ifndef DOUBLE_NODE_H
 #define DOUBLE_NODE_H
 
+#include <utility>
+
 /*!
  * @class double_node 
  * @brief double_node class.
@@ -18,7 +20,8 @@
  * @details A Node class, that has a pointer to a node in front and behind. It has all of the functionalities of the node class, however it does NOT inherit it.
  * 
  * @fn get_data()
- * @fn set_data(T dt)
+ * @fn set_data(const T& dt)
+ * @fn set_data(T&& dt)
  * @fn get_next()
  * @fn set_next(double_node<T>* const nd)
  * @fn get_prev()
@@ -54,8 +57,27 @@ public:
      * @see double_node(double_node<T>& const nd) 
      * @see double_node(double_node<T>* const nd, const T dt)
      */
-    double_node(const T dt)
-        : double_node{nullptr, nullptr, dt} { };
+    double_node(const T& dt)
+        : next{nullptr}, prev{nullptr}, data{dt} { };
+
+    /**
+     * Creates a new double_node that points to NULL in both ways, and moves the data into the node.
+     * @brief Constructor.
+     * @param dt double_node data 
+     * @see double_node(const T dt)
+     */
+    double_node(T&& dt)
+        : next{nullptr}, prev{nullptr}, data{std::move(dt)} { }
+
+    /**
+     * Creates a new double_node that points to NULL in both ways, and constructs it's data in place from the provided arguments.
+     * @brief Emplacing constructor.
+     * @param args Arguments forwarded to T's constructor
+     * @see double_node(const T dt)
+     */
+    template <class... Args>
+    explicit double_node(std::in_place_t, Args&&... args)
+        : next{nullptr}, prev{nullptr}, data(std::forward<Args>(args)...) { }
 
     /**
      * Creates a new double_node that points to NULL in both ways, and has data.
@@ -80,8 +102,8 @@ public:
     * @see double_node(double_node<T>* const nd)
     * @see double_node(double_node<T>& const nd
     */
-    double_node(double_node<T>* const nd, const T dt)
-        : next{nd}, data{dt} { }
+    double_node(double_node<T>* const nd, const T& dt)
+        : next{nd}, prev{nullptr}, data{dt} { }
     
 /** 
     * Construct a new double_node object from another double_node object.
@@ -122,19 +144,33 @@ public:
      */
     void set_prev(double_node<T>* const nd);
 
-        /**
+    /**
      * @brief Get the double node's data
-     * @return double_node data
+     * @return Reference to the double_node data
      * @see setData(const T dt)
      */
-    T get_data() const;
+    T& get_data();
+
+    /**
+     * @brief Get the double node's data
+     * @return Read-only reference to the double_node data
+     * @see setData(const T dt)
+     */
+    const T& get_data() const;
 
     /**
      * @brief Set the current double node's data
      * @param dt new double_node data
      * @see getData() 
      */
-    void set_data(const T dt);
+    void set_data(const T& dt);
+
+    /**
+     * @brief Move new data into the current double node
+     * @param dt new double_node data
+     * @see getData() 
+     */
+    void set_data(T&& dt);
 };
 
 template <typename T>
@@ -162,13 +198,23 @@ double_node<T>* double_node<T>::get_next() const {
 }
 
 template <typename T>
-T double_node<T>::get_data() const {
+T& double_node<T>::get_data() {
     return data;
 }
 
 template <typename T>
-void double_node<T>::set_data(const T dt) {
+const T& double_node<T>::get_data() const {
+    return data;
+}
+
+template <typename T>
+void double_node<T>::set_data(const T& dt) {
     data = dt;
 }
 
+template <typename T>
+void double_node<T>::set_data(T&& dt) {
+    data = std::move(dt);
+}
+
 #endif // DOUBLE_NODE_H
\ No newline at end of file
@@ -0,0 +1,248 @@
+/**
+ * @file epoch.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines epoch-based memory reclamation for the lock-free containers
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*!
+ * @class epoch_domain
+ * @brief Epoch-based memory reclamation domain.
+ *
+ * @details Lock-free containers can't free an unlinked node straight away, because another thread may still be reading it.
+ * Every operation on such a container pins the domain (see pin()) for as long as it touches shared nodes, and nodes which were unlinked are handed to retire() instead of being freed.
+ * The domain keeps a global epoch, which only moves forward once every pinned thread has seen the current one. A node retired in epoch e is therefore unreachable to everyone once the global epoch reaches e + 2, and is freed then.
+ *
+ * @note Threads don't have to register, pin() borrows a free participant record (and every thread keeps trying the record it used last, so it usually gets it back without contention).
+ * @note The domain must outlive every guard, and every node still waiting to be freed is freed by the destructor.
+ *
+ * @fn pin()
+ * @fn retire(void* ptr, void (*deleter)(void*, void*), void* context)
+ */
+class epoch_domain {
+private:
+    static constexpr std::uint64_t inactive = ~std::uint64_t{0};   /**< Epoch of a participant which isn't pinned*/
+    static constexpr std::size_t retire_threshold = 64;             /**< Retired nodes a participant collects before it tries to free some*/
+
+    /**< A node which was unlinked, and is waiting to be freed*/
+    struct retired {
+        void* ptr;
+        void (*deleter)(void*, void*);
+        void* context;
+        std::uint64_t epoch;
+    };
+
+    /**< State of one pinned (or idle) thread, padded to it's own cache line*/
+    struct alignas(64) participant {
+        std::atomic<std::uint64_t> local{inactive};  /**< Epoch this participant is pinned in [inactive if it isn't]*/
+        std::atomic<bool> in_use{false};             /**< Set while a guard owns this record*/
+        participant* next = nullptr;                 /**< Next record in the domain's list [never changes once linked]*/
+        std::vector<retired> limbo;                  /**< Nodes retired through this record, only touched by the owning guard*/
+        std::size_t next_collect = retire_threshold; /**< Limbo size at which the next collection is attempted*/
+    };
+
+    std::atomic<std::uint64_t> global_epoch{0};         /**< Current epoch*/
+    std::atomic<participant*> participants{nullptr};    /**< Every record ever created, newest first*/
+    const std::uint64_t id;                             /**< Unique id, so stale thread-local hints of a destroyed domain are never used*/
+
+    static std::uint64_t next_id() {
+        static std::atomic<std::uint64_t> counter{1};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**< The record the calling thread used last, and which domain it belongs to*/
+    struct hint {
+        std::uint64_t domain_id = 0;
+        participant* record = nullptr;
+    };
+
+    static hint& thread_hint() {
+        thread_local hint h;
+        return h;
+    }
+
+    /**
+     * @brief Claims a participant record for the calling thread, creating a new one if all of them are taken.
+     */
+    participant* acquire();
+
+    /**
+     * @brief Moves the global epoch forward, if every pinned participant has caught up with it.
+     * @return The global epoch after the attempt.
+     */
+    std::uint64_t try_advance();
+
+    /**
+     * @brief Frees every node in the participant's limbo, which was retired at least two epochs ago.
+     */
+    static void collect(participant* p, std::uint64_t epoch);
+
+public:
+    /*!
+     * @class guard
+     * @brief Keeps the calling thread pinned in the domain, until it is destroyed.
+     *
+     * @details Nodes which were reachable while the guard was created won't be freed, until the guard is gone.
+     */
+    class guard {
+    public:
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+        guard(guard&& g) noexcept
+            : domain{g.domain}, record{g.record} {
+            g.record = nullptr;
+        }
+
+        ~guard() {
+            if (record != nullptr) {
+                record->local.store(inactive, std::memory_order_release);
+                record->in_use.store(false, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief Hands an unlinked node to the domain, which will call deleter(ptr, context) once no thread can be reading it.
+         * @param ptr Node which is no longer reachable from the container.
+         * @param deleter Function which frees the node.
+         * @param context Passed to the deleter as-is (usually the container, which owns the allocator).
+         */
+        void retire(void* ptr, void (*deleter)(void*, void*), void* context) {
+            domain->retire(record, ptr, deleter, context);
+        }
+
+    private:
+        friend class epoch_domain;
+
+        guard(epoch_domain* d, participant* p)
+            : domain{d}, record{p} { }
+
+        epoch_domain* domain;   /**< Domain in which the thread is pinned*/
+        participant* record;    /**< Record which is owned by this guard*/
+    };
+
+    epoch_domain()
+        : id{next_id()} { }
+
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    /**
+     * @brief Frees every node which is still waiting, and every participant record.
+     * @note No thread may be pinned anymore.
+     */
+    ~epoch_domain();
+
+    /**
+     * @brief Pins the calling thread in the current epoch.
+     * @return Guard, which keeps the thread pinned until it is destroyed.
+     */
+    guard pin();
+
+private:
+    void retire(participant* p, void* ptr, void (*deleter)(void*, void*), void* context);
+};
+
+inline epoch_domain::participant* epoch_domain::acquire() {
+    hint& h = thread_hint();
+    bool expected = false;
+
+    // Most of the time the record we used last is still free
+    if (h.domain_id == id && h.record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        return h.record;
+
+    // Otherwise take any free one...
+    for (participant* p = participants.load(std::memory_order_acquire); p != nullptr; p = p->next) {
+        expected = false;
+        if (!p->in_use.load(std::memory_order_relaxed) &&
+            p->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            h = hint{id, p};
+            return p;
+        }
+    }
+
+    // ...or add a new one to the front of the list
+    participant* fresh = new participant;
+    fresh->in_use.store(true, std::memory_order_relaxed);
+    participant* head = participants.load(std::memory_order_relaxed);
+    do {
+        fresh->next = head;
+    } while (!participants.compare_exchange_weak(head, fresh, std::memory_order_release, std::memory_order_relaxed));
+
+    h = hint{id, fresh};
+    return fresh;
+}
+
+inline epoch_domain::guard epoch_domain::pin() {
+    participant* p = acquire();
+
+    // Announce the epoch before touching any shared node. The fence keeps the announcement from being reordered after the loads that follow.
+    // The store is a release (as is the one which unpins), so try_advance() reading it also orders this thread's earlier reads before any free, which is what TSan can check, since it ignores fences.
+    p->local.store(global_epoch.load(std::memory_order_relaxed), std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return guard(this, p);
+}
+
+inline std::uint64_t epoch_domain::try_advance() {
+    std::uint64_t epoch = global_epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Someone who is still pinned in an older epoch may be reading nodes from it
+    for (participant* p = participants.load(std::memory_order_acquire); p != nullptr; p = p->next) {
+        const std::uint64_t local = p->local.load(std::memory_order_acquire);
+        if (local != inactive && local != epoch)
+            return epoch;
+    }
+
+    // Losing this race is fine, it means that someone else moved it forward
+    if (global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+        return epoch + 1;
+    return epoch;
+}
+
+inline void epoch_domain::collect(participant* p, std::uint64_t epoch) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < p->limbo.size(); ++i) {
+        retired& r = p->limbo[i];
+        if (r.epoch + 2 <= epoch)
+            r.deleter(r.ptr, r.context);
+        else
+            p->limbo[kept++] = r;
+    }
+    p->limbo.resize(kept);
+
+    // If a slow thread keeps the epoch from moving, don't rescan the same nodes on every retire
+    p->next_collect = kept + retire_threshold;
+}
+
+inline void epoch_domain::retire(participant* p, void* ptr, void (*deleter)(void*, void*), void* context) {
+    p->limbo.push_back(retired{ptr, deleter, context, global_epoch.load(std::memory_order_relaxed)});
+
+    // Don't bother scanning the participants on every retire
+    if (p->limbo.size() >= p->next_collect)
+        collect(p, try_advance());
+}
+
+inline epoch_domain::~epoch_domain() {
+    participant* p = participants.load(std::memory_order_acquire);
+    while (p != nullptr) {
+        for (retired& r : p->limbo)
+            r.deleter(r.ptr, r.context);
+
+        participant* next = p->next;
+        delete p;
+        p = next;
+    }
+}
+
+#endif // EPOCH_H
@@ -0,0 +1,406 @@
+/**
+ * @file fenwick_tree.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines Fenwick trees (Binary-Indexed Trees): a point update one, a range update one and a 2D one
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef FENWICK_TREE_H
+#define FENWICK_TREE_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+/*!
+ * @class fenwick_tree
+ * @brief Fenwick tree (Binary-Indexed Tree) class, with point updates and prefix sums in O(log n).
+ *
+ * @details tree[i] (1-based) holds the sum of the values (i - lowbit(i), i], where lowbit(i) = i & -i. A prefix sum adds up O(log n) of those ranges, and an update changes O(log n) of them.
+ * Unlike a plain array of prefix sums (std::partial_sum), which has to be recomputed in O(n) after every change.
+ *
+ * @fn add(std::size_t i, const T& delta)
+ * @fn set(std::size_t i, const T& value)
+ * @fn get(std::size_t i)
+ * @fn prefix_sum(std::size_t i)
+ * @fn sum(std::size_t first, std::size_t last)
+ * @fn lower_bound(const T& target)
+ * @fn assign(InputIt first, InputIt last)
+ * @tparam T typename
+ */
+template <class T>
+class fenwick_tree {
+private:
+    std::vector<T> tree;    /**< 1-based tree, tree[0] is unused*/
+
+    static std::size_t lowbit(std::size_t i) {return i & (~i + 1);}
+
+    void check_index(std::size_t i) const {
+        if (i >= size())
+            throw std::out_of_range("Fenwick tree index out of range");
+    }
+
+public:
+    using value_type = T;
+
+    /**
+     * Creates a tree of n zeroes.
+     * @brief Constructor.
+     */
+    explicit fenwick_tree(std::size_t n = 0)
+        : tree(n + 1, T(0)) { }
+
+    /**
+     * Creates a tree of the values in [first, last), in O(n).
+     * @brief Range constructor.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    fenwick_tree(InputIt first, InputIt last)
+        : tree{} { assign(first, last); }
+
+    /**
+     * @brief Replaces the values with the ones in [first, last), in O(n).
+     * @details Every node pushes it's sum into it's parent once, instead of doing n updates in O(n log n).
+     */
+    template <class InputIt>
+    void assign(InputIt first, InputIt last);
+
+    /**
+     * @brief Returns the amount of values.
+     */
+    std::size_t size() const {return tree.size() - 1;}
+
+    /**
+     * @brief Adds delta to the value at i.
+     * @throws std::out_of_range if i >= size().
+     */
+    void add(std::size_t i, const T& delta);
+
+    /**
+     * @brief Replaces the value at i.
+     * @throws std::out_of_range if i >= size().
+     */
+    void set(std::size_t i, const T& value) {add(i, value - get(i));}
+
+    /**
+     * @brief Returns the value at i.
+     * @throws std::out_of_range if i >= size().
+     */
+    T get(std::size_t i) const;
+
+    /**
+     * @brief Returns the sum of the first i values [0, i).
+     * @throws std::out_of_range if i > size().
+     */
+    T prefix_sum(std::size_t i) const;
+
+    /**
+     * @brief Returns the sum of the values [first, last).
+     * @throws std::out_of_range if last > size(), or first > last.
+     */
+    T sum(std::size_t first, std::size_t last) const {
+        if (first > last)
+            throw std::out_of_range("Fenwick tree range is reversed");
+        return prefix_sum(last) - prefix_sum(first);
+    }
+
+    /**
+     * @brief Returns the smallest i, for which prefix_sum(i + 1) >= target [size() if there is none], in O(log n).
+     * @note Only makes sense if none of the values are negative, so the prefix sums don't decrease.
+     */
+    std::size_t lower_bound(const T& target) const;
+};
+
+/*!
+ * @class range_fenwick_tree
+ * @brief Fenwick tree class, with range updates and range sums in O(log n).
+ *
+ * @details Adding d to [l, r) adds d * (i - l) to every prefix sum with l <= i < r, and d * (r - l) to the ones past r. That's linear in i, so two point update trees hold it:
+ * prefix_sum(i) = i * slope.prefix_sum(i) - offset.prefix_sum(i) [with the sums running up to and including i - 1].
+ *
+ * @fn add(std::size_t first, std::size_t last, const T& delta)
+ * @fn get(std::size_t i)
+ * @fn prefix_sum(std::size_t i)
+ * @fn sum(std::size_t first, std::size_t last)
+ * @tparam T typename
+ */
+template <class T>
+class range_fenwick_tree {
+private:
+    fenwick_tree<T> slope;      /**< Differences of the values*/
+    fenwick_tree<T> offset;     /**< Differences of the values, times their index*/
+
+public:
+    using value_type = T;
+
+    /**
+     * Creates a tree of n zeroes.
+     * @brief Constructor.
+     */
+    explicit range_fenwick_tree(std::size_t n = 0)
+        : slope(n), offset(n) { }
+
+    /**
+     * Creates a tree of the values in [first, last), in O(n).
+     * @brief Range constructor.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    range_fenwick_tree(InputIt first, InputIt last);
+
+    std::size_t size() const {return slope.size();}
+
+    /**
+     * @brief Adds delta to every value in [first, last).
+     * @throws std::out_of_range if last > size(), or first > last.
+     */
+    void add(std::size_t first, std::size_t last, const T& delta);
+
+    /**
+     * @brief Returns the value at i.
+     * @throws std::out_of_range if i >= size().
+     */
+    T get(std::size_t i) const {
+        if (i >= size())
+            throw std::out_of_range("Fenwick tree index out of range");
+        return slope.prefix_sum(i + 1);
+    }
+
+    /**
+     * @brief Returns the sum of the first i values [0, i).
+     * @throws std::out_of_range if i > size().
+     */
+    T prefix_sum(std::size_t i) const {
+        return static_cast<T>(i) * slope.prefix_sum(i) - offset.prefix_sum(i);
+    }
+
+    /**
+     * @brief Returns the sum of the values [first, last).
+     * @throws std::out_of_range if last > size(), or first > last.
+     */
+    T sum(std::size_t first, std::size_t last) const {
+        if (first > last)
+            throw std::out_of_range("Fenwick tree range is reversed");
+        return prefix_sum(last) - prefix_sum(first);
+    }
+};
+
+/*!
+ * @class fenwick_tree_2d
+ * @brief 2D Fenwick tree class, with point updates and rectangle sums in O(log(rows) * log(cols)).
+ *
+ * @details A Fenwick tree over rows, where every node is a Fenwick tree over columns. All of them live in one row-major array.
+ *
+ * @fn add(std::size_t r, std::size_t c, const T& delta)
+ * @fn prefix_sum(std::size_t r, std::size_t c)
+ * @fn sum(std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2)
+ * @tparam T typename
+ */
+template <class T>
+class fenwick_tree_2d {
+private:
+    std::size_t n_rows;     /**< Amount of rows*/
+    std::size_t n_cols;     /**< Amount of columns*/
+    std::vector<T> tree;    /**< (rows + 1) x (cols + 1), 1-based in both directions*/
+
+    static std::size_t lowbit(std::size_t i) {return i & (~i + 1);}
+
+    T& at(std::size_t r, std::size_t c) {return tree[r * (n_cols + 1) + c];}
+    const T& at(std::size_t r, std::size_t c) const {return tree[r * (n_cols + 1) + c];}
+
+public:
+    using value_type = T;
+
+    /**
+     * Creates a rows x cols tree of zeroes.
+     * @brief Constructor.
+     */
+    fenwick_tree_2d(std::size_t rows, std::size_t cols)
+        : n_rows{rows}, n_cols{cols}, tree((rows + 1) * (cols + 1), T(0)) { }
+
+    /**
+     * Creates a rows x cols tree of the values in a row-major array, in O(rows * cols).
+     * @brief Array constructor.
+     */
+    fenwick_tree_2d(std::size_t rows, std::size_t cols, const T* values);
+
+    std::size_t rows() const {return n_rows;}
+    std::size_t cols() const {return n_cols;}
+
+    /**
+     * @brief Adds delta to the value at (r, c).
+     * @throws std::out_of_range if (r, c) is outside of the tree.
+     */
+    void add(std::size_t r, std::size_t c, const T& delta);
+
+    /**
+     * @brief Returns the sum of the values in [0, r) x [0, c).
+     * @throws std::out_of_range if r > rows(), or c > cols().
+     */
+    T prefix_sum(std::size_t r, std::size_t c) const;
+
+    /**
+     * @brief Returns the sum of the values in [r1, r2) x [c1, c2).
+     * @throws std::out_of_range if the rectangle is outside of the tree, or reversed.
+     */
+    T sum(std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2) const {
+        if (r1 > r2 || c1 > c2)
+            throw std::out_of_range("Fenwick tree range is reversed");
+        return prefix_sum(r2, c2) - prefix_sum(r1, c2) - prefix_sum(r2, c1) + prefix_sum(r1, c1);
+    }
+
+    /**
+     * @brief Returns the value at (r, c).
+     * @throws std::out_of_range if (r, c) is outside of the tree.
+     */
+    T get(std::size_t r, std::size_t c) const {return sum(r, c, r + 1, c + 1);}
+};
+
+template <class T>
+template <class InputIt>
+void fenwick_tree<T>::assign(InputIt first, InputIt last) {
+    // insert() sizes the array once for forward iterators, instead of growing it value by value
+    tree.assign(1, T(0));
+    tree.insert(tree.end(), first, last);
+
+    // Every node adds it's (finished) sum to it's parent, in increasing order
+    const std::size_t n = size();
+    for (std::size_t i = 1; i <= n; ++i) {
+        const std::size_t parent = i + lowbit(i);
+        if (parent <= n)
+            tree[parent] += tree[i];
+    }
+}
+
+template <class T>
+void fenwick_tree<T>::add(std::size_t i, const T& delta) {
+    check_index(i);
+    for (++i; i < tree.size(); i += lowbit(i))
+        tree[i] += delta;
+}
+
+template <class T>
+T fenwick_tree<T>::get(std::size_t i) const {
+    check_index(i);
+
+    // prefix_sum(i + 1) - prefix_sum(i), but both walks meet after a few steps, so only walk until then
+    T value = tree[i + 1];
+    const std::size_t stop = i + 1 - lowbit(i + 1);
+    for (; i > stop; i -= lowbit(i))
+        value -= tree[i];
+    return value;
+}
+
+template <class T>
+T fenwick_tree<T>::prefix_sum(std::size_t i) const {
+    if (i > size())
+        throw std::out_of_range("Fenwick tree index out of range");
+
+    T total = T(0);
+    for (; i > 0; i -= lowbit(i))
+        total += tree[i];
+    return total;
+}
+
+template <class T>
+std::size_t fenwick_tree<T>::lower_bound(const T& target) const {
+    if (!(T(0) < target))
+        return 0;
+
+    // Walk down from the highest power of two, taking every range whose sum still stays below the target
+    std::size_t step = 1;
+    while (step * 2 <= size())
+        step *= 2;
+
+    std::size_t pos = 0;
+    T remaining = target;
+    for (; step > 0; step /= 2) {
+        if (pos + step <= size() && tree[pos + step] < remaining) {
+            pos += step;
+            remaining -= tree[pos];
+        }
+    }
+    return pos;
+}
+
+template <class T>
+template <class InputIt, class>
+range_fenwick_tree<T>::range_fenwick_tree(InputIt first, InputIt last)
+    : slope{}, offset{} {
+    // Both trees are built from differences of the values, in O(n)
+    std::vector<T> difference;
+    std::vector<T> weighted;
+    T previous = T(0);
+    for (; first != last; ++first) {
+        const T value = *first;
+        difference.push_back(value - previous);
+        weighted.push_back(static_cast<T>(difference.size() - 1) * difference.back());
+        previous = value;
+    }
+    slope.assign(difference.begin(), difference.end());
+    offset.assign(weighted.begin(), weighted.end());
+}
+
+template <class T>
+void range_fenwick_tree<T>::add(std::size_t first, std::size_t last, const T& delta) {
+    if (first > last || last > size())
+        throw std::out_of_range("Fenwick tree range out of range");
+    if (first == last)
+        return;
+
+    slope.add(first, delta);
+    offset.add(first, static_cast<T>(first) * delta);
+    if (last < size()) {
+        slope.add(last, T(0) - delta);
+        offset.add(last, T(0) - static_cast<T>(last) * delta);
+    }
+}
+
+template <class T>
+fenwick_tree_2d<T>::fenwick_tree_2d(std::size_t rows, std::size_t cols, const T* values)
+    : n_rows{rows}, n_cols{cols}, tree((rows + 1) * (cols + 1), T(0)) {
+    for (std::size_t r = 0; r < rows; ++r)
+        for (std::size_t c = 0; c < cols; ++c)
+            at(r + 1, c + 1) = values[r * cols + c];
+
+    // The same O(n) build as fenwick_tree, along the columns, and then along the rows
+    for (std::size_t r = 1; r <= rows; ++r)
+        for (std::size_t c = 1; c <= cols; ++c) {
+            const std::size_t parent = c + lowbit(c);
+            if (parent <= cols)
+                at(r, parent) += at(r, c);
+        }
+
+    for (std::size_t r = 1; r <= rows; ++r) {
+        const std::size_t parent = r + lowbit(r);
+        if (parent <= rows)
+            for (std::size_t c = 1; c <= cols; ++c)
+                at(parent, c) += at(r, c);
+    }
+}
+
+template <class T>
+void fenwick_tree_2d<T>::add(std::size_t r, std::size_t c, const T& delta) {
+    if (r >= n_rows || c >= n_cols)
+        throw std::out_of_range("Fenwick tree index out of range");
+
+    for (std::size_t i = r + 1; i <= n_rows; i += lowbit(i))
+        for (std::size_t j = c + 1; j <= n_cols; j += lowbit(j))
+            at(i, j) += delta;
+}
+
+template <class T>
+T fenwick_tree_2d<T>::prefix_sum(std::size_t r, std::size_t c) const {
+    if (r > n_rows || c > n_cols)
+        throw std::out_of_range("Fenwick tree index out of range");
+
+    T total = T(0);
+    for (std::size_t i = r; i > 0; i -= lowbit(i))
+        for (std::size_t j = c; j > 0; j -= lowbit(j))
+            total += at(i, j);
+    return total;
+}
+
+#endif // FENWICK_TREE_H
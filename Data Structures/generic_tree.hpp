@@ -0,0 +1,481 @@
+/**
+ * @file generic_tree.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a generic (n-ary) tree class, stored in first-child/next-sibling form, with all of it's nodes in one arena
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef GENERIC_TREE_H
+#define GENERIC_TREE_H
+
+#include "node_pool.hpp"
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <class T, std::size_t ChunkSize>
+class generic_tree;
+
+/*!
+ * @class tree_node
+ * @brief Generic Tree Node class.
+ *
+ * @details A node with any amount of children. Like double_node, siblings form a doubly-linked list (next/prev), and every node only points to it's first child,
+ * so a node has the same size no matter how many children it has. The prev of a first child points to the last child, so appending a child is O(1).
+ *
+ * @fn get_data()
+ * @fn set_data(const T& dt)
+ * @fn get_parent()
+ * @fn get_first_child()
+ * @fn get_last_child()
+ * @fn get_next_sibling()
+ * @fn get_prev_sibling()
+ * @tparam T typename
+ */
+template <class T>
+class tree_node {
+private:
+    tree_node<T>* parent;   /**< Pointer to the parent [nullptr for the root]*/
+    tree_node<T>* child;    /**< Pointer to the first child*/
+    tree_node<T>* next;     /**< Pointer to the next sibling*/
+    tree_node<T>* prev;     /**< Pointer to the previous sibling [the last sibling, if this is the first child]*/
+    T data;                 /**< Data that this node contains*/
+
+    template <class U, std::size_t N>
+    friend class generic_tree;
+
+public:
+    /**
+     * Creates a new tree_node, that points to null in every direction, and constructs it's data in place.
+     * @brief Emplacing constructor.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <class... Args>
+    explicit tree_node(std::in_place_t, Args&&... args)
+        : parent{nullptr}, child{nullptr}, next{nullptr}, prev{nullptr}, data(std::forward<Args>(args)...) { }
+
+    T& get_data() {return data;}
+    const T& get_data() const {return data;}
+    void set_data(const T& dt) {data = dt;}
+    void set_data(T&& dt) {data = std::move(dt);}
+
+    tree_node<T>* get_parent() const {return parent;}
+    tree_node<T>* get_first_child() const {return child;}
+    tree_node<T>* get_last_child() const {return child == nullptr ? nullptr : child->prev;}
+    tree_node<T>* get_next_sibling() const {return next;}
+
+    /**
+     * @brief Returns the previous sibling [nullptr for a first child].
+     */
+    tree_node<T>* get_prev_sibling() const {return (parent == nullptr || parent->child == this) ? nullptr : prev;}
+};
+
+/*!
+ * @class generic_tree
+ * @brief Generic (n-ary) tree class.
+ *
+ * @details Every node is a tree_node, and all of them are carved out of a node_pool which belongs to the tree (an arena), so building a tree is mostly bumping a pointer in a big chunk,
+ * nodes that were added one after another sit next to each other, and clear() throws the chunks away as a whole instead of freeing every node [for trivially destructible types it doesn't even visit the nodes].
+ * The traversals use the parent and sibling pointers to find the next node, so they need no recursion and no stack. Level order only keeps the first child of every node of the next level.
+ *
+ * @fn emplace_root(Args&&... args)
+ * @fn emplace_back(tree_node<T>* parent, Args&&... args)
+ * @fn emplace_front(tree_node<T>* parent, Args&&... args)
+ * @fn emplace_after(tree_node<T>* sibling, Args&&... args)
+ * @fn erase(tree_node<T>* nd)
+ * @fn for_each_preorder(Visit visit)
+ * @fn for_each_postorder(Visit visit)
+ * @fn for_each_level_order(Visit visit)
+ * @fn clear()
+ * @tparam T typename
+ * @tparam ChunkSize Amount of nodes in a single chunk of the arena
+ */
+template <class T, std::size_t ChunkSize = 1024>
+class generic_tree {
+public:
+    using value_type = T;
+    using node_type = tree_node<T>;
+    using arena_type = node_pool<tree_node<T>, ChunkSize>;
+
+private:
+    using node_traits = std::allocator_traits<arena_type>;
+
+    std::optional<arena_type> arena;    /**< Every node of the tree comes from here [made by the first insert, so empty, cleared and moved-from trees don't own one]*/
+    tree_node<T>* root;                 /**< Root of the tree*/
+    std::size_t len;                    /**< Amount of nodes in the tree*/
+
+    template <class... Args>
+    tree_node<T>* create_node(Args&&... args);
+    void destroy_node(tree_node<T>* nd);
+
+    /**
+     * @brief Links a new node as a child of parent, right after the provided child [as the first child, if after is nullptr].
+     */
+    void link_child(tree_node<T>* parent, tree_node<T>* after, tree_node<T>* nd);
+
+    /**
+     * @brief Unlinks a node (with it's subtree) from it's parent and siblings.
+     */
+    void unlink(tree_node<T>* nd);
+
+    /**
+     * @brief Throws if the node is null.
+     */
+    static void check_node(const tree_node<T>* nd) {
+        if (nd == nullptr)
+            throw std::invalid_argument("Null tree node");
+    }
+
+public:
+    /**
+     * Creates an empty tree.
+     * @brief Default constructor.
+     */
+    generic_tree()
+        : arena{}, root{nullptr}, len{0} { }
+
+    /**
+     * Creates a deep copy of a tree, in it's own arena.
+     * @brief Copy constructor.
+     */
+    generic_tree(const generic_tree& tree);
+
+    /**
+     * Takes over the arena and the nodes of another tree, in O(1).
+     * @brief Move constructor.
+     */
+    generic_tree(generic_tree&& tree) noexcept
+        : arena{std::move(tree.arena)}, root{tree.root}, len{tree.len} {
+        tree.arena.reset();
+        tree.root = nullptr;
+        tree.len = 0;
+    }
+
+    generic_tree& operator=(generic_tree tree) noexcept {
+        swap(tree);
+        return *this;
+    }
+
+    ~generic_tree() {clear();}
+
+    void swap(generic_tree& tree) noexcept {
+        std::swap(arena, tree.arena);
+        std::swap(root, tree.root);
+        std::swap(len, tree.len);
+    }
+
+    tree_node<T>* get_root() const {return root;}
+    std::size_t size() const {return len;}
+    bool empty() const {return len == 0;}
+
+    /**
+     * @brief Creates the root of an empty tree.
+     * @throws std::invalid_argument if the tree already has a root.
+     */
+    template <class... Args>
+    tree_node<T>* emplace_root(Args&&... args);
+
+    /**
+     * @brief Adds a new last child to parent, in O(1).
+     * @throws std::invalid_argument if parent is null.
+     */
+    template <class... Args>
+    tree_node<T>* emplace_back(tree_node<T>* parent, Args&&... args) {
+        check_node(parent);
+        tree_node<T>* nd = create_node(std::forward<Args>(args)...);
+        link_child(parent, parent->get_last_child(), nd);
+        return nd;
+    }
+
+    /**
+     * @brief Adds a new first child to parent, in O(1).
+     * @throws std::invalid_argument if parent is null.
+     */
+    template <class... Args>
+    tree_node<T>* emplace_front(tree_node<T>* parent, Args&&... args) {
+        check_node(parent);
+        tree_node<T>* nd = create_node(std::forward<Args>(args)...);
+        link_child(parent, nullptr, nd);
+        return nd;
+    }
+
+    /**
+     * @brief Adds a new node right after sibling, under the same parent, in O(1).
+     * @throws std::invalid_argument if sibling is null or the root.
+     */
+    template <class... Args>
+    tree_node<T>* emplace_after(tree_node<T>* sibling, Args&&... args) {
+        check_node(sibling);
+        if (sibling->parent == nullptr)
+            throw std::invalid_argument("The root can't have siblings");
+        tree_node<T>* nd = create_node(std::forward<Args>(args)...);
+        link_child(sibling->parent, sibling, nd);
+        return nd;
+    }
+
+    tree_node<T>* push_back(tree_node<T>* parent, const T& dt) {return emplace_back(parent, dt);}
+    tree_node<T>* push_back(tree_node<T>* parent, T&& dt) {return emplace_back(parent, std::move(dt));}
+    tree_node<T>* push_front(tree_node<T>* parent, const T& dt) {return emplace_front(parent, dt);}
+    tree_node<T>* push_front(tree_node<T>* parent, T&& dt) {return emplace_front(parent, std::move(dt));}
+
+    /**
+     * @brief Removes a node and it's whole subtree. Their slots go back to the arena.
+     * @throws std::invalid_argument if nd is null.
+     */
+    void erase(tree_node<T>* nd);
+
+    /**
+     * @brief Removes every node, by dropping the whole arena.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the node after nd in pre-order, within the subtree of top [nullptr once the subtree is done].
+     */
+    static tree_node<T>* next_preorder(tree_node<T>* nd, const tree_node<T>* top = nullptr);
+
+    /**
+     * @brief Returns the first node of the subtree of nd in post-order [it's leftmost leaf].
+     */
+    static tree_node<T>* first_postorder(tree_node<T>* nd);
+
+    /**
+     * @brief Returns the node after nd in post-order, within the subtree of top [nullptr once the subtree is done].
+     */
+    static tree_node<T>* next_postorder(tree_node<T>* nd, const tree_node<T>* top = nullptr);
+
+    /**
+     * @brief Calls visit(node) for every node, parents before their children.
+     */
+    template <class Visit>
+    void for_each_preorder(Visit visit) const {
+        for (tree_node<T>* nd = root; nd != nullptr; nd = next_preorder(nd))
+            visit(nd);
+    }
+
+    /**
+     * @brief Calls visit(node) for every node, children before their parents.
+     */
+    template <class Visit>
+    void for_each_postorder(Visit visit) const {
+        for (tree_node<T>* nd = first_postorder(root); nd != nullptr; nd = next_postorder(nd))
+            visit(nd);
+    }
+
+    /**
+     * @brief Calls visit(node) for every node, one depth at a time.
+     */
+    template <class Visit>
+    void for_each_level_order(Visit visit) const;
+};
+
+template <class T, std::size_t ChunkSize>
+template <class... Args>
+tree_node<T>* generic_tree<T, ChunkSize>::create_node(Args&&... args) {
+    if (!arena)
+        arena.emplace();
+
+    tree_node<T>* nd = node_traits::allocate(*arena, 1);
+    try {
+        node_traits::construct(*arena, nd, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(*arena, nd, 1);
+        throw;
+    }
+    ++len;
+    return nd;
+}
+
+template <class T, std::size_t ChunkSize>
+void generic_tree<T, ChunkSize>::destroy_node(tree_node<T>* nd) {
+    node_traits::destroy(*arena, nd);
+    node_traits::deallocate(*arena, nd, 1);
+    --len;
+}
+
+template <class T, std::size_t ChunkSize>
+generic_tree<T, ChunkSize>::generic_tree(const generic_tree& tree)
+    : arena{}, root{nullptr}, len{0} {
+    if (tree.root == nullptr)
+        return;
+
+    // Walk the source in pre-order, and keep the copy of the current node alongside
+    try {
+        tree_node<T>* copy = emplace_root(tree.root->data);
+        const tree_node<T>* nd = tree.root;
+        while (true) {
+            if (nd->child != nullptr) {
+                nd = nd->child;
+                copy = emplace_back(copy, nd->data);
+                continue;
+            }
+            while (nd != tree.root && nd->next == nullptr) {
+                nd = nd->parent;
+                copy = copy->parent;
+            }
+            if (nd == tree.root)
+                break;
+            nd = nd->next;
+            copy = emplace_back(copy->parent, nd->data);
+        }
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <class T, std::size_t ChunkSize>
+template <class... Args>
+tree_node<T>* generic_tree<T, ChunkSize>::emplace_root(Args&&... args) {
+    if (root != nullptr)
+        throw std::invalid_argument("The tree already has a root");
+    root = create_node(std::forward<Args>(args)...);
+    return root;
+}
+
+template <class T, std::size_t ChunkSize>
+void generic_tree<T, ChunkSize>::link_child(tree_node<T>* parent, tree_node<T>* after, tree_node<T>* nd) {
+    nd->parent = parent;
+    tree_node<T>* first = parent->child;
+
+    if (first == nullptr) {
+        nd->next = nullptr;
+        nd->prev = nd;
+        parent->child = nd;
+    }
+    else if (after == nullptr) {
+        // New first child, which takes over the pointer to the last one
+        nd->next = first;
+        nd->prev = first->prev;
+        first->prev = nd;
+        parent->child = nd;
+    }
+    else {
+        nd->next = after->next;
+        nd->prev = after;
+        if (after->next != nullptr)
+            after->next->prev = nd;
+        else
+            first->prev = nd;
+        after->next = nd;
+    }
+}
+
+template <class T, std::size_t ChunkSize>
+void generic_tree<T, ChunkSize>::unlink(tree_node<T>* nd) {
+    tree_node<T>* parent = nd->parent;
+    if (parent == nullptr) {
+        root = nullptr;
+        return;
+    }
+
+    tree_node<T>* first = parent->child;
+    if (nd == first) {
+        parent->child = nd->next;
+        if (nd->next != nullptr)
+            nd->next->prev = nd->prev;
+    }
+    else {
+        nd->prev->next = nd->next;
+        if (nd->next != nullptr)
+            nd->next->prev = nd->prev;
+        else
+            first->prev = nd->prev;
+    }
+    nd->parent = nd->next = nullptr;
+    nd->prev = nd;
+}
+
+template <class T, std::size_t ChunkSize>
+void generic_tree<T, ChunkSize>::erase(tree_node<T>* nd) {
+    check_node(nd);
+    unlink(nd);
+
+    // Post-order, so a node is only freed once it's children are
+    tree_node<T>* current = first_postorder(nd);
+    while (current != nullptr) {
+        tree_node<T>* following = next_postorder(current, nd);
+        destroy_node(current);
+        current = following;
+    }
+}
+
+template <class T, std::size_t ChunkSize>
+void generic_tree<T, ChunkSize>::clear() {
+    if (root == nullptr)
+        return;
+
+    // The data has to be destroyed node by node, the memory doesn't. Post-order reads the links of a node before it's destroyed, and of it's parent only after
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        tree_node<T>* nd = first_postorder(root);
+        while (nd != nullptr) {
+            tree_node<T>* following = next_postorder(nd);
+            node_traits::destroy(*arena, nd);
+            nd = following;
+        }
+    }
+    // Dropping our share of the pool frees the chunks, a new one is only made by the next insert
+    arena.reset();
+    root = nullptr;
+    len = 0;
+}
+
+template <class T, std::size_t ChunkSize>
+tree_node<T>* generic_tree<T, ChunkSize>::next_preorder(tree_node<T>* nd, const tree_node<T>* top) {
+    if (nd->child != nullptr)
+        return nd->child;
+
+    // Climb until there's a next sibling, but never past top
+    while (nd != top && nd->next == nullptr)
+        nd = nd->parent;
+    return (nd == top || nd == nullptr) ? nullptr : nd->next;
+}
+
+template <class T, std::size_t ChunkSize>
+tree_node<T>* generic_tree<T, ChunkSize>::first_postorder(tree_node<T>* nd) {
+    if (nd == nullptr)
+        return nullptr;
+    while (nd->child != nullptr)
+        nd = nd->child;
+    return nd;
+}
+
+template <class T, std::size_t ChunkSize>
+tree_node<T>* generic_tree<T, ChunkSize>::next_postorder(tree_node<T>* nd, const tree_node<T>* top) {
+    if (nd == top)
+        return nullptr;
+    if (nd->next != nullptr)
+        return first_postorder(nd->next);
+    return nd->parent;
+}
+
+template <class T, std::size_t ChunkSize>
+template <class Visit>
+void generic_tree<T, ChunkSize>::for_each_level_order(Visit visit) const {
+    if (root == nullptr)
+        return;
+
+    // Every entry is a whole list of siblings, so the queues only hold one pointer per parent, and they're reused for every level
+    std::vector<tree_node<T>*> level{root};
+    std::vector<tree_node<T>*> next_level;
+    while (!level.empty()) {
+        next_level.clear();
+        for (tree_node<T>* first : level)
+            for (tree_node<T>* nd = first; nd != nullptr; nd = nd->next) {
+                visit(nd);
+                if (nd->child != nullptr)
+                    next_level.push_back(nd->child);
+            }
+        level.swap(next_level);
+    }
+}
+
+#endif // GENERIC_TREE_H
@@ -0,0 +1,494 @@
+/**
+ * @file graph.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a mutable graph builder, and a compact CSR graph with BFS, DFS, Dijkstra and a parallel BFS
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include "heap.hpp"
+#include "stack.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <class W>
+class graph;
+
+/*!
+ * @class graph_builder
+ * @brief Mutable directed graph class, stored as adjacency lists.
+ *
+ * @details Vertices are numbered 0 ... vertices() - 1. Edges can be added and removed in any order, and once the graph is done, freeze() packs it into a graph, which is what the traversals run on.
+ * An undirected edge is simply two directed ones.
+ *
+ * @fn add_vertex()
+ * @fn add_edge(vertex_type from, vertex_type to, const W& weight)
+ * @fn add_undirected_edge(vertex_type a, vertex_type b, const W& weight)
+ * @fn remove_edge(vertex_type from, vertex_type to)
+ * @fn freeze()
+ * @tparam W Type of the edge weights
+ */
+template <class W = std::uint32_t>
+class graph_builder {
+public:
+    using vertex_type = std::uint32_t;
+    using weight_type = W;
+
+private:
+    /**< An outgoing edge*/
+    struct edge {
+        vertex_type to;
+        W weight;
+    };
+
+    std::vector<std::vector<edge>> adjacency;   /**< Outgoing edges of every vertex, in the order they were added*/
+    std::size_t n_edges;                        /**< Amount of directed edges*/
+
+    friend class graph<W>;
+
+    void check_vertex(vertex_type v) const {
+        if (v >= adjacency.size())
+            throw std::out_of_range("Vertex out of range");
+    }
+
+public:
+    /**
+     * @brief Creates a builder with the provided amount of vertices, and no edges.
+     */
+    explicit graph_builder(std::size_t vertices = 0)
+        : adjacency(vertices), n_edges{0} { }
+
+    /**
+     * @brief Adds a vertex with no edges, and returns it's number.
+     * @throws std::length_error if the vertex wouldn't fit into vertex_type.
+     */
+    vertex_type add_vertex() {
+        if (adjacency.size() >= std::numeric_limits<vertex_type>::max())
+            throw std::length_error("Too many vertices");
+        adjacency.emplace_back();
+        return static_cast<vertex_type>(adjacency.size() - 1);
+    }
+
+    /**
+     * @brief Adds or removes vertices at the end, so that there are n of them. Edges to removed vertices are removed too.
+     */
+    void resize(std::size_t n);
+
+    /**
+     * @brief Adds an edge from -> to.
+     * @throws std::out_of_range if either vertex doesn't exist.
+     */
+    void add_edge(vertex_type from, vertex_type to, const W& weight = W(1)) {
+        check_vertex(from);
+        check_vertex(to);
+        adjacency[from].push_back(edge{to, weight});
+        ++n_edges;
+    }
+
+    /**
+     * @brief Adds the edges a -> b and b -> a.
+     * @throws std::out_of_range if either vertex doesn't exist.
+     */
+    void add_undirected_edge(vertex_type a, vertex_type b, const W& weight = W(1)) {
+        add_edge(a, b, weight);
+        add_edge(b, a, weight);
+    }
+
+    /**
+     * @brief Removes every edge from -> to.
+     * @return true if there was at least one.
+     * @throws std::out_of_range if either vertex doesn't exist.
+     */
+    bool remove_edge(vertex_type from, vertex_type to);
+
+    /**
+     * @brief Makes sure that the vertex has room for n outgoing edges.
+     */
+    void reserve_edges(vertex_type v, std::size_t n) {
+        check_vertex(v);
+        adjacency[v].reserve(n);
+    }
+
+    std::size_t vertices() const {return adjacency.size();}
+    std::size_t edges() const {return n_edges;}
+
+    /**
+     * @brief Packs the graph into a CSR graph. The builder is left as it was.
+     */
+    graph<W> freeze() const {return graph<W>(*this);}
+};
+
+/*!
+ * @class graph
+ * @brief Immutable directed graph class, stored in the compressed sparse row (CSR) format.
+ *
+ * @details The outgoing edges of vertex v are targets[offsets[v]] ... targets[offsets[v + 1] - 1] (and the same range of weights), so a whole graph is three flat arrays, and walking the neighbours of a vertex is a scan of contiguous memory,
+ * instead of a pointer chase per vertex like with a std::vector<std::vector<int>>. The incoming edges are stored the same way (without weights), since the bottom-up steps of parallel_bfs() need them.
+ *
+ * @fn bfs(vertex_type source)
+ * @fn parallel_bfs(vertex_type source, thread_pool& pool)
+ * @fn dfs(vertex_type source)
+ * @fn dijkstra(vertex_type source)
+ * @fn neighbours(vertex_type v)
+ * @tparam W Type of the edge weights
+ */
+template <class W = std::uint32_t>
+class graph {
+public:
+    using vertex_type = std::uint32_t;
+    using weight_type = W;
+
+    /**< Depth of a vertex which bfs() didn't reach*/
+    static constexpr vertex_type unreached = std::numeric_limits<vertex_type>::max();
+
+    /**< Range of the neighbours of a vertex*/
+    struct vertex_range {
+        const vertex_type* first;
+        const vertex_type* last;
+
+        const vertex_type* begin() const {return first;}
+        const vertex_type* end() const {return last;}
+        std::size_t size() const {return static_cast<std::size_t>(last - first);}
+    };
+
+private:
+    std::vector<std::size_t> offsets;       /**< Start of the outgoing edges of every vertex, plus the end of the last one*/
+    std::vector<vertex_type> targets;       /**< Target of every outgoing edge*/
+    std::vector<W> weights;                 /**< Weight of every outgoing edge*/
+    std::vector<std::size_t> in_offsets;    /**< Same as offsets, for the incoming edges*/
+    std::vector<vertex_type> sources;       /**< Source of every incoming edge*/
+
+    void check_vertex(vertex_type v) const {
+        if (v >= vertices())
+            throw std::out_of_range("Vertex out of range");
+    }
+
+    /**< Direction-optimizing BFS switches to bottom-up once the frontier has more than 1/alpha of the unexplored edges, and back once it has less than 1/beta of the vertices*/
+    static constexpr std::size_t bfs_alpha = 14;
+    static constexpr std::size_t bfs_beta = 24;
+
+public:
+    /**
+     * Creates a graph without vertices.
+     * @brief Default constructor.
+     */
+    graph()
+        : offsets(1, 0), targets{}, weights{}, in_offsets(1, 0), sources{} { }
+
+    /**
+     * Packs the adjacency lists of a builder.
+     * @brief Builder constructor.
+     */
+    explicit graph(const graph_builder<W>& builder);
+
+    std::size_t vertices() const {return offsets.size() - 1;}
+    std::size_t edges() const {return targets.size();}
+
+    std::size_t out_degree(vertex_type v) const {return offsets[v + 1] - offsets[v];}
+    std::size_t in_degree(vertex_type v) const {return in_offsets[v + 1] - in_offsets[v];}
+
+    /**
+     * @brief Returns the targets of the outgoing edges of v.
+     */
+    vertex_range neighbours(vertex_type v) const {
+        return vertex_range{targets.data() + offsets[v], targets.data() + offsets[v + 1]};
+    }
+
+    /**
+     * @brief Returns the sources of the incoming edges of v.
+     */
+    vertex_range in_neighbours(vertex_type v) const {
+        return vertex_range{sources.data() + in_offsets[v], sources.data() + in_offsets[v + 1]};
+    }
+
+    /**
+     * @brief Returns a pointer to the weights of the outgoing edges of v [in the same order as neighbours(v)].
+     */
+    const W* edge_weights(vertex_type v) const {return weights.data() + offsets[v];}
+
+    /**
+     * @brief Breadth-first search.
+     * @return The amount of edges on a shortest path from the source to every vertex [unreached if there is none].
+     * @throws std::out_of_range if the source doesn't exist.
+     */
+    std::vector<vertex_type> bfs(vertex_type source) const;
+
+    /**
+     * @brief Direction-optimizing breadth-first search, with every level spread over the threads of the pool.
+     * @details Small frontiers are expanded top-down (every frontier vertex claims it's unvisited neighbours), and big ones bottom-up (every unvisited vertex looks for a parent in the frontier among it's incoming edges, and stops at the first one),
+     * which skips most of the edges in the middle levels of low-diameter graphs.
+     * @return The same depths as bfs().
+     * @throws std::out_of_range if the source doesn't exist.
+     */
+    std::vector<vertex_type> parallel_bfs(vertex_type source, thread_pool& pool) const;
+
+    /**
+     * @brief Depth-first search, with an explicit stack, so deep graphs can't overflow the call stack.
+     * @return The vertices reachable from the source, in pre-order.
+     * @throws std::out_of_range if the source doesn't exist.
+     */
+    std::vector<vertex_type> dfs(vertex_type source) const;
+
+    /**
+     * @brief Dijkstra's shortest paths, on an indexed_heap.
+     * @return The length of a shortest path from the source to every vertex [std::numeric_limits<W>::max() if there is none, or if it's too long for W].
+     * @throws std::out_of_range if the source doesn't exist.
+     * @throws std::invalid_argument if a reachable edge has a negative weight.
+     */
+    std::vector<W> dijkstra(vertex_type source) const;
+};
+
+template <class W>
+void graph_builder<W>::resize(std::size_t n) {
+    if (n >= std::numeric_limits<vertex_type>::max())
+        throw std::length_error("Too many vertices");
+
+    // Drop the edges of the removed vertices, and the edges which point at them
+    for (std::size_t v = n; v < adjacency.size(); ++v)
+        n_edges -= adjacency[v].size();
+    adjacency.resize(n);
+
+    if (n_edges != 0) {
+        for (std::vector<edge>& list : adjacency) {
+            const std::size_t before = list.size();
+            list.erase(std::remove_if(list.begin(), list.end(), [n](const edge& e) {return e.to >= n;}), list.end());
+            n_edges -= before - list.size();
+        }
+    }
+}
+
+template <class W>
+bool graph_builder<W>::remove_edge(vertex_type from, vertex_type to) {
+    check_vertex(from);
+    check_vertex(to);
+
+    std::vector<edge>& list = adjacency[from];
+    const std::size_t before = list.size();
+    list.erase(std::remove_if(list.begin(), list.end(), [to](const edge& e) {return e.to == to;}), list.end());
+    n_edges -= before - list.size();
+    return list.size() != before;
+}
+
+template <class W>
+graph<W>::graph(const graph_builder<W>& builder)
+    : offsets(builder.vertices() + 1, 0), targets{}, weights{}, in_offsets(builder.vertices() + 1, 0), sources{} {
+    const std::size_t n = builder.vertices();
+    targets.reserve(builder.edges());
+    weights.reserve(builder.edges());
+
+    for (std::size_t v = 0; v < n; ++v) {
+        for (const auto& e : builder.adjacency[v]) {
+            targets.push_back(e.to);
+            weights.push_back(e.weight);
+            ++in_offsets[e.to + 1];
+        }
+        offsets[v + 1] = targets.size();
+    }
+
+    // The incoming edges are the outgoing ones, counting-sorted by target
+    for (std::size_t v = 0; v < n; ++v)
+        in_offsets[v + 1] += in_offsets[v];
+
+    sources.resize(targets.size());
+    std::vector<std::size_t> fill(in_offsets.begin(), in_offsets.end() - 1);
+    for (std::size_t v = 0; v < n; ++v)
+        for (std::size_t k = offsets[v]; k < offsets[v + 1]; ++k)
+            sources[fill[targets[k]]++] = static_cast<vertex_type>(v);
+}
+
+template <class W>
+std::vector<typename graph<W>::vertex_type> graph<W>::bfs(vertex_type source) const {
+    check_vertex(source);
+
+    // The result doubles as the visited set, and a plain vector as the queue, since every vertex goes in at most once
+    std::vector<vertex_type> depth(vertices(), unreached);
+    std::vector<vertex_type> order;
+    order.reserve(vertices());
+
+    depth[source] = 0;
+    order.push_back(source);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        const vertex_type v = order[head];
+        for (vertex_type u : neighbours(v)) {
+            if (depth[u] == unreached) {
+                depth[u] = depth[v] + 1;
+                order.push_back(u);
+            }
+        }
+    }
+    return depth;
+}
+
+template <class W>
+std::vector<typename graph<W>::vertex_type> graph<W>::parallel_bfs(vertex_type source, thread_pool& pool) const {
+    check_vertex(source);
+
+    const std::size_t n = vertices();
+    std::unique_ptr<std::atomic<vertex_type>[]> depth(new std::atomic<vertex_type>[n]);
+    for (std::size_t v = 0; v < n; ++v)
+        depth[v].store(unreached, std::memory_order_relaxed);
+    depth[source].store(0, std::memory_order_relaxed);
+
+    // Every chunk of a level writes the vertices it discovered into it's own buffer, so nothing is shared but the depths
+    constexpr std::size_t top_down_grain = 256;
+    constexpr std::size_t bottom_up_grain = 4096;
+    std::vector<std::vector<vertex_type>> found;
+
+    std::vector<vertex_type> frontier{source};
+    std::size_t frontier_edges = out_degree(source);
+    std::size_t unexplored_edges = edges() - frontier_edges;
+    bool bottom_up = false;
+
+    for (vertex_type level = 0; !frontier.empty(); ++level) {
+        // Pick the direction for this level
+        if (!bottom_up && frontier_edges > unexplored_edges / bfs_alpha)
+            bottom_up = true;
+        else if (bottom_up && frontier.size() < n / bfs_beta)
+            bottom_up = false;
+
+        const std::size_t grain = bottom_up ? bottom_up_grain : top_down_grain;
+        const std::size_t range = bottom_up ? n : frontier.size();
+        const std::size_t chunks = (range + grain - 1) / grain;
+        if (found.size() < chunks)
+            found.resize(chunks);
+
+        if (bottom_up) {
+            pool.parallel_for(0, n, grain, [&](std::size_t lo, std::size_t hi) {
+                std::vector<vertex_type>& out = found[lo / grain];
+                out.clear();
+                for (std::size_t v = lo; v < hi; ++v) {
+                    if (depth[v].load(std::memory_order_relaxed) != unreached)
+                        continue;
+                    // Any parent in the frontier will do, so stop at the first one
+                    for (vertex_type u : in_neighbours(static_cast<vertex_type>(v))) {
+                        if (depth[u].load(std::memory_order_relaxed) == level) {
+                            depth[v].store(level + 1, std::memory_order_relaxed);
+                            out.push_back(static_cast<vertex_type>(v));
+                            break;
+                        }
+                    }
+                }
+            });
+        }
+        else {
+            pool.parallel_for(0, frontier.size(), grain, [&](std::size_t lo, std::size_t hi) {
+                std::vector<vertex_type>& out = found[lo / grain];
+                out.clear();
+                for (std::size_t i = lo; i < hi; ++i) {
+                    for (vertex_type u : neighbours(frontier[i])) {
+                        // Cheap check first, the CAS decides which thread gets the vertex
+                        vertex_type expected = unreached;
+                        if (depth[u].load(std::memory_order_relaxed) == unreached &&
+                            depth[u].compare_exchange_strong(expected, level + 1, std::memory_order_relaxed))
+                            out.push_back(u);
+                    }
+                }
+            });
+        }
+
+        // Gather the next frontier, and the amount of edges it has
+        frontier.clear();
+        for (std::size_t c = 0; c < chunks; ++c)
+            frontier.insert(frontier.end(), found[c].begin(), found[c].end());
+
+        frontier_edges = 0;
+        for (vertex_type v : frontier)
+            frontier_edges += out_degree(v);
+        unexplored_edges -= std::min(unexplored_edges, frontier_edges);
+    }
+
+    // parallel_for() joins every level, so the relaxed stores are visible here
+    std::vector<vertex_type> result(n);
+    for (std::size_t v = 0; v < n; ++v)
+        result[v] = depth[v].load(std::memory_order_relaxed);
+    return result;
+}
+
+template <class W>
+std::vector<typename graph<W>::vertex_type> graph<W>::dfs(vertex_type source) const {
+    check_vertex(source);
+
+    std::vector<bool> visited(vertices(), false);
+    std::vector<vertex_type> order;
+
+    // Every stack entry is a vertex, and the next of it's edges to look at
+    stack<std::pair<vertex_type, std::size_t>> pending;
+    visited[source] = true;
+    order.push_back(source);
+    pending.push(std::make_pair(source, offsets[source]));
+
+    while (!pending.empty()) {
+        std::pair<vertex_type, std::size_t>& top = pending.top();
+        if (top.second == offsets[top.first + 1]) {
+            pending.pop();
+            continue;
+        }
+
+        const vertex_type u = targets[top.second++];
+        if (!visited[u]) {
+            visited[u] = true;
+            order.push_back(u);
+            pending.push(std::make_pair(u, offsets[u]));
+        }
+    }
+    return order;
+}
+
+template <class W>
+std::vector<W> graph<W>::dijkstra(vertex_type source) const {
+    check_vertex(source);
+
+    constexpr W infinity = std::numeric_limits<W>::max();
+    constexpr std::size_t not_queued = ~std::size_t{0};
+
+    std::vector<W> distance(vertices(), infinity);
+    std::vector<std::size_t> handle_of(vertices(), not_queued);
+    std::vector<bool> settled(vertices(), false);
+
+    // A min-heap of (distance, vertex), the handles let a vertex which is already queued get a shorter distance in place
+    indexed_heap<std::pair<W, vertex_type>, 4, std::greater<std::pair<W, vertex_type>>> queue;
+    distance[source] = W(0);
+    handle_of[source] = queue.push(std::make_pair(W(0), source));
+
+    while (!queue.empty()) {
+        const vertex_type v = queue.top().second;
+        queue.pop();
+        settled[v] = true;
+
+        const W* w = edge_weights(v);
+        for (std::size_t k = offsets[v]; k < offsets[v + 1]; ++k, ++w) {
+            if (std::numeric_limits<W>::is_signed && *w < W(0))
+                throw std::invalid_argument("Dijkstra's algorithm needs non-negative edge weights");
+
+            // A path which doesn't fit below infinity can't be stored [an unsigned W would even wrap around to a short one], so it's left out
+            const vertex_type u = targets[k];
+            if (settled[u] || *w >= infinity - distance[v])
+                continue;
+            const W candidate = distance[v] + *w;
+            if (!(candidate < distance[u]))
+                continue;
+
+            distance[u] = candidate;
+            if (handle_of[u] == not_queued)
+                handle_of[u] = queue.push(std::make_pair(candidate, u));
+            else
+                queue.decrease_key(handle_of[u], std::make_pair(candidate, u));
+        }
+    }
+    return distance;
+}
+
+#endif // GRAPH_H
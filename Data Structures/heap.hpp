@@ -0,0 +1,477 @@
+/**
+ * @file heap.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines d-ary heap (priority queue) classes, one of them with handles for decrease_key and erase
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/*!
+ * @class d_ary_heap
+ * @brief Array based d-ary heap class [priority queue].
+ *
+ * @details Every node has Arity children, and the whole heap is one contiguous array: the children of index i are at Arity * i + 1 ... Arity * i + Arity.
+ * A wider node makes the heap shallower (log_Arity(n) levels), so push touches fewer levels, and pop compares the children of a node within one or two cache lines. Arity 4 is usually the sweet spot.
+ * Like std::priority_queue, top() is the largest value according to Compare (pass std::greater<T> for a min-heap).
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn emplace(Args&&... args)
+ * @fn pop()
+ * @fn top()
+ * @fn assign(InputIt first, InputIt last)
+ * @fn size()
+ * @fn empty()
+ * @fn clear()
+ * @tparam T typename
+ * @tparam Arity Amount of children of every node [at least 2]
+ * @tparam Compare Ordering, the value for which Compare says nothing is larger is on the top
+ * @tparam Alloc Allocator used for the array
+ */
+template <class T, std::size_t Arity = 4, class Compare = std::less<T>, class Alloc = std::allocator<T>>
+class d_ary_heap {
+    static_assert(Arity >= 2, "a heap node needs at least 2 children");
+
+private:
+    std::vector<T, Alloc> items;   /**< The heap, in level order*/
+    Compare comp;                  /**< Ordering of the values*/
+
+    /**
+     * @brief Moves the value at index i up, until it's parent isn't smaller.
+     */
+    void sift_up(std::size_t i);
+
+    /**
+     * @brief Moves the value at index i down, until none of it's children is larger.
+     */
+    void sift_down(std::size_t i);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using value_compare = Compare;
+
+    /**
+     * Creates an empty heap.
+     * @brief Default constructor.
+     */
+    explicit d_ary_heap(const Compare& compare = Compare())
+        : items{}, comp{compare} { }
+
+    /**
+     * Creates a heap out of the values in [first, last), in O(n) (see assign()).
+     * @brief Range constructor.
+     */
+    template <class InputIt>
+    d_ary_heap(InputIt first, InputIt last, const Compare& compare = Compare())
+        : items{}, comp{compare} {
+        assign(first, last);
+    }
+
+    /**
+     * @brief Inserts a value into the heap, in O(log_Arity(n)).
+     * @param dt Data to insert.
+     */
+    void push(const T& dt) {emplace(dt);}
+    void push(T&& dt) {emplace(std::move(dt));}
+
+    /**
+     * @brief Constructs a value in place, and inserts it into the heap.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <class... Args>
+    void emplace(Args&&... args) {
+        items.emplace_back(std::forward<Args>(args)...);
+        sift_up(items.size() - 1);
+    }
+
+    /**
+     * @brief Removes the value on the top of the heap, in O(Arity * log_Arity(n)).
+     * @note The heap must not be empty.
+     */
+    void pop();
+
+    /**
+     * @brief Returns the largest value.
+     * @note The heap must not be empty.
+     */
+    const T& top() const {return items.front();}
+
+    /**
+     * @brief Replaces the contents of the heap with the values in [first, last).
+     * @details Copies the values first, and then sifts down every inner node from the bottom up [Floyd's construction], which is O(n) rather than the O(n log n) of n pushes.
+     * @param first Iterator to the first value.
+     * @param last Iterator past the last value.
+     */
+    template <class InputIt>
+    void assign(InputIt first, InputIt last);
+
+    /**
+     * @brief Makes sure that n values fit without reallocating.
+     */
+    void reserve(std::size_t n) {items.reserve(n);}
+
+    std::size_t size() const {return items.size();}
+    bool empty() const {return items.empty();}
+    void clear() {items.clear();}
+};
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void d_ary_heap<T, Arity, Compare, Alloc>::sift_up(std::size_t i) {
+    // Carry the value up, and shift the smaller parents down into the hole it leaves
+    T moving = std::move(items[i]);
+    while (i > 0) {
+        const std::size_t parent = (i - 1) / Arity;
+        if (!comp(items[parent], moving))
+            break;
+        items[i] = std::move(items[parent]);
+        i = parent;
+    }
+    items[i] = std::move(moving);
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void d_ary_heap<T, Arity, Compare, Alloc>::sift_down(std::size_t i) {
+    const std::size_t n = items.size();
+    T moving = std::move(items[i]);
+
+    while (true) {
+        const std::size_t first_child = Arity * i + 1;
+        if (first_child >= n)
+            break;
+
+        // Find the largest child, the children sit next to each other
+        const std::size_t last_child = (first_child + Arity < n) ? first_child + Arity : n;
+        std::size_t best = first_child;
+        for (std::size_t child = first_child + 1; child < last_child; ++child)
+            if (comp(items[best], items[child]))
+                best = child;
+
+        if (!comp(moving, items[best]))
+            break;
+        items[i] = std::move(items[best]);
+        i = best;
+    }
+    items[i] = std::move(moving);
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void d_ary_heap<T, Arity, Compare, Alloc>::pop() {
+    // The last value fills the hole at the top, and sinks to where it belongs
+    if (items.size() > 1) {
+        items.front() = std::move(items.back());
+        items.pop_back();
+        sift_down(0);
+    }
+    else
+        items.pop_back();
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+template <class InputIt>
+void d_ary_heap<T, Arity, Compare, Alloc>::assign(InputIt first, InputIt last) {
+    items.assign(first, last);
+    if (items.size() < 2)
+        return;
+
+    // Leaves are heaps already, so start from the last node which has a child
+    for (std::size_t i = (items.size() - 2) / Arity + 1; i-- > 0; )
+        sift_down(i);
+}
+
+/*!
+ * @class indexed_heap
+ * @brief d-ary heap class, which hands out a handle for every value, so values can be changed or removed while they're in the heap.
+ *
+ * @details The heap array holds the values (next to their handles, so comparisons don't leave the array), and a second array maps every handle to it's current index in the heap.
+ * decrease_key(), update() and erase() find the value through that map in O(1), and then sift it in O(log_Arity(n)), which is what Dijkstra and other label-correcting algorithms need.
+ * Handles of popped or erased values are recycled by later pushes.
+ * Like std::priority_queue, top() is the largest value according to Compare (pass std::greater<T> for a min-heap, where decrease_key() really decreases the value).
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn pop()
+ * @fn top()
+ * @fn top_handle()
+ * @fn decrease_key(handle h, const T& dt)
+ * @fn update(handle h, const T& dt)
+ * @fn erase(handle h)
+ * @fn contains(handle h)
+ * @fn get(handle h)
+ * @fn get_allocator()
+ * @tparam T typename
+ * @tparam Arity Amount of children of every node [at least 2]
+ * @tparam Compare Ordering, the value for which Compare says nothing is larger is on the top
+ * @tparam Alloc Allocator used for the arrays, rebound to their element types
+ */
+template <class T, std::size_t Arity = 4, class Compare = std::less<T>, class Alloc = std::allocator<T>>
+class indexed_heap {
+    static_assert(Arity >= 2, "a heap node needs at least 2 children");
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using value_compare = Compare;
+    using handle = std::size_t;
+
+private:
+    static constexpr std::size_t npos = ~std::size_t{0};   /**< Position of a handle which isn't in the heap*/
+
+    /**< A value, and the handle it was pushed with*/
+    struct entry {
+        T value;
+        handle id;
+    };
+
+    template <class U>
+    using rebind_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+
+    std::vector<entry, rebind_alloc<entry>> items;                  /**< The heap, in level order*/
+    std::vector<std::size_t, rebind_alloc<std::size_t>> position;   /**< Index of every handle in items [npos if it's not in the heap]*/
+    std::vector<handle, rebind_alloc<handle>> free_handles;         /**< Handles which can be handed out again*/
+    Compare comp;                                                   /**< Ordering of the values*/
+
+    /**
+     * @brief Puts the entry at index i, and records where it's handle went.
+     */
+    void place(std::size_t i, entry&& e) {
+        position[e.id] = i;
+        items[i] = std::move(e);
+    }
+
+    void sift_up(std::size_t i);
+    void sift_down(std::size_t i);
+
+    /**
+     * @brief Removes the entry at index i, and fills the hole with the last entry.
+     */
+    void remove_at(std::size_t i);
+
+    /**
+     * @brief Returns the index of a handle, which has to be in the heap.
+     */
+    std::size_t index_of(handle h) const;
+
+public:
+    /**
+     * Creates an empty heap.
+     * @brief Default constructor.
+     */
+    explicit indexed_heap(const Compare& compare = Compare(), const Alloc& allocator = Alloc())
+        : items(rebind_alloc<entry>(allocator)), position(rebind_alloc<std::size_t>(allocator)),
+          free_handles(rebind_alloc<handle>(allocator)), comp{compare} { }
+
+    /**
+     * @brief Inserts a value into the heap, in O(log_Arity(n)).
+     * @param dt Data to insert.
+     * @return Handle, which refers to the value until it is popped or erased.
+     */
+    handle push(const T& dt) {return emplace(dt);}
+    handle push(T&& dt) {return emplace(std::move(dt));}
+
+    /**
+     * @brief Constructs a value in place, and inserts it into the heap.
+     * @param args Arguments forwarded to T's constructor.
+     * @return Handle of the new value.
+     */
+    template <class... Args>
+    handle emplace(Args&&... args);
+
+    /**
+     * @brief Removes the value on the top of the heap. It's handle becomes free.
+     * @note The heap must not be empty.
+     */
+    void pop() {remove_at(0);}
+
+    /**
+     * @brief Returns the largest value.
+     * @note The heap must not be empty.
+     */
+    const T& top() const {return items.front().value;}
+
+    /**
+     * @brief Returns the handle of the largest value.
+     * @note The heap must not be empty.
+     */
+    handle top_handle() const {return items.front().id;}
+
+    /**
+     * @brief Moves a value towards the top, by replacing it with one that ranks at least as high [a smaller one, in a std::greater min-heap].
+     * @param h Handle of the value.
+     * @param dt The new value.
+     * @throws std::invalid_argument if the handle isn't in the heap, or if the new value ranks lower than the old one (use update() for that).
+     */
+    void decrease_key(handle h, const T& dt);
+
+    /**
+     * @brief Replaces a value, and moves it whichever way it has to go.
+     * @param h Handle of the value.
+     * @param dt The new value.
+     * @throws std::invalid_argument if the handle isn't in the heap.
+     */
+    void update(handle h, const T& dt);
+
+    /**
+     * @brief Removes a value from anywhere in the heap. It's handle becomes free.
+     * @param h Handle of the value.
+     * @throws std::invalid_argument if the handle isn't in the heap.
+     */
+    void erase(handle h) {remove_at(index_of(h));}
+
+    /**
+     * @brief Returns true if the handle refers to a value which is in the heap.
+     */
+    bool contains(handle h) const {return h < position.size() && position[h] != npos;}
+
+    /**
+     * @brief Returns the value which the handle refers to.
+     * @throws std::invalid_argument if the handle isn't in the heap.
+     */
+    const T& get(handle h) const {return items[index_of(h)].value;}
+
+    /**
+     * @brief Makes sure that n values fit without reallocating.
+     */
+    void reserve(std::size_t n) {
+        items.reserve(n);
+        position.reserve(n);
+    }
+
+    std::size_t size() const {return items.size();}
+    bool empty() const {return items.empty();}
+
+    /**
+     * @brief Returns a copy of the allocator, rebound back to T.
+     */
+    allocator_type get_allocator() const {return allocator_type(items.get_allocator());}
+
+    /**
+     * @brief Removes every value. Every handle becomes free.
+     */
+    void clear() {
+        items.clear();
+        position.clear();
+        free_handles.clear();
+    }
+};
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+std::size_t indexed_heap<T, Arity, Compare, Alloc>::index_of(handle h) const {
+    if (!contains(h))
+        throw std::invalid_argument("The handle doesn't refer to a value in the heap");
+    return position[h];
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void indexed_heap<T, Arity, Compare, Alloc>::sift_up(std::size_t i) {
+    entry moving = std::move(items[i]);
+    while (i > 0) {
+        const std::size_t parent = (i - 1) / Arity;
+        if (!comp(items[parent].value, moving.value))
+            break;
+        place(i, std::move(items[parent]));
+        i = parent;
+    }
+    place(i, std::move(moving));
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void indexed_heap<T, Arity, Compare, Alloc>::sift_down(std::size_t i) {
+    const std::size_t n = items.size();
+    entry moving = std::move(items[i]);
+
+    while (true) {
+        const std::size_t first_child = Arity * i + 1;
+        if (first_child >= n)
+            break;
+
+        const std::size_t last_child = (first_child + Arity < n) ? first_child + Arity : n;
+        std::size_t best = first_child;
+        for (std::size_t child = first_child + 1; child < last_child; ++child)
+            if (comp(items[best].value, items[child].value))
+                best = child;
+
+        if (!comp(moving.value, items[best].value))
+            break;
+        place(i, std::move(items[best]));
+        i = best;
+    }
+    place(i, std::move(moving));
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+template <class... Args>
+typename indexed_heap<T, Arity, Compare, Alloc>::handle indexed_heap<T, Arity, Compare, Alloc>::emplace(Args&&... args) {
+    // Reuse a free handle, or make a new one
+    handle h;
+    if (!free_handles.empty()) {
+        h = free_handles.back();
+        free_handles.pop_back();
+    }
+    else {
+        h = position.size();
+        position.push_back(npos);
+    }
+
+    items.push_back(entry{T(std::forward<Args>(args)...), h});
+    position[h] = items.size() - 1;
+    sift_up(items.size() - 1);
+    return h;
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void indexed_heap<T, Arity, Compare, Alloc>::remove_at(std::size_t i) {
+    const handle removed = items[i].id;
+    const std::size_t last = items.size() - 1;
+
+    // The last entry fills the hole, and may have to go either way from there
+    if (i != last) {
+        place(i, std::move(items[last]));
+        items.pop_back();
+        if (i > 0 && comp(items[(i - 1) / Arity].value, items[i].value))
+            sift_up(i);
+        else
+            sift_down(i);
+    }
+    else
+        items.pop_back();
+
+    position[removed] = npos;
+    free_handles.push_back(removed);
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void indexed_heap<T, Arity, Compare, Alloc>::decrease_key(handle h, const T& dt) {
+    const std::size_t i = index_of(h);
+    if (comp(dt, items[i].value))
+        throw std::invalid_argument("decrease_key() can only move a value towards the top");
+
+    items[i].value = dt;
+    sift_up(i);
+}
+
+template <class T, std::size_t Arity, class Compare, class Alloc>
+void indexed_heap<T, Arity, Compare, Alloc>::update(handle h, const T& dt) {
+    const std::size_t i = index_of(h);
+    const bool rises = comp(items[i].value, dt);
+
+    items[i].value = dt;
+    if (rises)
+        sift_up(i);
+    else
+        sift_down(i);
+}
+
+#endif // HEAP_H
@@ -0,0 +1,291 @@
+/**
+ * @file kd_tree.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a bulk built K-dimensional tree, stored as a flat implicit array, with nearest neighbour and radius queries
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include "heap.hpp"
+#include "stack.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/*!
+ * @class kd_tree
+ * @brief K-dimensional tree class, for nearest neighbour and radius searches over a fixed set of points.
+ *
+ * @details The points are built in bulk: a range is split at it's median (std::nth_element) along the dimension in which it's points are spread out the most, and both halves are split again, down to small leaves.
+ * There are no nodes: the node of a range [lo, hi) is simply the point in the middle of it, and it's children are the ranges on either side, so the tree is one array of points, plus the split dimension of every node.
+ * Searches walk it with an explicit stack, nearest side first, and skip every range that's further away than the best results so far.
+ *
+ * @fn k_nearest(const point_type& query, std::size_t k)
+ * @fn nearest(const point_type& query)
+ * @fn within_radius(const point_type& query, distance_type radius)
+ * @fn build(InputIt first, InputIt last)
+ * @tparam T Type of the coordinates
+ * @tparam K Amount of dimensions
+ */
+template <class T, std::size_t K>
+class kd_tree {
+    static_assert(K >= 1, "a point needs at least one dimension");
+    static_assert(K <= 255, "the split dimension is stored in a byte");
+
+public:
+    using point_type = std::array<T, K>;
+
+    /**< Type of squared distances [double for integer coordinates, so they can't overflow]*/
+    using distance_type = std::conditional_t<std::is_floating_point<T>::value, T, double>;
+
+    /**< A search result*/
+    struct neighbour {
+        std::size_t index;          /**< Index of the point, in the order it was given to build()*/
+        distance_type distance;     /**< Squared euclidean distance to the query*/
+    };
+
+private:
+    /**< Ranges of at most this many points aren't split any further, and are scanned instead*/
+    static constexpr std::size_t leaf_size = 8;
+
+    /**< Limit of a search that takes every point [infinity, where it exists, so even a squared distance that overflowed is within it]*/
+    static constexpr distance_type unbounded = std::numeric_limits<distance_type>::has_infinity
+        ? std::numeric_limits<distance_type>::infinity() : std::numeric_limits<distance_type>::max();
+
+    std::vector<point_type> points;         /**< The points, in tree order*/
+    std::vector<std::size_t> ids;           /**< Original index of every point*/
+    std::vector<std::uint8_t> split;        /**< Split dimension of the node in the middle of every range*/
+
+    /**< A range to search, and a lower bound on the squared distance from the query to it*/
+    struct pending_range {
+        std::size_t lo;
+        std::size_t hi;
+        distance_type bound;
+    };
+
+    /**< Orders neighbours by distance, so a d_ary_heap of them has the furthest one on the top*/
+    struct closer {
+        bool operator()(const neighbour& a, const neighbour& b) const {return a.distance < b.distance;}
+    };
+
+    /**
+     * @brief Orders the ids of [lo, hi) into a subtree.
+     */
+    void build_range(std::size_t lo, std::size_t hi);
+
+    /**
+     * @brief Walks the tree, calling visit(i, distance) for every point which isn't further than limit(), nearest ranges first.
+     */
+    template <class Visit, class Limit>
+    void search(const point_type& query, Visit visit, Limit limit) const;
+
+    static distance_type squared_distance(const point_type& a, const point_type& b) {
+        distance_type total = distance_type(0);
+        for (std::size_t d = 0; d < K; ++d) {
+            const distance_type diff = static_cast<distance_type>(a[d]) - static_cast<distance_type>(b[d]);
+            total += diff * diff;
+        }
+        return total;
+    }
+
+public:
+    /**
+     * Creates an empty tree.
+     * @brief Default constructor.
+     */
+    kd_tree()
+        : points{}, ids{}, split{} { }
+
+    /**
+     * Builds a tree of the points in [first, last).
+     * @brief Range constructor.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    kd_tree(InputIt first, InputIt last)
+        : points{}, ids{}, split{} { build(first, last); }
+
+    /**
+     * Builds a tree of the points in a vector.
+     * @brief Vector constructor.
+     */
+    explicit kd_tree(const std::vector<point_type>& pts)
+        : kd_tree(pts.begin(), pts.end()) { }
+
+    /**
+     * @brief Replaces the points of the tree with the ones in [first, last), in O(n log n).
+     */
+    template <class InputIt>
+    void build(InputIt first, InputIt last);
+
+    std::size_t size() const {return points.size();}
+    bool empty() const {return points.empty();}
+
+    /**
+     * @brief Returns the k points closest to the query, closest first [less, if the tree has less than k points].
+     */
+    std::vector<neighbour> k_nearest(const point_type& query, std::size_t k) const;
+
+    /**
+     * @brief Returns the point closest to the query.
+     * @throws std::out_of_range if the tree is empty.
+     */
+    neighbour nearest(const point_type& query) const;
+
+    /**
+     * @brief Returns every point at most radius away from the query, in no particular order.
+     */
+    std::vector<neighbour> within_radius(const point_type& query, distance_type radius) const;
+};
+
+template <class T, std::size_t K>
+template <class InputIt>
+void kd_tree<T, K>::build(InputIt first, InputIt last) {
+    points.assign(first, last);
+    ids.resize(points.size());
+    for (std::size_t i = 0; i < ids.size(); ++i)
+        ids[i] = i;
+    split.assign(points.size(), 0);
+
+    // Until the points are reordered, build_range() reads them through ids
+    build_range(0, points.size());
+
+    std::vector<point_type> ordered(points.size());
+    for (std::size_t i = 0; i < ids.size(); ++i)
+        ordered[i] = points[ids[i]];
+    points.swap(ordered);
+}
+
+template <class T, std::size_t K>
+void kd_tree<T, K>::build_range(std::size_t lo, std::size_t hi) {
+    // The depth is only log(n / leaf_size), so recursing is fine here
+    if (hi - lo <= leaf_size)
+        return;
+
+    // Split along the dimension with the biggest spread
+    point_type low = points[ids[lo]];
+    point_type high = low;
+    for (std::size_t i = lo + 1; i < hi; ++i)
+        for (std::size_t d = 0; d < K; ++d) {
+            low[d] = std::min(low[d], points[ids[i]][d]);
+            high[d] = std::max(high[d], points[ids[i]][d]);
+        }
+
+    std::size_t dim = 0;
+    for (std::size_t d = 1; d < K; ++d)
+        if (static_cast<distance_type>(high[d]) - low[d] > static_cast<distance_type>(high[dim]) - low[dim])
+            dim = d;
+
+    // Only the ids move while building, the points are put in order once at the end
+    const std::size_t mid = lo + (hi - lo) / 2;
+    std::nth_element(ids.begin() + lo, ids.begin() + mid, ids.begin() + hi,
+                     [&](std::size_t a, std::size_t b) {return points[a][dim] < points[b][dim];});
+
+    split[mid] = static_cast<std::uint8_t>(dim);
+    build_range(lo, mid);
+    build_range(mid + 1, hi);
+}
+
+template <class T, std::size_t K>
+template <class Visit, class Limit>
+void kd_tree<T, K>::search(const point_type& query, Visit visit, Limit limit) const {
+    if (points.empty())
+        return;
+
+    small_stack<pending_range, 64> pending;
+    pending.push(pending_range{0, points.size(), distance_type(0)});
+
+    while (!pending.empty()) {
+        const pending_range range = pending.top();
+        pending.pop();
+
+        // The results got better since this range was pushed
+        if (range.bound > limit())
+            continue;
+
+        if (range.hi - range.lo <= leaf_size) {
+            for (std::size_t i = range.lo; i < range.hi; ++i) {
+                const distance_type dist = squared_distance(query, points[i]);
+                if (dist <= limit())
+                    visit(i, dist);
+            }
+            continue;
+        }
+
+        const std::size_t mid = range.lo + (range.hi - range.lo) / 2;
+        const std::size_t dim = split[mid];
+        const distance_type dist = squared_distance(query, points[mid]);
+        if (dist <= limit())
+            visit(mid, dist);
+
+        // The far side is at least as far as the splitting plane, the near side goes on top, so it's searched first
+        const distance_type plane = static_cast<distance_type>(query[dim]) - static_cast<distance_type>(points[mid][dim]);
+        const distance_type far_bound = std::max(range.bound, plane * plane);
+        if (plane < distance_type(0)) {
+            pending.push(pending_range{mid + 1, range.hi, far_bound});
+            pending.push(pending_range{range.lo, mid, range.bound});
+        }
+        else {
+            pending.push(pending_range{range.lo, mid, far_bound});
+            pending.push(pending_range{mid + 1, range.hi, range.bound});
+        }
+    }
+}
+
+template <class T, std::size_t K>
+std::vector<typename kd_tree<T, K>::neighbour> kd_tree<T, K>::k_nearest(const point_type& query, std::size_t k) const {
+    std::vector<neighbour> result;
+    if (k == 0)
+        return result;
+
+    // A max-heap of the best k so far, so the one to throw out is on the top
+    d_ary_heap<neighbour, 4, closer> best;
+    best.reserve(std::min(k, points.size()) + 1);
+
+    search(query,
+           [&](std::size_t i, distance_type dist) {
+               if (best.size() == k) {
+                   if (!(dist < best.top().distance))
+                       return;
+                   best.pop();
+               }
+               best.push(neighbour{ids[i], dist});
+           },
+           [&] {return best.size() < k ? unbounded : best.top().distance;});
+
+    result.resize(best.size());
+    for (std::size_t i = result.size(); i-- > 0; best.pop())
+        result[i] = best.top();
+    return result;
+}
+
+template <class T, std::size_t K>
+typename kd_tree<T, K>::neighbour kd_tree<T, K>::nearest(const point_type& query) const {
+    if (points.empty())
+        throw std::out_of_range("nearest() called on an empty kd_tree");
+    return k_nearest(query, 1).front();
+}
+
+template <class T, std::size_t K>
+std::vector<typename kd_tree<T, K>::neighbour> kd_tree<T, K>::within_radius(const point_type& query, distance_type radius) const {
+    std::vector<neighbour> result;
+    if (radius < distance_type(0))
+        return result;
+
+    const distance_type limit = radius * radius;
+    search(query,
+           [&](std::size_t i, distance_type dist) {result.push_back(neighbour{ids[i], dist});},
+           [limit] {return limit;});
+    return result;
+}
+
+#endif // KD_TREE_H
@@ -0,0 +1,900 @@
+/**
+ * @file matrix.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a dense, row-major matrix class with a cache-blocked SIMD multiplication and expression templates
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*!
+ * @class aligned_allocator
+ * @brief Allocator which aligns every allocation to Align bytes.
+ *
+ * @details Used by matrix, so that every row starts on a cache line [and on a SIMD register boundary].
+ * @tparam T typename
+ * @tparam Align Alignment in bytes [a power of two]
+ */
+template <class T, std::size_t Align = 64>
+struct aligned_allocator {
+    static_assert((Align & (Align - 1)) == 0, "alignment must be a power of two");
+
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = aligned_allocator<U, Align>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template <class U>
+    aligned_allocator(const aligned_allocator<U, Align>&) noexcept { }
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+
+    template <class U>
+    bool operator==(const aligned_allocator<U, Align>&) const noexcept {return true;}
+
+    template <class U>
+    bool operator!=(const aligned_allocator<U, Align>&) const noexcept {return false;}
+};
+
+/*!
+ * @class matrix_simd
+ * @brief The widest SIMD register the compiler was told it may use, for the element type T.
+ *
+ * @details AVX2 (with FMA if available) or SSE2 is picked at compile time for float and double, and every other type (or a build without either) falls back to scalar code of width 1.
+ * The matrix kernels are written once against load(), store(), broadcast() and fmadd() [a * b + c].
+ * @tparam T typename
+ */
+template <class T>
+struct matrix_simd {
+    using reg = T;
+    static constexpr std::size_t width = 1;
+
+    static reg load(const T* p) {return *p;}
+    static void store(T* p, reg r) {*p = r;}
+    static reg broadcast(T v) {return v;}
+    static reg fmadd(reg a, reg b, reg c) {return a * b + c;}
+};
+
+#if defined(__AVX2__)
+template <>
+struct matrix_simd<float> {
+    using reg = __m256;
+    static constexpr std::size_t width = 8;
+
+    static reg load(const float* p) {return _mm256_loadu_ps(p);}
+    static void store(float* p, reg r) {_mm256_storeu_ps(p, r);}
+    static reg broadcast(float v) {return _mm256_set1_ps(v);}
+#if defined(__FMA__)
+    static reg fmadd(reg a, reg b, reg c) {return _mm256_fmadd_ps(a, b, c);}
+#else
+    static reg fmadd(reg a, reg b, reg c) {return _mm256_add_ps(_mm256_mul_ps(a, b), c);}
+#endif
+};
+
+template <>
+struct matrix_simd<double> {
+    using reg = __m256d;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const double* p) {return _mm256_loadu_pd(p);}
+    static void store(double* p, reg r) {_mm256_storeu_pd(p, r);}
+    static reg broadcast(double v) {return _mm256_set1_pd(v);}
+#if defined(__FMA__)
+    static reg fmadd(reg a, reg b, reg c) {return _mm256_fmadd_pd(a, b, c);}
+#else
+    static reg fmadd(reg a, reg b, reg c) {return _mm256_add_pd(_mm256_mul_pd(a, b), c);}
+#endif
+};
+#elif defined(__SSE2__)
+template <>
+struct matrix_simd<float> {
+    using reg = __m128;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const float* p) {return _mm_loadu_ps(p);}
+    static void store(float* p, reg r) {_mm_storeu_ps(p, r);}
+    static reg broadcast(float v) {return _mm_set1_ps(v);}
+    static reg fmadd(reg a, reg b, reg c) {return _mm_add_ps(_mm_mul_ps(a, b), c);}
+};
+
+template <>
+struct matrix_simd<double> {
+    using reg = __m128d;
+    static constexpr std::size_t width = 2;
+
+    static reg load(const double* p) {return _mm_loadu_pd(p);}
+    static void store(double* p, reg r) {_mm_storeu_pd(p, r);}
+    static reg broadcast(double v) {return _mm_set1_pd(v);}
+    static reg fmadd(reg a, reg b, reg c) {return _mm_add_pd(_mm_mul_pd(a, b), c);}
+};
+#endif
+
+template <class T, class Alloc>
+class matrix;
+
+/*!
+ * @class matrix_expr
+ * @brief Base class of every matrix expression [CRTP].
+ *
+ * @details Operators on matrices don't compute anything, they build a small tree of expression objects instead. The tree is only evaluated once it is assigned to a matrix,
+ * and every node evaluates itself straight into the destination: assign_to(dst) overwrites dst, and add_to(dst, factor) adds factor times the result to dst.
+ * That way `D = A * B + C` runs one multiplication that writes into D, and one pass that adds C, without any temporary matrices.
+ *
+ * @note Expressions hold references to the matrices they were built from, so they should be assigned right away, not stored.
+ * @tparam E The derived expression type
+ */
+template <class E>
+struct matrix_expr {
+    const E& self() const {return static_cast<const E&>(*this);}
+
+    std::size_t rows() const {return self().rows();}
+    std::size_t cols() const {return self().cols();}
+};
+
+/**< How an operand is held inside an expression: matrices by reference, other expressions by value*/
+template <class E>
+struct matrix_operand {
+    using type = const E;
+};
+
+template <class T, class Alloc>
+struct matrix_operand<matrix<T, Alloc>> {
+    using type = const matrix<T, Alloc>&;
+};
+
+/*!
+ * @class matrix
+ * @brief Dense Matrix class.
+ *
+ * @details A row-major matrix, whose rows are padded to whole cache lines, and start on a 64 byte boundary. Elements are stored contiguously within a row, and row r starts at data() + r * stride().
+ * Multiplication is cache-blocked (see gemm()), with a register-blocked SIMD kernel, and +, - and * build expressions (see matrix_expr), which are evaluated without temporaries.
+ *
+ * @fn operator()(std::size_t r, std::size_t c)
+ * @fn rows()
+ * @fn cols()
+ * @fn stride()
+ * @fn data()
+ * @fn fill(const T& value)
+ * @fn identity(std::size_t n)
+ * @fn gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c)
+ * @fn gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c, thread_pool& pool)
+ * @fn transpose()
+ * @fn transpose(thread_pool& pool)
+ * @tparam T typename [arithmetic]
+ * @tparam Alloc Allocator used for the elements [64 byte aligned by default]
+ */
+template <class T, class Alloc = aligned_allocator<T, 64>>
+class matrix : public matrix_expr<matrix<T, Alloc>> {
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+    using simd = matrix_simd<T>;
+
+    static constexpr std::size_t row_pad = (64 % sizeof(T) == 0) ? 64 / sizeof(T) : 1;  /**< Rows are padded to a multiple of this many elements*/
+
+    static constexpr std::size_t block_rows = 64;     /**< Rows of A (and C) which are worked on at once*/
+    static constexpr std::size_t block_depth = 128;   /**< Columns of A (and rows of B) which are worked on at once*/
+    static constexpr std::size_t block_cols = 256;    /**< Columns of B (and C) which are worked on at once*/
+    static constexpr std::size_t transpose_tile = 32; /**< Side of the square tiles, which are transposed at once*/
+
+    Alloc alloc;            /**< Allocator which owns the elements*/
+    std::size_t n_rows;     /**< Amount of rows*/
+    std::size_t n_cols;     /**< Amount of columns*/
+    std::size_t row_stride; /**< Elements between the starts of two rows [n_cols, rounded up to row_pad]*/
+    T* elements;            /**< n_rows * row_stride elements, the padding is zero*/
+
+    static std::size_t padded(std::size_t cols) {
+        return (cols + row_pad - 1) / row_pad * row_pad;
+    }
+
+    /**
+     * @brief Allocates zeroed storage for the current size.
+     */
+    void allocate_storage();
+
+    /**
+     * @brief Frees the storage, leaving an empty matrix.
+     */
+    void free_storage();
+
+    /**
+     * @brief C[rows, cols] += alpha * A[rows, depth] * B[depth, cols], on one block. Keeps a 4 row by SIMD width tile of C in registers while walking the depth.
+     */
+    static void gemm_block(T alpha, const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c, std::size_t ldc,
+                           std::size_t rows, std::size_t depth, std::size_t cols);
+
+    /**
+     * @brief Checks the sizes of a GEMM, and resizes C if needed.
+     * @return The beta to use [0 if C was resized, since it's old contents are gone].
+     */
+    static T prepare_gemm(const matrix& a, const matrix& b, T beta, matrix& c);
+
+    /**
+     * @brief Runs a GEMM on the rows [row_begin, row_end) of C. Every element is computed in the same order, no matter how the rows are split, so the results don't depend on the thread count.
+     */
+    static void gemm_rows(T alpha, const matrix& a, const matrix& b, T beta, matrix& c, std::size_t row_begin, std::size_t row_end);
+
+    /**
+     * @brief Writes the transpose of the rows [row_begin, row_end) of src into the matching columns of dst, one tile at a time.
+     */
+    static void transpose_rows(const matrix& src, matrix& dst, std::size_t row_begin, std::size_t row_end);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    /**
+     * Creates an empty 0x0 matrix.
+     * @brief Default constructor.
+     */
+    matrix()
+        : alloc{}, n_rows{0}, n_cols{0}, row_stride{0}, elements{nullptr} { }
+
+    /**
+     * Creates a rows x cols matrix, filled with zeroes.
+     * @brief Constructor.
+     */
+    matrix(std::size_t rows, std::size_t cols)
+        : alloc{}, n_rows{rows}, n_cols{cols}, row_stride{padded(cols)}, elements{nullptr} {
+        allocate_storage();
+    }
+
+    /**
+     * Creates a rows x cols matrix, filled with the provided value.
+     * @brief Constructor.
+     */
+    matrix(std::size_t rows, std::size_t cols, const T& value)
+        : matrix(rows, cols) {
+        fill(value);
+    }
+
+    /**
+     * Creates a matrix, and evaluates the expression straight into it.
+     * @brief Expression constructor.
+     */
+    template <class E>
+    matrix(const matrix_expr<E>& expr)
+        : matrix(expr.rows(), expr.cols()) {
+        expr.self().assign_to(*this);
+    }
+
+    matrix(const matrix& m);
+    matrix(matrix&& m) noexcept;
+    matrix& operator=(const matrix& m);
+    matrix& operator=(matrix&& m) noexcept;
+
+    /**
+     * @brief Evaluates the expression into this matrix. Resizes the matrix if needed, and goes through a temporary only if the expression would overwrite this matrix while still reading it (like A = A * B).
+     */
+    template <class E>
+    matrix& operator=(const matrix_expr<E>& expr);
+
+    /**
+     * @brief Adds the result of the expression to this matrix, without temporaries.
+     * @throws std::invalid_argument if the sizes don't match.
+     */
+    template <class E>
+    matrix& operator+=(const matrix_expr<E>& expr);
+
+    /**
+     * @brief Subtracts the result of the expression from this matrix, without temporaries.
+     * @throws std::invalid_argument if the sizes don't match.
+     */
+    template <class E>
+    matrix& operator-=(const matrix_expr<E>& expr);
+
+    ~matrix() {free_storage();}
+
+    T& operator()(std::size_t r, std::size_t c) {return elements[r * row_stride + c];}
+    const T& operator()(std::size_t r, std::size_t c) const {return elements[r * row_stride + c];}
+
+    /**
+     * @brief Returns the element at (r, c), after checking the bounds.
+     * @throws std::out_of_range if (r, c) is outside of the matrix.
+     */
+    T& at(std::size_t r, std::size_t c);
+    const T& at(std::size_t r, std::size_t c) const;
+
+    std::size_t rows() const {return n_rows;}
+    std::size_t cols() const {return n_cols;}
+    std::size_t stride() const {return row_stride;}
+
+    T* data() {return elements;}
+    const T* data() const {return elements;}
+
+    T* row(std::size_t r) {return elements + r * row_stride;}
+    const T* row(std::size_t r) const {return elements + r * row_stride;}
+
+    /**
+     * @brief Sets every element to the provided value.
+     */
+    void fill(const T& value);
+
+    /**
+     * @brief Changes the size of the matrix. The contents are zeroed.
+     */
+    void resize(std::size_t rows, std::size_t cols);
+
+    /**
+     * @brief Returns an n x n identity matrix.
+     */
+    static matrix identity(std::size_t n);
+
+    /**
+     * @brief C = alpha * A * B + beta * C [BLAS style GEMM].
+     * @details The product is cut into blocks of block_rows x block_depth of A and block_depth x block_cols of B, so the parts of B and C that are being reused stay in the cache,
+     * and every block is multiplied by a kernel which keeps a tile of C in SIMD registers.
+     * @throws std::invalid_argument if the sizes don't match.
+     */
+    static void gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c);
+
+    /**
+     * @brief C = alpha * A * B + beta * C, with the blocks of rows of C spread over the threads of the pool.
+     * @details Each thread owns whole rows of C, so no element is written by two threads, and the result is bit for bit the same as the single threaded gemm() for any amount of threads.
+     * @throws std::invalid_argument if the sizes don't match.
+     */
+    static void gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c, thread_pool& pool);
+
+    /**
+     * @brief Returns the transposed matrix.
+     * @details Works on transpose_tile x transpose_tile tiles, so both the rows being read and the rows being written stay in the cache.
+     */
+    matrix transpose() const;
+
+    /**
+     * @brief Returns the transposed matrix, with the tiles spread over the threads of the pool.
+     */
+    matrix transpose(thread_pool& pool) const;
+
+    /**
+     * @brief dst += factor * this, one SIMD row at a time.
+     */
+    void add_to(matrix& dst, T factor) const;
+
+    /**
+     * @brief dst = this.
+     */
+    void assign_to(matrix& dst) const {
+        if (&dst != this)
+            dst = *this;
+    }
+
+    /**
+     * @brief Returns true if the expression reads the provided matrix.
+     */
+    bool reads(const matrix* dst) const {return dst == this;}
+
+    /**
+     * @brief Returns true if the expression can't be evaluated straight into the provided matrix, because it would overwrite elements it still has to read.
+     */
+    bool needs_temporary(const matrix*) const {return false;}
+
+    friend bool operator==(const matrix& a, const matrix& b) {
+        if (a.n_rows != b.n_rows || a.n_cols != b.n_cols)
+            return false;
+        for (std::size_t r = 0; r < a.n_rows; ++r)
+            if (!std::equal(a.row(r), a.row(r) + a.n_cols, b.row(r)))
+                return false;
+        return true;
+    }
+
+    friend bool operator!=(const matrix& a, const matrix& b) {return !(a == b);}
+};
+
+/*!
+ * @class matrix_sum
+ * @brief Expression for L + sign * R, where sign is 1 or -1.
+ */
+template <class L, class R>
+class matrix_sum : public matrix_expr<matrix_sum<L, R>> {
+private:
+    typename matrix_operand<L>::type left;
+    typename matrix_operand<R>::type right;
+    const int sign;
+
+public:
+    using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+
+    matrix_sum(const L& l, const R& r, int s)
+        : left(l), right(r), sign{s} {
+        if (l.rows() != r.rows() || l.cols() != r.cols())
+            throw std::invalid_argument("Matrices of different sizes can't be added");
+    }
+
+    std::size_t rows() const {return left.rows();}
+    std::size_t cols() const {return left.cols();}
+
+    template <class M>
+    void assign_to(M& dst) const {
+        using T = typename M::value_type;
+
+        // The side which reads dst has to go first, before dst gets overwritten
+        if (right.reads(&dst)) {
+            right.assign_to(dst);
+            if (sign < 0)
+                for (std::size_t r = 0; r < dst.rows(); ++r)
+                    for (std::size_t c = 0; c < dst.cols(); ++c)
+                        dst(r, c) = -dst(r, c);
+            left.add_to(dst, T(1));
+        }
+        else {
+            left.assign_to(dst);
+            right.add_to(dst, static_cast<T>(sign));
+        }
+    }
+
+    template <class M, class F>
+    void add_to(M& dst, F factor) const {
+        left.add_to(dst, factor);
+        right.add_to(dst, static_cast<F>(sign) * factor);
+    }
+
+    template <class M>
+    bool reads(const M* dst) const {return left.reads(dst) || right.reads(dst);}
+
+    template <class M>
+    bool needs_temporary(const M* dst) const {
+        return left.needs_temporary(dst) || right.needs_temporary(dst) || (left.reads(dst) && right.reads(dst));
+    }
+};
+
+/*!
+ * @class matrix_scaled
+ * @brief Expression for scalar * E.
+ *
+ * @details The scalar is kept in the common type of itself and E's elements, so `0.5 * (2 * A)` doesn't turn the 2 into an int factor that 0.5 gets truncated to.
+ */
+template <class E, class T>
+class matrix_scaled : public matrix_expr<matrix_scaled<E, T>> {
+public:
+    using value_type = typename E::value_type;
+    using scalar_type = std::common_type_t<value_type, T>;
+
+private:
+    typename matrix_operand<E>::type inner;
+    const scalar_type scalar;
+
+public:
+    matrix_scaled(const E& e, T s)
+        : inner(e), scalar{static_cast<scalar_type>(s)} { }
+
+    std::size_t rows() const {return inner.rows();}
+    std::size_t cols() const {return inner.cols();}
+
+    template <class M>
+    void assign_to(M& dst) const {
+        inner.assign_to(dst);
+        for (std::size_t r = 0; r < dst.rows(); ++r)
+            for (std::size_t c = 0; c < dst.cols(); ++c)
+                dst(r, c) *= scalar;
+    }
+
+    template <class M, class F>
+    void add_to(M& dst, F factor) const {inner.add_to(dst, scalar * factor);}
+
+    template <class M>
+    bool reads(const M* dst) const {return inner.reads(dst);}
+
+    template <class M>
+    bool needs_temporary(const M* dst) const {return inner.needs_temporary(dst);}
+};
+
+/*!
+ * @class matrix_product
+ * @brief Expression for A * B. Operands which aren't plain matrices are evaluated into temporaries first, since gemm() needs the elements in memory.
+ */
+template <class T, class Alloc, class L, class R>
+class matrix_product : public matrix_expr<matrix_product<T, Alloc, L, R>> {
+private:
+    using matrix_type = matrix<T, Alloc>;
+
+    /**< Matrices are used directly, other expressions are evaluated*/
+    using left_type = std::conditional_t<std::is_same<L, matrix_type>::value, const matrix_type&, const matrix_type>;
+    using right_type = std::conditional_t<std::is_same<R, matrix_type>::value, const matrix_type&, const matrix_type>;
+
+    left_type left;
+    right_type right;
+
+public:
+    using value_type = T;
+
+    matrix_product(const L& l, const R& r)
+        : left(l), right(r) {
+        if (left.cols() != right.rows())
+            throw std::invalid_argument("The columns of the left matrix must match the rows of the right matrix");
+    }
+
+    std::size_t rows() const {return left.rows();}
+    std::size_t cols() const {return right.cols();}
+
+    void assign_to(matrix_type& dst) const {matrix_type::gemm(T(1), left, right, T(0), dst);}
+    void add_to(matrix_type& dst, T factor) const {matrix_type::gemm(factor, left, right, T(1), dst);}
+
+    bool reads(const matrix_type* dst) const {return &left == dst || &right == dst;}
+
+    /**< gemm() can't write into one of it's operands*/
+    bool needs_temporary(const matrix_type* dst) const {return reads(dst);}
+};
+
+template <class L, class R>
+matrix_sum<L, R> operator+(const matrix_expr<L>& l, const matrix_expr<R>& r) {
+    return matrix_sum<L, R>(l.self(), r.self(), 1);
+}
+
+template <class L, class R>
+matrix_sum<L, R> operator-(const matrix_expr<L>& l, const matrix_expr<R>& r) {
+    return matrix_sum<L, R>(l.self(), r.self(), -1);
+}
+
+template <class E, class T, class = std::enable_if_t<std::is_arithmetic<T>::value>>
+matrix_scaled<E, T> operator*(T s, const matrix_expr<E>& e) {
+    return matrix_scaled<E, T>(e.self(), s);
+}
+
+template <class E, class T, class = std::enable_if_t<std::is_arithmetic<T>::value>>
+matrix_scaled<E, T> operator*(const matrix_expr<E>& e, T s) {
+    return matrix_scaled<E, T>(e.self(), s);
+}
+
+template <class T, class Alloc>
+matrix_product<T, Alloc, matrix<T, Alloc>, matrix<T, Alloc>> operator*(const matrix<T, Alloc>& l, const matrix<T, Alloc>& r) {
+    return matrix_product<T, Alloc, matrix<T, Alloc>, matrix<T, Alloc>>(l, r);
+}
+
+template <class T, class Alloc, class R>
+matrix_product<T, Alloc, matrix<T, Alloc>, R> operator*(const matrix<T, Alloc>& l, const matrix_expr<R>& r) {
+    return matrix_product<T, Alloc, matrix<T, Alloc>, R>(l, r.self());
+}
+
+template <class T, class Alloc, class L>
+matrix_product<T, Alloc, L, matrix<T, Alloc>> operator*(const matrix_expr<L>& l, const matrix<T, Alloc>& r) {
+    return matrix_product<T, Alloc, L, matrix<T, Alloc>>(l.self(), r);
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::allocate_storage() {
+    const std::size_t count = n_rows * row_stride;
+    if (count == 0) {
+        elements = nullptr;
+        return;
+    }
+
+    elements = alloc_traits::allocate(alloc, count);
+    std::uninitialized_fill_n(elements, count, T(0));
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::free_storage() {
+    if (elements != nullptr) {
+        std::destroy_n(elements, n_rows * row_stride);
+        alloc_traits::deallocate(alloc, elements, n_rows * row_stride);
+    }
+    elements = nullptr;
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc>::matrix(const matrix& m)
+    : alloc{alloc_traits::select_on_container_copy_construction(m.alloc)}, n_rows{m.n_rows}, n_cols{m.n_cols}, row_stride{m.row_stride}, elements{nullptr} {
+    allocate_storage();
+    std::copy(m.elements, m.elements + n_rows * row_stride, elements);
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc>::matrix(matrix&& m) noexcept
+    : alloc{std::move(m.alloc)}, n_rows{m.n_rows}, n_cols{m.n_cols}, row_stride{m.row_stride}, elements{m.elements} {
+    m.elements = nullptr;
+    m.n_rows = m.n_cols = m.row_stride = 0;
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc>& matrix<T, Alloc>::operator=(const matrix& m) {
+    if (this != &m) {
+        // Reuse the storage if the size is the same
+        if (n_rows != m.n_rows || row_stride != m.row_stride) {
+            free_storage();
+            n_rows = m.n_rows;
+            row_stride = m.row_stride;
+            allocate_storage();
+        }
+        n_cols = m.n_cols;
+        std::copy(m.elements, m.elements + n_rows * row_stride, elements);
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc>& matrix<T, Alloc>::operator=(matrix&& m) noexcept {
+    if (this != &m) {
+        free_storage();
+        alloc = std::move(m.alloc);
+        n_rows = m.n_rows;
+        n_cols = m.n_cols;
+        row_stride = m.row_stride;
+        elements = m.elements;
+        m.elements = nullptr;
+        m.n_rows = m.n_cols = m.row_stride = 0;
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+template <class E>
+matrix<T, Alloc>& matrix<T, Alloc>::operator=(const matrix_expr<E>& expr) {
+    // Resizing would throw away elements the expression still needs
+    const bool resizing = n_rows != expr.rows() || n_cols != expr.cols();
+    if (expr.self().needs_temporary(this) || (resizing && expr.self().reads(this))) {
+        matrix result(expr);
+        return *this = std::move(result);
+    }
+
+    if (resizing)
+        resize(expr.rows(), expr.cols());
+    expr.self().assign_to(*this);
+    return *this;
+}
+
+template <class T, class Alloc>
+template <class E>
+matrix<T, Alloc>& matrix<T, Alloc>::operator+=(const matrix_expr<E>& expr) {
+    if (n_rows != expr.rows() || n_cols != expr.cols())
+        throw std::invalid_argument("Matrices of different sizes can't be added");
+
+    // Every part of the expression adds into this matrix, so a part which reads it would see the earlier parts
+    if (expr.self().reads(this) && static_cast<const void*>(&expr.self()) != this)
+        matrix(expr).add_to(*this, T(1));
+    else
+        expr.self().add_to(*this, T(1));
+    return *this;
+}
+
+template <class T, class Alloc>
+template <class E>
+matrix<T, Alloc>& matrix<T, Alloc>::operator-=(const matrix_expr<E>& expr) {
+    if (n_rows != expr.rows() || n_cols != expr.cols())
+        throw std::invalid_argument("Matrices of different sizes can't be subtracted");
+
+    if (expr.self().reads(this) && static_cast<const void*>(&expr.self()) != this)
+        matrix(expr).add_to(*this, T(-1));
+    else
+        expr.self().add_to(*this, T(-1));
+    return *this;
+}
+
+template <class T, class Alloc>
+T& matrix<T, Alloc>::at(std::size_t r, std::size_t c) {
+    if (r >= n_rows || c >= n_cols)
+        throw std::out_of_range("Matrix index out of range");
+    return (*this)(r, c);
+}
+
+template <class T, class Alloc>
+const T& matrix<T, Alloc>::at(std::size_t r, std::size_t c) const {
+    if (r >= n_rows || c >= n_cols)
+        throw std::out_of_range("Matrix index out of range");
+    return (*this)(r, c);
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::fill(const T& value) {
+    // Leave the padding at zero
+    for (std::size_t r = 0; r < n_rows; ++r)
+        std::fill(row(r), row(r) + n_cols, value);
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::resize(std::size_t rows, std::size_t cols) {
+    free_storage();
+    n_rows = rows;
+    n_cols = cols;
+    row_stride = padded(cols);
+    allocate_storage();
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc> matrix<T, Alloc>::identity(std::size_t n) {
+    matrix result(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        result(i, i) = T(1);
+    return result;
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::add_to(matrix& dst, T factor) const {
+    if (dst.n_rows != n_rows || dst.n_cols != n_cols)
+        throw std::invalid_argument("Matrices of different sizes can't be added");
+
+    const typename simd::reg f = simd::broadcast(factor);
+    for (std::size_t r = 0; r < n_rows; ++r) {
+        const T* src = row(r);
+        T* out = dst.row(r);
+
+        std::size_t c = 0;
+        for (; c + simd::width <= n_cols; c += simd::width)
+            simd::store(out + c, simd::fmadd(f, simd::load(src + c), simd::load(out + c)));
+        for (; c < n_cols; ++c)
+            out[c] += factor * src[c];
+    }
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::gemm_block(T alpha, const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c, std::size_t ldc,
+                                  std::size_t rows, std::size_t depth, std::size_t cols) {
+    using reg = typename simd::reg;
+    constexpr std::size_t W = simd::width;
+
+    std::size_t i = 0;
+    // 4 rows of C at a time: every row of B that gets loaded is used 4 times
+    for (; i + 4 <= rows; i += 4) {
+        const T* a0 = a + i * lda;
+        const T* a1 = a0 + lda;
+        const T* a2 = a1 + lda;
+        const T* a3 = a2 + lda;
+        T* c0 = c + i * ldc;
+        T* c1 = c0 + ldc;
+        T* c2 = c1 + ldc;
+        T* c3 = c2 + ldc;
+
+        std::size_t j = 0;
+        for (; j + W <= cols; j += W) {
+            // The tile of C stays in registers for the whole depth
+            reg acc0 = simd::load(c0 + j);
+            reg acc1 = simd::load(c1 + j);
+            reg acc2 = simd::load(c2 + j);
+            reg acc3 = simd::load(c3 + j);
+            for (std::size_t k = 0; k < depth; ++k) {
+                const reg bk = simd::load(b + k * ldb + j);
+                acc0 = simd::fmadd(simd::broadcast(alpha * a0[k]), bk, acc0);
+                acc1 = simd::fmadd(simd::broadcast(alpha * a1[k]), bk, acc1);
+                acc2 = simd::fmadd(simd::broadcast(alpha * a2[k]), bk, acc2);
+                acc3 = simd::fmadd(simd::broadcast(alpha * a3[k]), bk, acc3);
+            }
+            simd::store(c0 + j, acc0);
+            simd::store(c1 + j, acc1);
+            simd::store(c2 + j, acc2);
+            simd::store(c3 + j, acc3);
+        }
+
+        // Columns which don't fill a whole register
+        for (; j < cols; ++j)
+            for (std::size_t k = 0; k < depth; ++k) {
+                const T bk = b[k * ldb + j];
+                c0[j] += alpha * a0[k] * bk;
+                c1[j] += alpha * a1[k] * bk;
+                c2[j] += alpha * a2[k] * bk;
+                c3[j] += alpha * a3[k] * bk;
+            }
+    }
+
+    // Rows which don't fill a whole tile
+    for (; i < rows; ++i) {
+        const T* ai = a + i * lda;
+        T* ci = c + i * ldc;
+        for (std::size_t k = 0; k < depth; ++k) {
+            const T aik = alpha * ai[k];
+            const reg av = simd::broadcast(aik);
+            const T* bk = b + k * ldb;
+
+            std::size_t j = 0;
+            for (; j + W <= cols; j += W)
+                simd::store(ci + j, simd::fmadd(av, simd::load(bk + j), simd::load(ci + j)));
+            for (; j < cols; ++j)
+                ci[j] += aik * bk[j];
+        }
+    }
+}
+
+template <class T, class Alloc>
+T matrix<T, Alloc>::prepare_gemm(const matrix& a, const matrix& b, T beta, matrix& c) {
+    if (a.n_cols != b.n_rows)
+        throw std::invalid_argument("The columns of the left matrix must match the rows of the right matrix");
+    if (&c == &a || &c == &b)
+        throw std::invalid_argument("gemm() can't write into one of it's operands");
+
+    if (c.n_rows != a.n_rows || c.n_cols != b.n_cols) {
+        c.resize(a.n_rows, b.n_cols);
+        return T(0);
+    }
+    return beta;
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::gemm_rows(T alpha, const matrix& a, const matrix& b, T beta, matrix& c, std::size_t row_begin, std::size_t row_end) {
+    // C = beta * C first, the blocks then only accumulate
+    for (std::size_t r = row_begin; r < row_end; ++r) {
+        T* out = c.row(r);
+        if (beta == T(0))
+            std::fill(out, out + c.n_cols, T(0));
+        else if (beta != T(1))
+            for (std::size_t col = 0; col < c.n_cols; ++col)
+                out[col] *= beta;
+    }
+
+    const std::size_t n = b.n_cols;
+    const std::size_t depth = a.n_cols;
+
+    // The block of B (block_depth x block_cols) is reused by every block of rows, so it's the one that has to stay in the cache
+    for (std::size_t jj = 0; jj < n; jj += block_cols) {
+        const std::size_t nc = std::min(block_cols, n - jj);
+        for (std::size_t kk = 0; kk < depth; kk += block_depth) {
+            const std::size_t kc = std::min(block_depth, depth - kk);
+            for (std::size_t ii = row_begin; ii < row_end; ii += block_rows) {
+                const std::size_t mc = std::min(block_rows, row_end - ii);
+                gemm_block(alpha, a.row(ii) + kk, a.row_stride, b.row(kk) + jj, b.row_stride, c.row(ii) + jj, c.row_stride, mc, kc, nc);
+            }
+        }
+    }
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c) {
+    beta = prepare_gemm(a, b, beta, c);
+    gemm_rows(alpha, a, b, beta, c, 0, c.n_rows);
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::gemm(T alpha, const matrix& a, const matrix& b, T beta, matrix& c, thread_pool& pool) {
+    beta = prepare_gemm(a, b, beta, c);
+
+    // Whole row blocks per chunk, so the blocking inside of a chunk is the same as in the serial version
+    pool.parallel_for(0, c.n_rows, block_rows, [&](std::size_t lo, std::size_t hi) {
+        gemm_rows(alpha, a, b, beta, c, lo, hi);
+    });
+}
+
+template <class T, class Alloc>
+void matrix<T, Alloc>::transpose_rows(const matrix& src, matrix& dst, std::size_t row_begin, std::size_t row_end) {
+    for (std::size_t ii = row_begin; ii < row_end; ii += transpose_tile) {
+        const std::size_t i_end = std::min(ii + transpose_tile, row_end);
+        for (std::size_t jj = 0; jj < src.n_cols; jj += transpose_tile) {
+            const std::size_t j_end = std::min(jj + transpose_tile, src.n_cols);
+            for (std::size_t i = ii; i < i_end; ++i)
+                for (std::size_t j = jj; j < j_end; ++j)
+                    dst(j, i) = src(i, j);
+        }
+    }
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc> matrix<T, Alloc>::transpose() const {
+    matrix result(n_cols, n_rows);
+    transpose_rows(*this, result, 0, n_rows);
+    return result;
+}
+
+template <class T, class Alloc>
+matrix<T, Alloc> matrix<T, Alloc>::transpose(thread_pool& pool) const {
+    matrix result(n_cols, n_rows);
+
+    // A chunk of source rows becomes a chunk of destination columns, a few tiles wide so threads don't share cache lines
+    pool.parallel_for(0, n_rows, 4 * transpose_tile, [&](std::size_t lo, std::size_t hi) {
+        transpose_rows(*this, result, lo, hi);
+    });
+    return result;
+}
+
+#endif // MATRIX_H
@@ -10,6 +10,9 @@
 
 #ifndef NODE_H
 #define NODE_H
+
+#include <utility>
+
 /*!
  * @class node  
  * @brief node class.
@@ -17,7 +20,8 @@
  * @details A standard Node data structure that is used as a base unit in many other data structures. Supports insertion, removal, and dynamic types.
  * 
  * @fn get_data()
- * @fn set_data(T dt)
+ * @fn set_data(const T& dt)
+ * @fn set_data(T&& dt)
  * @fn get_next()
  * @fn set_next(Node<T>* nd)
  * @tparam T typename
@@ -41,18 +45,44 @@ public:
      * @brief Constructor.
      * @param dt node data.
      */
-    node(const T dt)
+    node(const T& dt)
         : next{nullptr}, data{dt} { }
 
+    /**
+     * Creates a new node that points to NULL both ways, and moves the data into the node.
+     * @brief Move constructor for the data.
+     * @param dt node data.
+     */
+    node(T&& dt)
+        : next{nullptr}, data{std::move(dt)} { }
+
+    /**
+     * Creates a new node that points to NULL both ways, and constructs it's data in place from the provided arguments.
+     * @brief Emplacing constructor.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <class... Args>
+    explicit node(std::in_place_t, Args&&... args)
+        : next{nullptr}, data(std::forward<Args>(args)...) { }
+
     /**
      * Creates a new node that points to a node forward, but not backward, and has data.
      * @brief Constructor.
      * @param nd node to which it will point.
      * @param dt node data.
      */
-    node(node<T>* const nd, const T dt)
+    node(node<T>* const nd, const T& dt)
         : next{nd}, data{dt} { }
 
+    /**
+     * Creates a new node that points to a node forward, but not backward, and moves the data into the node.
+     * @brief Constructor.
+     * @param nd node to which it will point.
+     * @param dt node data.
+     */
+    node(node<T>* const nd, T&& dt)
+        : next{nd}, data{std::move(dt)} { }
+
     /**
      * Construct a new node from another node object.
      * @brief Copy constructor.
@@ -64,9 +94,17 @@ public:
 
     /**
      * @brief Get the node's data.
-     * @return node data.
+     * @return Reference to the node data.
      */
-    T get_data() const {
+    T& get_data() {
+        return data;
+    }
+
+    /**
+     * @brief Get the node's data.
+     * @return Read-only reference to the node data.
+     */
+    const T& get_data() const {
         return data;
     }
 
@@ -74,10 +112,18 @@ public:
      * @brief Set the current node's data.
      * @param dt new node data.
      */
-    void set_data(const T dt) {
+    void set_data(const T& dt) {
         data = dt;
     }
 
+    /**
+     * @brief Move new data into the current node.
+     * @param dt new node data.
+     */
+    void set_data(T&& dt) {
+        data = std::move(dt);
+    }
+
     /**
      * @brief Get the pointer to the next node.
      * @return node object to which the current node object points to next.
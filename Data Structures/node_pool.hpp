@@ -0,0 +1,261 @@
+/**
+ * @file node_pool.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a slab/free-list allocator for node based containers
+ * @version 0.3
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+/*!
+ * @class node_pool_state
+ * @brief The chunks and free-lists behind a node_pool, which every copy and every rebound copy of the pool share.
+ *
+ * @details Slots are grouped by their size and alignment (a slab per group), instead of by type, so a node_pool<int> and the node_pool<node<int>> a container rebinds it to
+ * are the same pool: they compare equal, and memory allocated through one can be freed through the other.
+ * @tparam ChunkSize Amount of slots in a single chunk
+ */
+template <std::size_t ChunkSize>
+class node_pool_state {
+public:
+    /**< Slots of one size and alignment: a chain of chunks, and a free-list of slots that were given back */
+    struct slab {
+        slab* next_slab;            /**< Next slab of the same pool*/
+        std::size_t slot_size;      /**< Size of every slot [at least a pointer, and a multiple of align]*/
+        std::size_t align;          /**< Alignment of every slot*/
+        void* free_list = nullptr;  /**< Slots that have been given back, linked through their first bytes*/
+        unsigned char* chunks = nullptr;    /**< Newest chunk, which starts with a pointer to the previous one*/
+        std::size_t carved = ChunkSize;     /**< How many slots of the newest chunk have been handed out*/
+
+        slab(slab* next, std::size_t size, std::size_t alignment)
+            : next_slab{next}, slot_size{size}, align{alignment} { }
+
+        /**
+         * Bytes in front of the slots of a chunk, that hold the link to the previous chunk
+         */
+        std::size_t header() const {return align > sizeof(void*) ? align : sizeof(void*);}
+
+        void* allocate();
+        void deallocate(void* p) noexcept;
+        void release() noexcept;
+    };
+
+    node_pool_state() = default;
+    node_pool_state(const node_pool_state&) = delete;
+    node_pool_state& operator=(const node_pool_state&) = delete;
+
+    ~node_pool_state() {
+        while (slabs != nullptr) {
+            slab* next = slabs->next_slab;
+            slabs->release();
+            delete slabs;
+            slabs = next;
+        }
+    }
+
+    /**
+     * @brief Returns the slab for slots of the provided size and alignment, and makes one if there is none yet.
+     */
+    slab* slab_for(std::size_t size, std::size_t alignment) {
+        if (alignment < alignof(void*))
+            alignment = alignof(void*);
+        if (size < sizeof(void*))
+            size = sizeof(void*);
+        size = (size + alignment - 1) / alignment * alignment;
+
+        // A pool only ever sees a handful of node types, so a list is enough
+        for (slab* sb = slabs; sb != nullptr; sb = sb->next_slab)
+            if (sb->slot_size == size && sb->align == alignment)
+                return sb;
+        slabs = new slab(slabs, size, alignment);
+        return slabs;
+    }
+
+private:
+    slab* slabs = nullptr;  /**< Every slab of the pool*/
+};
+
+template <std::size_t ChunkSize>
+void* node_pool_state<ChunkSize>::slab::allocate() {
+    // Recycle a freed slot first, it is most likely still in the cache
+    if (free_list != nullptr) {
+        void* recycled = free_list;
+        free_list = *static_cast<void**>(recycled);
+        return recycled;
+    }
+
+    // Out of fresh slots, grab a new chunk
+    if (carved == ChunkSize) {
+        const std::size_t bytes = header() + ChunkSize * slot_size;
+        unsigned char* fresh = static_cast<unsigned char*>(align > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+            ? ::operator new(bytes, std::align_val_t{align})
+            : ::operator new(bytes));
+        *reinterpret_cast<unsigned char**>(fresh) = chunks;
+        chunks = fresh;
+        carved = 0;
+    }
+
+    // Carve the next slot, so consecutive allocations end up next to each other
+    return chunks + header() + slot_size * carved++;
+}
+
+template <std::size_t ChunkSize>
+void node_pool_state<ChunkSize>::slab::deallocate(void* p) noexcept {
+    // Put the slot at the front of the free-list
+    *static_cast<void**>(p) = free_list;
+    free_list = p;
+}
+
+template <std::size_t ChunkSize>
+void node_pool_state<ChunkSize>::slab::release() noexcept {
+    while (chunks != nullptr) {
+        unsigned char* prev = *reinterpret_cast<unsigned char**>(chunks);
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(chunks, std::align_val_t{align});
+        else
+            ::operator delete(chunks);
+        chunks = prev;
+    }
+    free_list = nullptr;
+    carved = ChunkSize;
+}
+
+/*!
+ * @class node_pool
+ * @brief Node pool allocator class.
+ *
+ * @details An allocator that is compatible with std::allocator_traits, and is meant to be passed to sl_list, dl_list and bst (or any other container that allocates one node at a time).
+ * Nodes are carved out of contiguous chunks of ChunkSize slots, so nodes that were inserted one after another also sit next to each other in memory.
+ * Freed nodes go onto a free-list and are handed out again by the next allocation, so a container that keeps pushing and popping stops calling malloc altogether.
+ * All of the chunks are released when the last copy of the pool is destroyed.
+ *
+ * @note Copies of a pool share the same chunks, and so do rebound copies (which is what the containers make internally): slots are grouped by size and alignment, not by type.
+ * So a pool compares equal to its rebound copies, containers that were given the same pool share it, and a node allocated through node_pool<node<T>>(list.get_allocator()) can be handed to the list.
+ * @note Requests for more than one object at a time are passed on to std::allocator.
+ * @note A pool isn't thread-safe, every copy of it has to be used from one thread at a time.
+ *
+ * @fn allocate(std::size_t n)
+ * @fn deallocate(T* p, std::size_t n)
+ * @tparam T typename
+ * @tparam ChunkSize Amount of objects that fit in a single chunk
+ */
+template <class T, std::size_t ChunkSize = 256>
+class node_pool {
+    static_assert(ChunkSize > 0, "node_pool chunks must hold at least one object");
+
+    template <class U, std::size_t N>
+    friend class node_pool;
+
+private:
+    using state_type = node_pool_state<ChunkSize>;
+    using slab = typename state_type::slab;
+
+    std::shared_ptr<state_type> state;  /**< Chunks and free-lists of this pool, shared with every (rebound) copy*/
+    slab* own = nullptr;                /**< Slab with slots for T, looked up by the first allocate()*/
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <class U>
+    struct rebind {
+        using other = node_pool<U, ChunkSize>;
+    };
+
+    /**
+     * Creates a new, empty pool. No chunks are allocated until the first allocate() call.
+     * @brief Default constructor.
+     */
+    node_pool()
+        : state{std::make_shared<state_type>()} { }
+
+    /**
+     * Creates a copy which shares the chunks of the provided pool.
+     * @brief Copy constructor.
+     */
+    node_pool(const node_pool& pool) noexcept = default;
+
+    /**
+     * Creates a copy for a different type, which shares the chunks of the provided pool, and compares equal to it.
+     * @brief Rebinding constructor.
+     */
+    template <class U>
+    node_pool(const node_pool<U, ChunkSize>& pool) noexcept
+        : state{pool.state} { }
+
+    /**
+     * @brief A copy of a pool should start with it's own chunks when copying a container.
+     * @return A new, empty pool.
+     */
+    node_pool select_on_container_copy_construction() const {
+        return node_pool{};
+    }
+
+    /**
+     * @brief Returns memory for n objects of type T.
+     * @param n Amount of objects.
+     * @return Pointer to uninitialized memory.
+     * @see deallocate(T* p, std::size_t n)
+     */
+    T* allocate(std::size_t n);
+
+    /**
+     * @brief Gives memory back to the pool.
+     * @param p Pointer which was returned by allocate() of this pool, or of an equal one
+     * @param n Amount of objects which was passed to allocate()
+     * @see allocate(std::size_t n)
+     */
+    void deallocate(T* p, std::size_t n) noexcept;
+
+    template <class U>
+    bool operator==(const node_pool<U, ChunkSize>& pool) const noexcept {
+        return state == pool.state;
+    }
+
+    template <class U>
+    bool operator!=(const node_pool<U, ChunkSize>& pool) const noexcept {
+        return !(*this == pool);
+    }
+};
+
+template <class T, std::size_t ChunkSize>
+T* node_pool<T, ChunkSize>::allocate(std::size_t n) {
+    // Arrays don't fit into a slot
+    if (n != 1)
+        return std::allocator<T>().allocate(n);
+
+    if (own == nullptr)
+        own = state->slab_for(sizeof(T), alignof(T));
+    return static_cast<T*>(own->allocate());
+}
+
+template <class T, std::size_t ChunkSize>
+void node_pool<T, ChunkSize>::deallocate(T* p, std::size_t n) noexcept {
+    if (p == nullptr)
+        return;
+
+    if (n != 1) {
+        std::allocator<T>().deallocate(p, n);
+        return;
+    }
+
+    // The slot may have come from an equal copy, which made the slab already
+    slab* sb = own;
+    if (sb == nullptr)
+        sb = own = state->slab_for(sizeof(T), alignof(T));
+    sb->deallocate(p);
+}
+
+#endif // NODE_POOL_H
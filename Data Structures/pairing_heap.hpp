@@ -0,0 +1,435 @@
+/**
+ * @file pairing_heap.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a node based, mergeable pairing heap class
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include "node_pool.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/*!
+ * @class pairing_node
+ * @brief Pairing Heap Node class.
+ *
+ * @details A Node class tailored to work with pairing heaps. Children of a node form a doubly-linked list of siblings (like double_node), where the first child's prev points back to the parent instead.
+ *
+ * @tparam T typename
+ */
+template <class T>
+class pairing_node {
+public:
+    pairing_node<T>* child;   /**< Pointer to the first (leftmost) child of this node*/
+    pairing_node<T>* next;    /**< Pointer to the next sibling of this node*/
+    pairing_node<T>* prev;    /**< Pointer to the previous sibling of this node [the parent, if this is the first child]*/
+    T data;                   /**< Data that this node contains.*/
+
+    /**
+     * Creates a new pairing_node object, that points to null in every direction, and constructs it's data value in place.
+     * @brief Emplacing Constructor.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <class... Args>
+    explicit pairing_node(std::in_place_t, Args&&... args)
+        : child{nullptr}, next{nullptr}, prev{nullptr}, data(std::forward<Args>(args)...) { }
+};
+
+/*!
+ * @class pairing_heap
+ * @brief Pairing Heap class [mergeable priority queue].
+ *
+ * @details A heap-ordered tree with any amount of children per node. push(), meld() and decrease_key() only link two trees together, which is O(1),
+ * and pop() pairs up the children of the old root (left to right) and then links the pairs (right to left), which is O(log n) amortized.
+ * push() returns the node of the new value, which serves as a handle for decrease_key() and erase(): the node never moves, and stays valid until it's value is popped or erased.
+ * Like std::priority_queue, top() is the largest value according to Compare (pass std::greater<T> for a min-heap, where decrease_key() really decreases the value).
+ *
+ * @note Nodes come from a node_pool by default. Two heaps can only be melded if they use equal allocators, so construct the second one from get_allocator() of the first one (copies of a node_pool are equal, rebound or not).
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn emplace(Args&&... args)
+ * @fn pop()
+ * @fn top()
+ * @fn decrease_key(pairing_node<T>* nd, const T& dt)
+ * @fn erase(pairing_node<T>* nd)
+ * @fn meld(pairing_heap& heap)
+ * @fn size()
+ * @fn clear()
+ * @tparam T typename
+ * @tparam Compare Ordering, the value for which Compare says nothing is larger is on the top
+ * @tparam Alloc Allocator used for the nodes, rebound to pairing_node<T>
+ */
+template <class T, class Compare = std::less<T>, class Alloc = node_pool<T>>
+class pairing_heap {
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using allocator_type = Alloc;
+
+private:
+    using node_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<pairing_node<T>>;
+    using node_traits = std::allocator_traits<node_allocator_type>;
+
+    node_allocator_type alloc;   /**< Allocator which creates and frees every node of the heap*/
+    Compare comp;                /**< Ordering of the values*/
+    pairing_node<T>* root;       /**< Node with the largest value*/
+    std::size_t len;             /**< Amount of values in the heap*/
+
+    template <class... Args>
+    pairing_node<T>* create_node(Args&&... args);
+    void destroy_node(pairing_node<T>* nd);
+
+    /**
+     * @brief Links two trees, the root with the smaller value becomes the first child of the other one.
+     * @return The root of the linked tree.
+     */
+    pairing_node<T>* link(pairing_node<T>* a, pairing_node<T>* b);
+
+    /**
+     * @brief Unhooks a (non-root) node, together with it's sub-tree, from it's parent and siblings.
+     */
+    static void cut(pairing_node<T>* nd);
+
+    /**
+     * @brief Links a list of siblings into a single tree, using the two-pass pairing.
+     * @param first First node of the sibling list [may be nullptr].
+     * @return Root of the resulting tree [nullptr if there were no siblings].
+     */
+    pairing_node<T>* merge_pairs(pairing_node<T>* first);
+
+    /**
+     * @brief Pushes a copy of every value of the provided heap.
+     */
+    void copy_from(const pairing_heap& heap);
+
+public:
+    /**
+     * Creates an empty heap.
+     * @brief Default constructor.
+     */
+    explicit pairing_heap(const Compare& compare = Compare())
+        : alloc{}, comp{compare}, root{nullptr}, len{0} { }
+
+    /**
+     * Creates an empty heap, which allocates it's nodes using the provided allocator. Heaps with equal allocators can be melded.
+     * @brief Allocator constructor.
+     */
+    explicit pairing_heap(const Alloc& allocator, const Compare& compare = Compare())
+        : alloc{allocator}, comp{compare}, root{nullptr}, len{0} { }
+
+    pairing_heap(const pairing_heap& heap);
+    pairing_heap(pairing_heap&& heap) noexcept;
+    pairing_heap& operator=(const pairing_heap& heap);
+    pairing_heap& operator=(pairing_heap&& heap) noexcept;
+
+    /**
+     * @brief Frees every node of the heap.
+     */
+    ~pairing_heap() {clear();}
+
+    /**
+     * @brief Inserts a value into the heap, in O(1).
+     * @param dt Data to insert.
+     * @return Node of the new value, which is it's handle.
+     */
+    pairing_node<T>* push(const T& dt) {return emplace(dt);}
+    pairing_node<T>* push(T&& dt) {return emplace(std::move(dt));}
+
+    /**
+     * @brief Constructs a value in place, and inserts it into the heap, in O(1).
+     * @param args Arguments forwarded to T's constructor.
+     * @return Node of the new value, which is it's handle.
+     */
+    template <class... Args>
+    pairing_node<T>* emplace(Args&&... args);
+
+    /**
+     * @brief Returns the largest value.
+     * @note The heap must not be empty.
+     */
+    const T& top() const {return root->data;}
+
+    /**
+     * @brief Returns the node of the largest value.
+     */
+    pairing_node<T>* top_node() const {return root;}
+
+    /**
+     * @brief Removes the value on the top of the heap, in O(log n) amortized. It's node is freed.
+     * @note The heap must not be empty.
+     */
+    void pop();
+
+    /**
+     * @brief Moves a value towards the top, by replacing it with one that ranks at least as high [a smaller one, in a std::greater min-heap], in O(1).
+     * @param nd Node of the value.
+     * @param dt The new value.
+     * @throws std::invalid_argument if the node is nullptr, or if the new value ranks lower than the old one.
+     */
+    void decrease_key(pairing_node<T>* nd, const T& dt);
+
+    /**
+     * @brief Removes a value from anywhere in the heap, in O(log n) amortized. It's node is freed.
+     * @param nd Node of the value.
+     * @throws std::invalid_argument if the node is nullptr.
+     */
+    void erase(pairing_node<T>* nd);
+
+    /**
+     * @brief Moves every value of the provided heap into this heap, in O(1). Nodes (handles) of the other heap now belong to this heap.
+     * @param heap Heap to take the values from, left empty.
+     * @throws std::invalid_argument if the heaps don't use equal allocators.
+     */
+    void meld(pairing_heap& heap);
+
+    std::size_t size() const {return len;}
+    bool empty() const {return len == 0;}
+
+    /**
+     * @brief Frees every node of the heap, without recursion.
+     */
+    void clear();
+
+    /**
+     * @brief Returns a copy of the allocator, which can be used to construct heaps that can be melded with this one.
+     */
+    allocator_type get_allocator() const {return allocator_type(alloc);}
+};
+
+template <class T, class Compare, class Alloc>
+template <class... Args>
+pairing_node<T>* pairing_heap<T, Compare, Alloc>::create_node(Args&&... args) {
+    pairing_node<T>* nd = node_traits::allocate(alloc, 1);
+    try {
+        node_traits::construct(alloc, nd, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::destroy_node(pairing_node<T>* nd) {
+    node_traits::destroy(alloc, nd);
+    node_traits::deallocate(alloc, nd, 1);
+}
+
+template <class T, class Compare, class Alloc>
+pairing_node<T>* pairing_heap<T, Compare, Alloc>::link(pairing_node<T>* a, pairing_node<T>* b) {
+    if (a == nullptr)
+        return b;
+    if (b == nullptr)
+        return a;
+
+    // The winner stays on top, the loser becomes it's first child
+    pairing_node<T>* winner = comp(a->data, b->data) ? b : a;
+    pairing_node<T>* loser = (winner == a) ? b : a;
+
+    loser->next = winner->child;
+    if (winner->child != nullptr)
+        winner->child->prev = loser;
+    loser->prev = winner;
+    winner->child = loser;
+    return winner;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::cut(pairing_node<T>* nd) {
+    // The first child hangs off of the parent's child pointer, the rest off of their left sibling
+    if (nd->prev->child == nd)
+        nd->prev->child = nd->next;
+    else
+        nd->prev->next = nd->next;
+
+    if (nd->next != nullptr)
+        nd->next->prev = nd->prev;
+
+    nd->next = nullptr;
+    nd->prev = nullptr;
+}
+
+template <class T, class Compare, class Alloc>
+pairing_node<T>* pairing_heap<T, Compare, Alloc>::merge_pairs(pairing_node<T>* first) {
+    // First pass: link the siblings in pairs, left to right. The winners are chained through next, in reverse order
+    pairing_node<T>* pairs = nullptr;
+    while (first != nullptr) {
+        pairing_node<T>* a = first;
+        pairing_node<T>* b = a->next;
+        first = (b == nullptr) ? nullptr : b->next;
+
+        a->next = a->prev = nullptr;
+        if (b != nullptr)
+            b->next = b->prev = nullptr;
+
+        pairing_node<T>* winner = link(a, b);
+        winner->next = pairs;
+        pairs = winner;
+    }
+
+    // Second pass: link the pairs right to left (the chain is already reversed)
+    pairing_node<T>* result = nullptr;
+    while (pairs != nullptr) {
+        pairing_node<T>* following = pairs->next;
+        pairs->next = nullptr;
+        result = link(result, pairs);
+        pairs = following;
+    }
+    return result;
+}
+
+template <class T, class Compare, class Alloc>
+template <class... Args>
+pairing_node<T>* pairing_heap<T, Compare, Alloc>::emplace(Args&&... args) {
+    pairing_node<T>* nd = create_node(std::forward<Args>(args)...);
+    root = link(root, nd);
+    ++len;
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::pop() {
+    pairing_node<T>* old_root = root;
+    root = merge_pairs(old_root->child);
+    destroy_node(old_root);
+    --len;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::decrease_key(pairing_node<T>* nd, const T& dt) {
+    if (nd == nullptr)
+        throw std::invalid_argument("Can't change the value of a nullptr node");
+    if (comp(dt, nd->data))
+        throw std::invalid_argument("decrease_key() can only move a value towards the top");
+
+    nd->data = dt;
+    if (nd == root)
+        return;
+
+    // The node's sub-tree is still heap ordered, it may just be larger than it's parent now
+    cut(nd);
+    root = link(root, nd);
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::erase(pairing_node<T>* nd) {
+    if (nd == nullptr)
+        throw std::invalid_argument("Can't erase a nullptr node");
+
+    if (nd == root) {
+        pop();
+        return;
+    }
+
+    // Cut the node out, and put it's children back as one tree
+    cut(nd);
+    root = link(root, merge_pairs(nd->child));
+    destroy_node(nd);
+    --len;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::meld(pairing_heap& heap) {
+    if (this == &heap)
+        return;
+    // Our allocator has to be able to free the other heap's nodes
+    if (!(alloc == heap.alloc))
+        throw std::invalid_argument("Only heaps with equal allocators can be melded");
+
+    root = link(root, heap.root);
+    len += heap.len;
+    heap.root = nullptr;
+    heap.len = 0;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::clear() {
+    // Seen as a binary tree (child = left, next = right), rotate the left branches away, until every node can be freed on the way down the right spine
+    pairing_node<T>* curr_node = root;
+    while (curr_node != nullptr) {
+        if (curr_node->child == nullptr) {
+            pairing_node<T>* following = curr_node->next;
+            destroy_node(curr_node);
+            curr_node = following;
+        }
+        else {
+            pairing_node<T>* left = curr_node->child;
+            curr_node->child = left->next;
+            left->next = curr_node;
+            curr_node = left;
+        }
+    }
+
+    root = nullptr;
+    len = 0;
+}
+
+template <class T, class Compare, class Alloc>
+void pairing_heap<T, Compare, Alloc>::copy_from(const pairing_heap& heap) {
+    if (heap.root == nullptr)
+        return;
+
+    // Walk the other heap with an explicit stack, the shape doesn't matter, only the values
+    std::vector<const pairing_node<T>*> pending{heap.root};
+    while (!pending.empty()) {
+        const pairing_node<T>* nd = pending.back();
+        pending.pop_back();
+        emplace(nd->data);
+
+        if (nd->next != nullptr)
+            pending.push_back(nd->next);
+        if (nd->child != nullptr)
+            pending.push_back(nd->child);
+    }
+}
+
+template <class T, class Compare, class Alloc>
+pairing_heap<T, Compare, Alloc>::pairing_heap(const pairing_heap& heap)
+    : alloc{node_traits::select_on_container_copy_construction(heap.alloc)}, comp{heap.comp}, root{nullptr}, len{0} {
+    copy_from(heap);
+}
+
+template <class T, class Compare, class Alloc>
+pairing_heap<T, Compare, Alloc>::pairing_heap(pairing_heap&& heap) noexcept
+    : alloc{std::move(heap.alloc)}, comp{std::move(heap.comp)}, root{heap.root}, len{heap.len} {
+    heap.root = nullptr;
+    heap.len = 0;
+}
+
+template <class T, class Compare, class Alloc>
+pairing_heap<T, Compare, Alloc>& pairing_heap<T, Compare, Alloc>::operator=(const pairing_heap& heap) {
+    if (this != &heap) {
+        clear();
+        comp = heap.comp;
+        copy_from(heap);
+    }
+    return *this;
+}
+
+template <class T, class Compare, class Alloc>
+pairing_heap<T, Compare, Alloc>& pairing_heap<T, Compare, Alloc>::operator=(pairing_heap&& heap) noexcept {
+    if (this != &heap) {
+        // Our nodes have to be freed with our own allocator, before it gets replaced
+        clear();
+        alloc = std::move(heap.alloc);
+        comp = std::move(heap.comp);
+        root = heap.root;
+        len = heap.len;
+        heap.root = nullptr;
+        heap.len = 0;
+    }
+    return *this;
+}
+
+#endif // PAIRING_HEAP_H
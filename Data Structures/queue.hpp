@@ -0,0 +1,542 @@
+/**
+ * @file queue.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a queue class, and bounded lock-free ring-buffer queues for passing values between threads
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "sl_list.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*!
+ * @class queue
+ * @brief queue class.
+ *
+ * @details A standard queue [FIFO] data structure for a single thread. Made using SLL in sl_list.hpp: values are pushed at the tail and popped from the head, both in O(1).
+ * For passing values between threads, see spsc_queue and mpmc_queue.
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn emplace(Args&&... args)
+ * @fn pop()
+ * @fn front()
+ * @fn back()
+ * @fn empty()
+ * @fn size()
+ * @fn clear()
+ * @tparam T class
+ * @tparam Alloc Allocator used for the nodes of the list (see node_pool.hpp for a pooled one)
+ */
+template <class T, class Alloc = std::allocator<T>>
+class queue {
+private:
+    sl_list<T, Alloc> item_list;   /**< Singly-Linked list to store the items, the front of the queue is the head*/
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Inserts a value at the back of the queue, and returns it
+     * @param dt Data to append to the queue
+     * @return Reference to the back of the queue
+     */
+    T& push(const T& dt) {return item_list.push_back(dt)->get_data();}
+
+    /**
+     * @brief Moves a value to the back of the queue, and returns it
+     * @param dt Data to append to the queue
+     * @return Reference to the back of the queue
+     */
+    T& push(T&& dt) {return item_list.push_back(std::move(dt))->get_data();}
+
+    /**
+     * @brief Constructs a value in place at the back of the queue, and returns it
+     * @param args Arguments forwarded to T's constructor
+     * @return Reference to the back of the queue
+     */
+    template <class... Args>
+    T& emplace(Args&&... args) {return item_list.emplace_back(std::forward<Args>(args)...)->get_data();}
+
+    /**
+     * @brief Removes the value at the front of the queue
+     * @note The queue must not be empty
+     */
+    void pop() {item_list.pop_front();}
+
+    /**
+     * @brief Returns the value which will be popped next
+     * @note The queue must not be empty
+     */
+    T& front() {return item_list.get_head()->get_data();}
+    const T& front() const {return item_list.get_head()->get_data();}
+
+    /**
+     * @brief Returns the value which was pushed last
+     * @note The queue must not be empty
+     */
+    T& back() {return item_list.get_tail()->get_data();}
+    const T& back() const {return item_list.get_tail()->get_data();}
+
+    bool empty() const {return item_list.size() == 0;}
+    std::size_t size() const {return item_list.size();}
+    void clear() {item_list.clear();}
+};
+
+/**
+ * @brief Rounds the requested capacity of a ring up to a power of two, so that indices can be wrapped with a mask.
+ * @param capacity Requested capacity [at least 1].
+ * @return The rounded capacity.
+ */
+inline std::size_t ring_capacity(std::size_t capacity) {
+    if (capacity == 0)
+        throw std::invalid_argument("A ring buffer must hold at least one value");
+
+    std::size_t rounded = 1;
+    while (rounded < capacity)
+        rounded <<= 1;
+    return rounded;
+}
+
+/*!
+ * @class spsc_queue
+ * @brief Bounded wait-free queue for exactly one producer thread and one consumer thread.
+ *
+ * @details Values live in a ring buffer, and the two sides only share a head index (written by the consumer) and a tail index (written by the producer), each on it's own cache line.
+ * Each side also keeps a private copy of the other side's index, and only re-reads the shared one when the copy says that the ring is full (or empty), so most operations touch no shared cache line besides their own.
+ * Every operation finishes in a bounded amount of steps, nobody ever waits for the other side.
+ *
+ * @note Only one thread may push, and only one thread may pop. Use mpmc_queue for anything else.
+ *
+ * @fn try_push(const T& dt)
+ * @fn try_push(T&& dt)
+ * @fn try_emplace(Args&&... args)
+ * @fn try_pop(T& out)
+ * @fn try_push_n(InputIt first, std::size_t n)
+ * @fn try_pop_n(OutputIt out, std::size_t n)
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the ring buffer
+ */
+template <class T, class Alloc = std::allocator<T>>
+class spsc_queue {
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    Alloc alloc;                /**< Allocator which owns the ring*/
+    const std::size_t cap;      /**< Amount of slots in the ring [a power of two]*/
+    const std::size_t mask;     /**< cap - 1, wraps an index onto a slot*/
+    T* ring;                    /**< Slots, only the ones between head and tail hold a constructed value*/
+
+    alignas(64) std::atomic<std::size_t> head;  /**< Next slot to pop [written by the consumer]*/
+    std::size_t cached_tail;                    /**< Consumer's copy of tail*/
+
+    alignas(64) std::atomic<std::size_t> tail;  /**< Next slot to push into [written by the producer]*/
+    std::size_t cached_head;                    /**< Producer's copy of head*/
+
+    /**
+     * @brief Returns how many slots the producer can fill right now, re-reading head only if the cached copy isn't enough.
+     * @param t Current tail.
+     * @param wanted Amount of slots the producer would like.
+     */
+    std::size_t free_slots(std::size_t t, std::size_t wanted);
+
+    /**
+     * @brief Returns how many values the consumer can take right now, re-reading tail only if the cached copy isn't enough.
+     * @param h Current head.
+     * @param wanted Amount of values the consumer would like.
+     */
+    std::size_t ready_values(std::size_t h, std::size_t wanted);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Creates an empty queue.
+     * @param capacity Amount of values the queue can hold, rounded up to a power of two.
+     */
+    explicit spsc_queue(std::size_t capacity)
+        : alloc{}, cap{ring_capacity(capacity)}, mask{cap - 1}, ring{alloc_traits::allocate(alloc, cap)},
+          head{0}, cached_tail{0}, tail{0}, cached_head{0} { }
+
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+
+    /**
+     * @brief Destroys the values which were never popped, and frees the ring.
+     */
+    ~spsc_queue();
+
+    /**
+     * @brief Constructs a value in place at the back of the queue, unless it's full. Producer only.
+     * @param args Arguments forwarded to T's constructor.
+     * @return true if the value was pushed, false if the queue was full.
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_push(const T& dt) {return try_emplace(dt);}
+    bool try_push(T&& dt) {return try_emplace(std::move(dt));}
+
+    /**
+     * @brief Pops the value from the front of the queue, unless it's empty. Consumer only.
+     * @param out Where the popped value is moved to.
+     * @return true if a value was popped, false if the queue was empty.
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Pushes as many of the next n values as fit, and publishes them all at once. Producer only.
+     * @param first Iterator to the first value.
+     * @param n Amount of values to push.
+     * @return Amount of values which were pushed [the first ones of the range].
+     */
+    template <class InputIt>
+    std::size_t try_push_n(InputIt first, std::size_t n);
+
+    /**
+     * @brief Pops up to n values, and hands all of their slots back at once. Consumer only.
+     * @param out Iterator to write the values to.
+     * @param n Most values to pop.
+     * @return Amount of values which were popped.
+     */
+    template <class OutputIt>
+    std::size_t try_pop_n(OutputIt out, std::size_t n);
+
+    /**
+     * @brief Returns the amount of values in the queue [a snapshot, when called while the other side is running].
+     */
+    std::size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {return size() == 0;}
+    std::size_t capacity() const {return cap;}
+};
+
+template <class T, class Alloc>
+std::size_t spsc_queue<T, Alloc>::free_slots(std::size_t t, std::size_t wanted) {
+    std::size_t available = cap - (t - cached_head);
+    if (available < wanted) {
+        cached_head = head.load(std::memory_order_acquire);
+        available = cap - (t - cached_head);
+    }
+    return available < wanted ? available : wanted;
+}
+
+template <class T, class Alloc>
+std::size_t spsc_queue<T, Alloc>::ready_values(std::size_t h, std::size_t wanted) {
+    std::size_t available = cached_tail - h;
+    if (available < wanted) {
+        cached_tail = tail.load(std::memory_order_acquire);
+        available = cached_tail - h;
+    }
+    return available < wanted ? available : wanted;
+}
+
+template <class T, class Alloc>
+template <class... Args>
+bool spsc_queue<T, Alloc>::try_emplace(Args&&... args) {
+    const std::size_t t = tail.load(std::memory_order_relaxed);
+    if (free_slots(t, 1) == 0)
+        return false;
+
+    alloc_traits::construct(alloc, ring + (t & mask), std::forward<Args>(args)...);
+    // Release hands the constructed value over to the consumer
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T, class Alloc>
+bool spsc_queue<T, Alloc>::try_pop(T& out) {
+    const std::size_t h = head.load(std::memory_order_relaxed);
+    if (ready_values(h, 1) == 0)
+        return false;
+
+    T* slot = ring + (h & mask);
+    out = std::move(*slot);
+    alloc_traits::destroy(alloc, slot);
+    // Release hands the slot back to the producer
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T, class Alloc>
+template <class InputIt>
+std::size_t spsc_queue<T, Alloc>::try_push_n(InputIt first, std::size_t n) {
+    const std::size_t t = tail.load(std::memory_order_relaxed);
+    const std::size_t count = free_slots(t, n);
+
+    // One store publishes the whole batch
+    std::size_t pushed = 0;
+    try {
+        for (; pushed < count; ++pushed, ++first)
+            alloc_traits::construct(alloc, ring + ((t + pushed) & mask), *first);
+    }
+    catch (...) {
+        tail.store(t + pushed, std::memory_order_release);
+        throw;
+    }
+    tail.store(t + count, std::memory_order_release);
+    return count;
+}
+
+template <class T, class Alloc>
+template <class OutputIt>
+std::size_t spsc_queue<T, Alloc>::try_pop_n(OutputIt out, std::size_t n) {
+    const std::size_t h = head.load(std::memory_order_relaxed);
+    const std::size_t count = ready_values(h, n);
+
+    for (std::size_t i = 0; i < count; ++i, ++out) {
+        T* slot = ring + ((h + i) & mask);
+        *out = std::move(*slot);
+        alloc_traits::destroy(alloc, slot);
+    }
+    head.store(h + count, std::memory_order_release);
+    return count;
+}
+
+template <class T, class Alloc>
+spsc_queue<T, Alloc>::~spsc_queue() {
+    const std::size_t t = tail.load(std::memory_order_relaxed);
+    for (std::size_t h = head.load(std::memory_order_relaxed); h != t; ++h)
+        alloc_traits::destroy(alloc, ring + (h & mask));
+    alloc_traits::deallocate(alloc, ring, cap);
+}
+
+/*!
+ * @class mpmc_queue
+ * @brief Bounded lock-free queue for any amount of producer and consumer threads.
+ *
+ * @details Values live in a ring buffer of cells, and every cell carries a sequence number, which says whose turn it is: the cell at position pos can be pushed into when it's sequence is pos,
+ * and popped from when it's sequence is pos + 1. A thread claims a position by moving the shared push (or pop) counter forward with compare-and-swap, and then works on the cell without any further synchronization,
+ * so threads only ever contend on the counters, and never on each other's cells. [Dmitry Vyukov's bounded MPMC queue]
+ *
+ * @note Once a position is claimed, constructing (or moving out) the value must not throw, or that cell stays claimed forever.
+ *
+ * @fn try_push(const T& dt)
+ * @fn try_push(T&& dt)
+ * @fn try_emplace(Args&&... args)
+ * @fn try_pop(T& out)
+ * @fn try_push_n(InputIt first, std::size_t n)
+ * @fn try_pop_n(OutputIt out, std::size_t n)
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the ring buffer, rebound to the cell type
+ */
+template <class T, class Alloc = std::allocator<T>>
+class mpmc_queue {
+private:
+    /**< A slot of the ring, and the sequence number which says what may be done with it*/
+    struct cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() {return reinterpret_cast<T*>(storage);}
+    };
+
+    using cell_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<cell>;
+    using cell_traits = std::allocator_traits<cell_allocator>;
+
+    cell_allocator alloc;       /**< Allocator which owns the ring*/
+    const std::size_t cap;      /**< Amount of cells in the ring [a power of two]*/
+    const std::size_t mask;     /**< cap - 1, wraps a position onto a cell*/
+    cell* ring;                 /**< The cells*/
+
+    alignas(64) std::atomic<std::size_t> push_pos;  /**< Next position to push into*/
+    alignas(64) std::atomic<std::size_t> pop_pos;   /**< Next position to pop from*/
+
+    /**
+     * @brief Claims up to n consecutive positions, whose cells are in the provided state.
+     * @param counter push_pos or pop_pos.
+     * @param n Most positions to claim.
+     * @param ahead 0 when pushing [cells must be empty], 1 when popping [cells must be full].
+     * @param first Set to the first claimed position.
+     * @return Amount of claimed positions [0 if the queue was full, or empty].
+     */
+    std::size_t claim(std::atomic<std::size_t>& counter, std::size_t n, std::size_t ahead, std::size_t& first);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Creates an empty queue.
+     * @param capacity Amount of values the queue can hold, rounded up to a power of two.
+     */
+    explicit mpmc_queue(std::size_t capacity);
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    /**
+     * @brief Destroys the values which were never popped, and frees the ring.
+     */
+    ~mpmc_queue();
+
+    /**
+     * @brief Constructs a value in place at the back of the queue, unless it's full.
+     * @param args Arguments forwarded to T's constructor.
+     * @return true if the value was pushed, false if the queue was full.
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_push(const T& dt) {return try_emplace(dt);}
+    bool try_push(T&& dt) {return try_emplace(std::move(dt));}
+
+    /**
+     * @brief Pops the value from the front of the queue, unless it's empty.
+     * @param out Where the popped value is moved to.
+     * @return true if a value was popped, false if the queue was empty.
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Claims as many positions as are free (up to n) with a single compare-and-swap, and pushes the next values into them.
+     * @param first Iterator to the first value.
+     * @param n Amount of values to push.
+     * @return Amount of values which were pushed [the first ones of the range].
+     */
+    template <class InputIt>
+    std::size_t try_push_n(InputIt first, std::size_t n);
+
+    /**
+     * @brief Claims as many positions as are full (up to n) with a single compare-and-swap, and pops their values.
+     * @param out Iterator to write the values to.
+     * @param n Most values to pop.
+     * @return Amount of values which were popped.
+     */
+    template <class OutputIt>
+    std::size_t try_pop_n(OutputIt out, std::size_t n);
+
+    std::size_t capacity() const {return cap;}
+};
+
+template <class T, class Alloc>
+mpmc_queue<T, Alloc>::mpmc_queue(std::size_t capacity)
+    : alloc{}, cap{ring_capacity(capacity)}, mask{cap - 1}, ring{cell_traits::allocate(alloc, cap)}, push_pos{0}, pop_pos{0} {
+    // Every cell starts out empty, waiting for the push of it's own position
+    for (std::size_t i = 0; i < cap; ++i)
+        cell_traits::construct(alloc, ring + i);
+    for (std::size_t i = 0; i < cap; ++i)
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <class T, class Alloc>
+mpmc_queue<T, Alloc>::~mpmc_queue() {
+    // A cell holds a value when it's sequence is one past it's position
+    const std::size_t end = push_pos.load(std::memory_order_relaxed);
+    for (std::size_t pos = pop_pos.load(std::memory_order_relaxed); pos != end; ++pos)
+        ring[pos & mask].value()->~T();
+
+    for (std::size_t i = 0; i < cap; ++i)
+        cell_traits::destroy(alloc, ring + i);
+    cell_traits::deallocate(alloc, ring, cap);
+}
+
+template <class T, class Alloc>
+std::size_t mpmc_queue<T, Alloc>::claim(std::atomic<std::size_t>& counter, std::size_t n, std::size_t ahead, std::size_t& first) {
+    std::size_t pos = counter.load(std::memory_order_relaxed);
+
+    while (true) {
+        // Count how many cells in a row are ready for us
+        std::size_t count = 0;
+        while (count < n) {
+            const std::size_t sequence = ring[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+            if (sequence != pos + count + ahead)
+                break;
+            ++count;
+        }
+
+        if (count == 0) {
+            // Not our turn yet at the very first cell, so the queue is full (or empty)...
+            const std::size_t sequence = ring[pos & mask].sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (pos + ahead));
+            if (diff < 0)
+                return 0;
+            // ...or another thread already took this position, and the counter moved on
+            pos = counter.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Nobody else can touch a cell before it's position is claimed, so the ones we counted stay ready
+        if (counter.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            first = pos;
+            return count;
+        }
+    }
+}
+
+template <class T, class Alloc>
+template <class... Args>
+bool mpmc_queue<T, Alloc>::try_emplace(Args&&... args) {
+    std::size_t pos;
+    if (claim(push_pos, 1, 0, pos) == 0)
+        return false;
+
+    cell& c = ring[pos & mask];
+    ::new (static_cast<void*>(c.storage)) T(std::forward<Args>(args)...);
+    // The value is ready to be popped
+    c.sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T, class Alloc>
+bool mpmc_queue<T, Alloc>::try_pop(T& out) {
+    std::size_t pos;
+    if (claim(pop_pos, 1, 1, pos) == 0)
+        return false;
+
+    cell& c = ring[pos & mask];
+    out = std::move(*c.value());
+    c.value()->~T();
+    // The cell is free for the push one lap later
+    c.sequence.store(pos + cap, std::memory_order_release);
+    return true;
+}
+
+template <class T, class Alloc>
+template <class InputIt>
+std::size_t mpmc_queue<T, Alloc>::try_push_n(InputIt first, std::size_t n) {
+    if (n == 0)
+        return 0;
+
+    std::size_t pos;
+    const std::size_t count = claim(push_pos, n, 0, pos);
+    for (std::size_t i = 0; i < count; ++i, ++first) {
+        cell& c = ring[(pos + i) & mask];
+        ::new (static_cast<void*>(c.storage)) T(*first);
+        c.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+template <class T, class Alloc>
+template <class OutputIt>
+std::size_t mpmc_queue<T, Alloc>::try_pop_n(OutputIt out, std::size_t n) {
+    if (n == 0)
+        return 0;
+
+    std::size_t pos;
+    const std::size_t count = claim(pop_pos, n, 1, pos);
+    for (std::size_t i = 0; i < count; ++i, ++out) {
+        cell& c = ring[(pos + i) & mask];
+        *out = std::move(*c.value());
+        c.value()->~T();
+        c.sequence.store(pos + i + cap, std::memory_order_release);
+    }
+    return count;
+}
+
+#endif // QUEUE_H
@@ -0,0 +1,843 @@
+/**
+ * @file skip_list.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines skip lists: an ordered set, and an indexable sequence with O(log n) positional insertion and removal
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <class T, bool Indexed>
+class skip_node;
+
+/**< A forward link of a skip_node on one level*/
+template <class T, bool Indexed>
+struct skip_link {
+    skip_node<T, Indexed>* next;
+};
+
+/**< A forward link of an indexable skip_node, which also knows how many positions it skips*/
+template <class T>
+struct skip_link<T, true> {
+    skip_node<T, true>* next;
+    std::size_t width;          /**< Position of next, minus the position of the node the link belongs to [meaningless if next is nullptr]*/
+};
+
+/*!
+ * @class skip_node
+ * @brief Skip List Node class.
+ *
+ * @details Like node, it links forward, but it has a tower of height links instead of one: link 0 goes to the very next node, and link i skips over every node which is shorter than i + 1.
+ * The links are stored right behind the node, in the same allocation, so a node is as big as it's own tower.
+ *
+ * @fn get_data()
+ * @fn get_next()
+ * @fn get_height()
+ * @tparam T typename
+ * @tparam Indexed true if the links carry their widths
+ */
+template <class T, bool Indexed>
+class alignas(T) alignas(skip_link<T, Indexed>) skip_node {
+public:
+    using link_type = skip_link<T, Indexed>;
+
+    /**
+     * Creates a node with a tower of the provided height, and constructs it's data in place. The links have to be constructed by whoever allocated the node.
+     * @brief Emplacing constructor.
+     */
+    template <class... Args>
+    explicit skip_node(std::size_t h, std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), height{static_cast<std::uint8_t>(h)} { }
+
+    skip_node(const skip_node&) = delete;
+    skip_node& operator=(const skip_node&) = delete;
+
+    T& get_data() {return data;}
+    const T& get_data() const {return data;}
+
+    /**
+     * @brief Returns the next node on the lowest level [nullptr for the last node].
+     */
+    skip_node* get_next() const {return links()[0].next;}
+
+    std::size_t get_height() const {return height;}
+
+    /**
+     * @brief Returns the tower of links, which sits right behind the node.
+     */
+    link_type* links() const {
+        return std::launder(reinterpret_cast<link_type*>(const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(this)) + sizeof(skip_node)));
+    }
+
+private:
+    T data;                 /**< Data that this node contains*/
+    std::uint8_t height;    /**< Amount of links in the tower*/
+};
+
+/*!
+ * @class basic_skip_list
+ * @brief Skip list base class, which owns the nodes and the head tower of a skip_list or an indexed_skip_list.
+ *
+ * @details Every node gets a random height, where every level is 4 times rarer than the one under it, so a search drops one level about every 4 steps, and takes O(log n) steps in total.
+ * Use skip_list and indexed_skip_list, rather than this class directly.
+ *
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes, rebound to skip_node<T, Indexed>
+ * @tparam Indexed true if the links carry their widths
+ */
+template <class T, class Alloc, bool Indexed>
+class basic_skip_list {
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using node_type = skip_node<T, Indexed>;
+
+    /*!
+     * @class basic_iterator
+     * @brief Forward iterator over the values of a skip list, which walks the lowest level.
+     * @tparam IsConst true for a read-only iterator
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        basic_iterator()
+            : nd{nullptr} { }
+
+        explicit basic_iterator(node_type* const n)
+            : nd{n} { }
+
+        /**
+         * @brief Allows an iterator to be used wherever a const_iterator is expected.
+         */
+        template <bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+        basic_iterator(const basic_iterator<WasConst>& it)
+            : nd{it.get_node()} { }
+
+        reference operator*() const {return nd->get_data();}
+        pointer operator->() const {return &nd->get_data();}
+
+        basic_iterator& operator++() {
+            nd = nd->get_next();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {return a.nd == b.nd;}
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {return a.nd != b.nd;}
+
+        node_type* get_node() const {return nd;}
+
+    private:
+        node_type* nd;  /**< Current node [nullptr past the end]*/
+    };
+
+    using const_iterator = basic_iterator<true>;
+
+    /**< Highest tower a node can get*/
+    static constexpr std::size_t max_height = 32;
+
+protected:
+    using link_type = skip_link<T, Indexed>;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    node_allocator alloc;               /**< Allocator which creates and frees every node*/
+    link_type head[max_height];         /**< Tower of the head, which is as tall as the tallest node*/
+    std::size_t levels;                 /**< Amount of levels in use*/
+    std::size_t len;                    /**< Amount of values*/
+    std::uint64_t seed;                 /**< State of the height generator*/
+
+    explicit basic_skip_list(const Alloc& allocator)
+        : alloc{allocator}, head{}, levels{1}, len{0}, seed{0x9E3779B97F4A7C15ull} { }
+
+    basic_skip_list(const basic_skip_list& list)
+        : alloc{node_traits::select_on_container_copy_construction(list.alloc)}, head{}, levels{1}, len{0}, seed{list.seed} { }
+
+    basic_skip_list(basic_skip_list&& list) noexcept
+        : alloc{std::move(list.alloc)}, levels{list.levels}, len{list.len}, seed{list.seed} {
+        take_over(list);
+    }
+
+    ~basic_skip_list() {clear();}
+
+    /**
+     * @brief Frees our nodes, and takes over the nodes of another list, which is left empty.
+     */
+    void move_from(basic_skip_list& list) {
+        clear();
+        alloc = std::move(list.alloc);
+        levels = list.levels;
+        len = list.len;
+        seed = list.seed;
+        take_over(list);
+    }
+
+    /**
+     * @brief Returns the links of a node [the head tower for nullptr].
+     */
+    link_type* links_of(node_type* nd) {return nd == nullptr ? head : nd->links();}
+    const link_type* links_of(node_type* nd) const {return nd == nullptr ? head : nd->links();}
+
+    /**
+     * @brief Picks the height of a new node: 1, plus one for every pair of zero bits at the bottom of a random number.
+     */
+    std::size_t random_height();
+
+    template <class... Args>
+    node_type* create_node(std::size_t height, Args&&... args);
+    void destroy_node(node_type* nd);
+
+private:
+    void take_over(basic_skip_list& list) {
+        for (std::size_t i = 0; i < max_height; ++i) {
+            head[i] = list.head[i];
+            list.head[i] = link_type{};
+        }
+        list.levels = 1;
+        list.len = 0;
+    }
+
+public:
+    basic_skip_list& operator=(const basic_skip_list&) = delete;
+
+    std::size_t size() const {return len;}
+    bool empty() const {return len == 0;}
+
+    /**
+     * @brief Returns the first node [nullptr if the list is empty].
+     */
+    node_type* get_head() const {return head[0].next;}
+
+    const_iterator begin() const {return const_iterator(head[0].next);}
+    const_iterator cbegin() const {return begin();}
+    const_iterator end() const {return const_iterator(nullptr);}
+    const_iterator cend() const {return end();}
+
+    /**
+     * @brief Frees every node, leaving the list empty.
+     */
+    void clear();
+
+    allocator_type get_allocator() const {return allocator_type(alloc);}
+};
+
+/*!
+ * @class skip_list
+ * @brief Ordered set class, built on a skip list.
+ *
+ * @details Stores unique values in sorted order, like a bst without duplicates, and finds, inserts and removes them in O(log n) expected time, without any rebalancing.
+ * Every change only relinks the towers of a single node, which is why a skip list is the easier ordered structure to make concurrent (see concurrent_skip_list).
+ *
+ * @fn insert(const T& dt)
+ * @fn emplace(Args&&... args)
+ * @fn find(const T& dt)
+ * @fn contains(const T& dt)
+ * @fn remove(const T& dt)
+ * @fn min()
+ * @fn max()
+ * @fn successor(const T& dt)
+ * @fn predecessor(const T& dt)
+ * @fn lower_bound(const T& dt)
+ * @fn upper_bound(const T& dt)
+ * @fn for_each_in_range(const T& lo, const T& hi, Visitor visit)
+ * @tparam T typename
+ * @tparam Compare Ordering of the values
+ * @tparam Alloc Allocator used for the nodes, rebound to skip_node<T, false>
+ */
+template <class T, class Compare = std::less<T>, class Alloc = std::allocator<T>>
+class skip_list : public basic_skip_list<T, Alloc, false> {
+private:
+    using base = basic_skip_list<T, Alloc, false>;
+    using typename base::link_type;
+    using base::head;
+    using base::levels;
+    using base::len;
+
+    Compare comp;   /**< Ordering of the values*/
+
+    /**
+     * @brief Finds the last node before dt on every level [nullptr for the head], and returns the last one on the lowest level.
+     */
+    skip_node<T, false>* find_predecessors(const T& dt, skip_node<T, false>** before) const;
+
+    /**
+     * @brief Returns the first node which isn't smaller than dt [or, if strict, the first one which is larger].
+     */
+    skip_node<T, false>* first_not_before(const T& dt, bool strict) const;
+
+    /**
+     * @brief Links a node after the provided predecessors.
+     */
+    void link_node(skip_node<T, false>* nd, skip_node<T, false>** before);
+
+public:
+    using typename base::const_iterator;
+    using iterator = const_iterator;
+
+    /**
+     * Creates an empty set.
+     * @brief Default constructor.
+     */
+    explicit skip_list(const Compare& compare = Compare(), const Alloc& allocator = Alloc())
+        : base{allocator}, comp{compare} { }
+
+    /**
+     * Creates a copy of a set, in O(n), since the values are already sorted.
+     * @brief Copy constructor.
+     */
+    skip_list(const skip_list& list);
+
+    skip_list(skip_list&& list) noexcept
+        : base{std::move(list)}, comp{list.comp} { }
+
+    skip_list& operator=(const skip_list& list) {
+        if (this != &list) {
+            skip_list copy(list);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    skip_list& operator=(skip_list&& list) noexcept {
+        if (this != &list) {
+            this->move_from(list);
+            comp = list.comp;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Inserts a value, unless an equal one is in the set already.
+     * @return The node which holds the value [the old one, if nothing was inserted].
+     */
+    skip_node<T, false>* insert(const T& dt) {return emplace(dt);}
+    skip_node<T, false>* insert(T&& dt) {return emplace(std::move(dt));}
+
+    template <class... Args>
+    skip_node<T, false>* emplace(Args&&... args);
+
+    /**
+     * @brief Returns the node which holds the provided value [nullptr if there is none].
+     */
+    skip_node<T, false>* find(const T& dt) const {
+        skip_node<T, false>* nd = first_not_before(dt, false);
+        return (nd != nullptr && !comp(dt, nd->get_data())) ? nd : nullptr;
+    }
+
+    bool contains(const T& dt) const {return find(dt) != nullptr;}
+
+    /**
+     * @brief Removes the provided value.
+     * @return The node which came after the removed one [nullptr if it was the largest one, or if nothing was removed].
+     */
+    skip_node<T, false>* remove(const T& dt);
+
+    /**
+     * @brief Returns the node with the smallest value [nullptr if the set is empty].
+     */
+    skip_node<T, false>* min() const {return head[0].next;}
+
+    /**
+     * @brief Returns the node with the largest value [nullptr if the set is empty], by walking down the towers in O(log n).
+     */
+    skip_node<T, false>* max() const;
+
+    /**
+     * @brief Returns the node with the smallest value, which is larger than dt [nullptr if there is none].
+     */
+    skip_node<T, false>* successor(const T& dt) const {return first_not_before(dt, true);}
+
+    /**
+     * @brief Returns the node with the largest value, which is smaller than dt [nullptr if there is none].
+     */
+    skip_node<T, false>* predecessor(const T& dt) const;
+
+    const_iterator lower_bound(const T& dt) const {return const_iterator(first_not_before(dt, false));}
+    const_iterator upper_bound(const T& dt) const {return const_iterator(first_not_before(dt, true));}
+    std::pair<const_iterator, const_iterator> equal_range(const T& dt) const {return {lower_bound(dt), upper_bound(dt)};}
+
+    /**
+     * @brief Calls visit(value) for every value in [lo, hi), in order, in O(log n + k).
+     */
+    template <class Visitor>
+    void for_each_in_range(const T& lo, const T& hi, Visitor visit) const {
+        for (skip_node<T, false>* nd = first_not_before(lo, false); nd != nullptr && comp(nd->get_data(), hi); nd = nd->get_next())
+            visit(static_cast<const T&>(nd->get_data()));
+    }
+};
+
+/*!
+ * @class indexed_skip_list
+ * @brief Sequence class with the interface of dl_list, built on a skip list, where every link knows how many positions it skips.
+ *
+ * @details A walk to index i only takes a link if it doesn't overshoot i, so it takes O(log n) steps instead of i, and insert_node(), erase() and operator[] are all O(log n) expected.
+ * That's what sl_list::insert_node() and dl_list::insert_node() can't do, since they have to count every node from the head.
+ *
+ * @fn push_front(const T& dt)
+ * @fn push_back(const T& dt)
+ * @fn insert_node(const T& dt, unsigned int idx)
+ * @fn erase(unsigned int idx)
+ * @fn pop_front()
+ * @fn pop_back()
+ * @fn operator[](unsigned int idx)
+ * @fn at(unsigned int idx)
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes, rebound to skip_node<T, true>
+ */
+template <class T, class Alloc = std::allocator<T>>
+class indexed_skip_list : public basic_skip_list<T, Alloc, true> {
+private:
+    using base = basic_skip_list<T, Alloc, true>;
+    using typename base::link_type;
+    using base::head;
+    using base::levels;
+    using base::len;
+
+    skip_node<T, true>* tail;   /**< Last node, so push_back() doesn't have to search*/
+
+    /**
+     * @brief Returns the node at position pos [counting from 1, the head is 0].
+     */
+    skip_node<T, true>* node_at(std::size_t pos) const;
+
+    template <class... Args>
+    T& emplace_at(std::size_t idx, Args&&... args);
+
+public:
+    using typename base::const_iterator;
+    using iterator = typename base::template basic_iterator<false>;
+
+    /**
+     * Creates an empty sequence.
+     * @brief Default constructor.
+     */
+    explicit indexed_skip_list(const Alloc& allocator = Alloc())
+        : base{allocator}, tail{nullptr} { }
+
+    /**
+     * Creates a copy of a sequence, in O(n).
+     * @brief Copy constructor.
+     */
+    indexed_skip_list(const indexed_skip_list& list);
+
+    indexed_skip_list(indexed_skip_list&& list) noexcept
+        : base{std::move(list)}, tail{list.tail} {
+        list.tail = nullptr;
+    }
+
+    indexed_skip_list& operator=(const indexed_skip_list& list) {
+        if (this != &list) {
+            indexed_skip_list copy(list);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    indexed_skip_list& operator=(indexed_skip_list&& list) noexcept {
+        if (this != &list) {
+            this->move_from(list);
+            tail = list.tail;
+            list.tail = nullptr;
+        }
+        return *this;
+    }
+
+    iterator begin() {return iterator(head[0].next);}
+    iterator end() {return iterator(nullptr);}
+    using base::begin;
+    using base::end;
+
+    T& push_back(const T& dt) {return emplace_at(len, dt);}
+    T& push_back(T&& dt) {return emplace_at(len, std::move(dt));}
+    template <class... Args>
+    T& emplace_back(Args&&... args) {return emplace_at(len, std::forward<Args>(args)...);}
+
+    T& push_front(const T& dt) {return emplace_at(0, dt);}
+    T& push_front(T&& dt) {return emplace_at(0, std::move(dt));}
+    template <class... Args>
+    T& emplace_front(Args&&... args) {return emplace_at(0, std::forward<Args>(args)...);}
+
+    /**
+     * Inserts a value into the index provided, in O(log n)
+     * @returns Reference to the new value
+     * @throws std::invalid_argument if idx isn't 0, and not smaller than size() [use push_back()]
+     */
+    T& insert_node(const T& dt, unsigned int idx) {
+        if (idx != 0 && idx >= len)
+            throw std::invalid_argument("Provided index exceeds list length. Use push_back().\n");
+        return emplace_at(idx, dt);
+    }
+    T& insert_node(T&& dt, unsigned int idx) {
+        if (idx != 0 && idx >= len)
+            throw std::invalid_argument("Provided index exceeds list length. Use push_back().\n");
+        return emplace_at(idx, std::move(dt));
+    }
+
+    /**
+     * Removes the value at the index provided, in O(log n)
+     * @throws std::out_of_range if idx >= size()
+     */
+    void erase(unsigned int idx);
+
+    /**
+     * Removes the value at the front [does nothing if the list is empty]
+     */
+    void pop_front() {
+        if (len != 0)
+            erase(0);
+    }
+
+    /**
+     * Removes the value at the end
+     * @throws std::invalid_argument if the list is empty
+     */
+    void pop_back() {
+        if (len == 0)
+            throw std::invalid_argument("Invalid removal. List length is 0.\n");
+        erase(static_cast<unsigned int>(len - 1));
+    }
+
+    T& front() {return head[0].next->get_data();}
+    const T& front() const {return head[0].next->get_data();}
+    T& back() {return tail->get_data();}
+    const T& back() const {return tail->get_data();}
+
+    T& operator[](unsigned int idx) {return node_at(std::size_t{idx} + 1)->get_data();}
+    const T& operator[](unsigned int idx) const {return node_at(std::size_t{idx} + 1)->get_data();}
+
+    /**
+     * Returns the value at the index provided, in O(log n)
+     * @throws std::out_of_range if idx >= size()
+     */
+    T& at(unsigned int idx) {
+        if (idx >= len)
+            throw std::out_of_range("Provided index exceeds list length.\n");
+        return (*this)[idx];
+    }
+    const T& at(unsigned int idx) const {return const_cast<indexed_skip_list&>(*this).at(idx);}
+
+    void clear() {
+        base::clear();
+        tail = nullptr;
+    }
+};
+
+template <class T, class Alloc, bool Indexed>
+std::size_t basic_skip_list<T, Alloc, Indexed>::random_height() {
+    // xorshift64*, it only has to be cheap and well spread in the low bits
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    std::uint64_t bits = seed * 0x2545F4914F6CDD1Dull;
+
+    std::size_t height = 1;
+    while (height < max_height && (bits & 3) == 0) {
+        ++height;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template <class T, class Alloc, bool Indexed>
+template <class... Args>
+typename basic_skip_list<T, Alloc, Indexed>::node_type* basic_skip_list<T, Alloc, Indexed>::create_node(std::size_t height, Args&&... args) {
+    // The node and it's tower come out of one allocation, counted in whole nodes
+    const std::size_t units = 1 + (height * sizeof(link_type) + sizeof(node_type) - 1) / sizeof(node_type);
+    node_type* nd = node_traits::allocate(alloc, units);
+    try {
+        node_traits::construct(alloc, nd, height, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, units);
+        throw;
+    }
+
+    link_type* tower = reinterpret_cast<link_type*>(reinterpret_cast<unsigned char*>(nd) + sizeof(node_type));
+    for (std::size_t i = 0; i < height; ++i)
+        ::new (static_cast<void*>(tower + i)) link_type{};
+    return nd;
+}
+
+template <class T, class Alloc, bool Indexed>
+void basic_skip_list<T, Alloc, Indexed>::destroy_node(node_type* nd) {
+    const std::size_t units = 1 + (nd->get_height() * sizeof(link_type) + sizeof(node_type) - 1) / sizeof(node_type);
+    node_traits::destroy(alloc, nd);
+    node_traits::deallocate(alloc, nd, units);
+}
+
+template <class T, class Alloc, bool Indexed>
+void basic_skip_list<T, Alloc, Indexed>::clear() {
+    node_type* nd = head[0].next;
+    while (nd != nullptr) {
+        node_type* next = nd->get_next();
+        destroy_node(nd);
+        nd = next;
+    }
+    for (std::size_t i = 0; i < max_height; ++i)
+        head[i] = link_type{};
+    levels = 1;
+    len = 0;
+}
+
+template <class T, class Compare, class Alloc>
+skip_list<T, Compare, Alloc>::skip_list(const skip_list& list)
+    : base{list}, comp{list.comp} {
+    // The values come in sorted, so every new node simply goes after the last one on each of it's levels
+    skip_node<T, false>* last[base::max_height] = {};
+    try {
+        for (skip_node<T, false>* src = list.head[0].next; src != nullptr; src = src->get_next()) {
+            skip_node<T, false>* nd = this->create_node(src->get_height(), src->get_data());
+            link_node(nd, last);
+            for (std::size_t i = 0; i < nd->get_height(); ++i)
+                last[i] = nd;
+        }
+    }
+    catch (...) {
+        this->clear();
+        throw;
+    }
+}
+
+template <class T, class Compare, class Alloc>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::find_predecessors(const T& dt, skip_node<T, false>** before) const {
+    skip_node<T, false>* nd = nullptr;
+    for (std::size_t i = levels; i-- > 0; ) {
+        for (skip_node<T, false>* next = this->links_of(nd)[i].next; next != nullptr && comp(next->get_data(), dt); next = this->links_of(nd)[i].next)
+            nd = next;
+        if (before != nullptr)
+            before[i] = nd;
+    }
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::first_not_before(const T& dt, bool strict) const {
+    // Walk down, staying in front of the first value that isn't smaller (or, if strict, larger)
+    skip_node<T, false>* nd = nullptr;
+    for (std::size_t i = levels; i-- > 0; ) {
+        while (true) {
+            skip_node<T, false>* next = this->links_of(nd)[i].next;
+            if (next == nullptr || (strict ? comp(dt, next->get_data()) : !comp(next->get_data(), dt)))
+                break;
+            nd = next;
+        }
+    }
+    return this->links_of(nd)[0].next;
+}
+
+template <class T, class Compare, class Alloc>
+void skip_list<T, Compare, Alloc>::link_node(skip_node<T, false>* nd, skip_node<T, false>** before) {
+    const std::size_t height = nd->get_height();
+    for (std::size_t i = levels; i < height; ++i)
+        before[i] = nullptr;
+    if (height > levels)
+        levels = height;
+
+    for (std::size_t i = 0; i < height; ++i) {
+        link_type* prev = this->links_of(before[i]);
+        nd->links()[i].next = prev[i].next;
+        prev[i].next = nd;
+    }
+    ++len;
+}
+
+template <class T, class Compare, class Alloc>
+template <class... Args>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::emplace(Args&&... args) {
+    skip_node<T, false>* nd = this->create_node(this->random_height(), std::forward<Args>(args)...);
+
+    skip_node<T, false>* before[base::max_height] = {};
+    skip_node<T, false>* prev = find_predecessors(nd->get_data(), before);
+    skip_node<T, false>* existing = this->links_of(prev)[0].next;
+    if (existing != nullptr && !comp(nd->get_data(), existing->get_data())) {
+        this->destroy_node(nd);
+        return existing;
+    }
+
+    link_node(nd, before);
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::remove(const T& dt) {
+    skip_node<T, false>* before[base::max_height] = {};
+    skip_node<T, false>* prev = find_predecessors(dt, before);
+    skip_node<T, false>* nd = this->links_of(prev)[0].next;
+    if (nd == nullptr || comp(dt, nd->get_data()))
+        return nullptr;
+
+    // Unlink the tower level by level, then drop the levels nobody uses anymore
+    for (std::size_t i = 0; i < nd->get_height(); ++i)
+        this->links_of(before[i])[i].next = nd->links()[i].next;
+    while (levels > 1 && head[levels - 1].next == nullptr)
+        --levels;
+
+    skip_node<T, false>* next = nd->get_next();
+    this->destroy_node(nd);
+    --len;
+    return next;
+}
+
+template <class T, class Compare, class Alloc>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::max() const {
+    skip_node<T, false>* nd = nullptr;
+    for (std::size_t i = levels; i-- > 0; )
+        while (this->links_of(nd)[i].next != nullptr)
+            nd = this->links_of(nd)[i].next;
+    return nd;
+}
+
+template <class T, class Compare, class Alloc>
+skip_node<T, false>* skip_list<T, Compare, Alloc>::predecessor(const T& dt) const {
+    return find_predecessors(dt, nullptr);
+}
+
+template <class T, class Alloc>
+indexed_skip_list<T, Alloc>::indexed_skip_list(const indexed_skip_list& list)
+    : base{list}, tail{nullptr} {
+    try {
+        for (const T& value : list)
+            push_back(value);
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <class T, class Alloc>
+skip_node<T, true>* indexed_skip_list<T, Alloc>::node_at(std::size_t pos) const {
+    skip_node<T, true>* nd = nullptr;
+    std::size_t at = 0;
+    for (std::size_t i = levels; i-- > 0; ) {
+        // Take a link only if it doesn't go past pos
+        while (true) {
+            const link_type& link = this->links_of(nd)[i];
+            if (link.next == nullptr || at + link.width > pos)
+                break;
+            at += link.width;
+            nd = link.next;
+        }
+        if (at == pos)
+            return nd;
+    }
+    return nd;
+}
+
+template <class T, class Alloc>
+template <class... Args>
+T& indexed_skip_list<T, Alloc>::emplace_at(std::size_t idx, Args&&... args) {
+    skip_node<T, true>* nd = this->create_node(this->random_height(), std::forward<Args>(args)...);
+    const std::size_t height = nd->get_height();
+    const std::size_t pos = idx + 1;
+
+    // On every level, find the last node before the new position, and how far along it is
+    skip_node<T, true>* before[base::max_height] = {};
+    std::size_t before_pos[base::max_height];
+    skip_node<T, true>* cur = nullptr;
+    std::size_t at = 0;
+    for (std::size_t i = levels; i-- > 0; ) {
+        while (true) {
+            const link_type& link = this->links_of(cur)[i];
+            if (link.next == nullptr || at + link.width >= pos)
+                break;
+            at += link.width;
+            cur = link.next;
+        }
+        before[i] = cur;
+        before_pos[i] = at;
+    }
+    for (std::size_t i = levels; i < height; ++i) {
+        before[i] = nullptr;
+        before_pos[i] = 0;
+        head[i] = link_type{};
+    }
+    if (height > levels)
+        levels = height;
+
+    for (std::size_t i = 0; i < levels; ++i) {
+        link_type& link = this->links_of(before[i])[i];
+        if (i < height) {
+            // Split the link around the new node
+            link_type& mine = nd->links()[i];
+            mine.next = link.next;
+            mine.width = (link.next != nullptr) ? before_pos[i] + link.width + 1 - pos : 0;
+            link.next = nd;
+            link.width = pos - before_pos[i];
+        }
+        else if (link.next != nullptr)
+            ++link.width;
+    }
+
+    if (nd->get_next() == nullptr)
+        tail = nd;
+    ++len;
+    return nd->get_data();
+}
+
+template <class T, class Alloc>
+void indexed_skip_list<T, Alloc>::erase(unsigned int idx) {
+    if (idx >= len)
+        throw std::out_of_range("Provided index exceeds list length.\n");
+    const std::size_t pos = std::size_t{idx} + 1;
+
+    skip_node<T, true>* before[base::max_height] = {};
+    skip_node<T, true>* cur = nullptr;
+    std::size_t at = 0;
+    for (std::size_t i = levels; i-- > 0; ) {
+        while (true) {
+            const link_type& link = this->links_of(cur)[i];
+            if (link.next == nullptr || at + link.width >= pos)
+                break;
+            at += link.width;
+            cur = link.next;
+        }
+        before[i] = cur;
+    }
+
+    skip_node<T, true>* nd = this->links_of(before[0])[0].next;
+    for (std::size_t i = 0; i < levels; ++i) {
+        link_type& link = this->links_of(before[i])[i];
+        if (link.next == nd) {
+            // Join the link with the one of the removed node
+            const link_type& mine = nd->links()[i];
+            link.width = (mine.next != nullptr) ? link.width + mine.width - 1 : 0;
+            link.next = mine.next;
+        }
+        else if (link.next != nullptr)
+            --link.width;
+    }
+    while (levels > 1 && head[levels - 1].next == nullptr)
+        --levels;
+
+    if (nd == tail)
+        tail = before[0];
+    this->destroy_node(nd);
+    --len;
+}
+
+#endif // SKIP_LIST_H
@@ -12,6 +12,12 @@
 
 #include "node.hpp"
 #include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /*!
  * @class sl_list
@@ -19,28 +25,117 @@
  * 
  * @details A Singly-linked list data structure class, which supports insertion, removal, and dynamic types. Due to being Singly-linked it can only be used with node<T>. See node.h on how to use them.
  * 
+ * Ownership: the list owns every node that is linked into it, and frees them when they are popped or when the list is destroyed.
+ * The value overloads (push_front(const T& dt) and friends) allocate exactly one node. The node-pointer overloads link the node they are given and take it over,
+ * so that node has to come from an allocator which is equal to the list's allocator (with the default std::allocator, that is a plain `new node<T>(...)`).
+ * 
+ * pop_back() needs the tail's predecessor, which singly-linked nodes don't have. The first pop_back() that needs one walks the list once and remembers the nodes in order (the spine),
+ * and from then on push_back(), pop_back() and pop_front() keep the spine up to date in O(1), so pop_back() is amortized O(1). The spine costs a pointer per node, and only exists once pop_back() was called.
+ * 
  * @fn get_head()
  * @fn set_head(node<T>* const nd)
+ * @fn get_tail()
  * 
  * @fn push_front(node<T>* const nd)
- * @fn push_front(const T dt)
+ * @fn push_front(const T& dt)
+ * @fn push_front(T&& dt)
+ * @fn emplace_front(Args&&... args)
  * @fn push_back(node<T>* const nd)
- * @fn push_back(const T dt)
+ * @fn push_back(const T& dt)
+ * @fn push_back(T&& dt)
+ * @fn emplace_back(Args&&... args)
  * @fn insert_node(node<T>* const nd)
- * @fn insert_node(const T dt)
+ * @fn insert_node(const T& dt)
+ * @fn insert_node(T&& dt)
  * 
  * @fn pop_front()
  * @fn pop_back()
  * 
+ * @fn begin()
+ * @fn end()
+ * 
  * @fn size()
+ * @fn clear()
+ * @fn get_allocator()
  * @tparam T class
+ * @tparam Alloc Allocator used for the nodes, rebound to node<T> (see node_pool.hpp for a pooled one)
  */
-template <class T>
+template <class T, class Alloc = std::allocator<T>>
 class sl_list {
 
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+
+    /*!
+     * @class basic_iterator
+     * @brief Forward iterator over the values of an sl_list.
+     * 
+     * @details Walks the node chain directly, so std algorithms and range-for work on the list without copying anything. Use iterator and const_iterator, rather than this class directly.
+     * @tparam IsConst true for a read-only iterator
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        basic_iterator()
+            : nd{nullptr} { }
+
+        explicit basic_iterator(node<T>* const n)
+            : nd{n} { }
+
+        /**
+         * @brief Allows an iterator to be used wherever a const_iterator is expected.
+         */
+        template <bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+        basic_iterator(const basic_iterator<WasConst>& it)
+            : nd{it.get_node()} { }
+
+        reference operator*() const {return nd->get_data();}
+        pointer operator->() const {return &nd->get_data();}
+
+        basic_iterator& operator++() {
+            nd = nd->get_next();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            nd = nd->get_next();
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {return a.nd == b.nd;}
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {return a.nd != b.nd;}
+
+        /**
+         * @brief Returns the node the iterator points to [nullptr for end()].
+         */
+        node<T>* get_node() const {return nd;}
+
+    private:
+        node<T>* nd;    /**< Current node [nullptr past the end]*/
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
 private:
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node<T>>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using spine_type = std::vector<node<T>*, typename std::allocator_traits<Alloc>::template rebind_alloc<node<T>*>>;
+
+    node_allocator alloc;   /**< Allocator which creates and frees every node of the list*/
     node<T>* head;      /**< Pointer to the head node [node<T>*]*/         
+    node<T>* tail;      /**< Pointer to the last node, kept in sync by every mutator [node<T>*]*/
     unsigned int len;   /**< List's length [unsigned int]*/
+    spine_type spine;           /**< The last nodes of the list in order, from spine[spine_first] up to the tail [empty until pop_back() needs it]*/
+    std::size_t spine_first;    /**< Index of the first node of spine that is still in the list*/
 
 public:
     /**
@@ -49,31 +144,85 @@ public:
      * @see sl_list(const sl_list& list)
      */
     sl_list() 
-        : head{nullptr}, len{0} { }
+        : sl_list{Alloc()} { }
+
+    /**
+     * Creates a new, empty sl-list, which will allocate it's nodes using the provided allocator
+     * @brief Constructor.
+     * @param allocator Allocator for the nodes
+     * @see sl_list()
+     */
+    explicit sl_list(const Alloc& allocator)
+        : alloc{allocator}, head{nullptr}, tail{nullptr}, len{0}, spine(allocator), spine_first{0} { }
 
     /**
-     * Constructs a new sl-list from another sl_list object
+     * Constructs a new sl-list from another sl_list object, by copying every value into new nodes
      * @brief Copy constructor.
      * @see sl_list()
      */
     sl_list(const sl_list& list);
 
+    /**
+     * Constructs a new sl-list by taking over the nodes of another sl_list object, which is left empty
+     * @brief Move constructor.
+     * @see sl_list(const sl_list& list)
+     */
+    sl_list(sl_list&& list) noexcept;
+
+    /**
+     * Replaces the list's values with copies of the values of another list
+     * @brief Copy assignment.
+     */
+    sl_list& operator=(const sl_list& list);
+
+    /**
+     * Frees the list's nodes and takes over the nodes of another list, which is left empty
+     * @brief Move assignment.
+     */
+    sl_list& operator=(sl_list&& list) noexcept;
+
+    /**
+     * Frees every node of the list
+     * @brief Destructor.
+     */
+    ~sl_list();
+
     /**
      * Adds a node with the provided value to the end of the list
+     * @note Runs in constant time, since the list keeps track of its tail
      * @param T node data
      * @returns The list's new tail
      * @see push_back(node<T>* const nd)
-     * @see push_front(T dt)
+     * @see push_front(const T& dt)
      * @see push_front(node<T>* const nd)
      * */     
-    node<T>* push_back(T dt);
+    node<T>* push_back(const T& dt);
+
+    /**
+     * Moves the provided value into a new node at the end of the list
+     * @param T node data
+     * @returns The list's new tail
+     * @see push_back(const T& dt)
+     * */     
+    node<T>* push_back(T&& dt);
+
+    /**
+     * Constructs a value in place, inside a new node at the end of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns The list's new tail
+     * @see push_back(const T& dt)
+     * @see emplace_front(Args&&... args)
+     * */     
+    template <class... Args>
+    node<T>* emplace_back(Args&&... args);
 
     /**
      * Adds a node with the to the end of the list
+     * @note The list takes ownership of the node and links it as is, no copies are made
      * @param nd Node to be added
      * @returns Thelist's new tail
-     * @see push_back(T dt)
-     * @see push_front(T dt)
+     * @see push_back(const T& dt)
+     * @see push_front(const T& dt)
      * @see push_front(node<T>* const nd)
      * */  
     node<T>* push_back(node<T>* const nd);
@@ -83,23 +232,43 @@ public:
      * @param T node data
      * @returns The list's new head
      * @see push_front(node<T>* const nd)
-     * @see push_back(T dt)
+     * @see push_back(const T& dt)
      * @see push_back(node<T>* const nd)
      * */  
-    node<T>* push_front(T dt);
+    node<T>* push_front(const T& dt);
+
+    /**
+     * Moves the provided value into a new node at the front of the list
+     * @param T node data
+     * @returns The list's new head
+     * @see push_front(const T& dt)
+     * */  
+    node<T>* push_front(T&& dt);
+
+    /**
+     * Constructs a value in place, inside a new node at the front of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns The list's new head
+     * @see push_front(const T& dt)
+     * @see emplace_back(Args&&... args)
+     * */  
+    template <class... Args>
+    node<T>* emplace_front(Args&&... args);
 
     /**
      * Adds a node with the to the front of the list
+     * @note The list takes ownership of the node and links it as is, no copies are made
      * @param nd Node to be added
      * @returns The list's new head
-     * @see push_front(T dt)
-     * @see push_back(T dt)
+     * @see push_front(const T& dt)
+     * @see push_back(const T& dt)
      * @see push_back(node<T>* const nd)
      * */  
     node<T>* push_front(node<T>* const nd);
 
     /**
      * Removes a node from the end of the list
+     * @note Amortized O(1): the first call walks the list once to build the spine, and later calls take the predecessor from it
      * @returns The list's last node
      * @see pop_front()
      * */  
@@ -115,16 +284,23 @@ public:
     /**
      * Returns the head of the sl_list
      * @returns Head node
-     * @see set_head(T dt)
+     * @see set_head(const T& dt)
      * @see set_head(node<T>* const nd)
      * */  
     node<T>* get_head() const; 
 
     /**
-     * Sets the provided node to be the list's head
-     * @note This may ruin the list, be careful. If you want to swap values, look at sl_list<T>::set_head(T dt)
+     * Returns the tail (last node) of the sl_list
+     * @returns Tail node [nullptr if the list is empty]
+     * @see get_head()
+     * */  
+    node<T>* get_tail() const;
+
+    /**
+     * Frees the current head, and links the provided node as the list's head
+     * @note The list takes ownership of the node. If you want to swap values, look at sl_list<T>::set_head(const T& dt)
      * @param nd Node to be the new head
-     * @see set_head(T dt)
+     * @see set_head(const T& dt)
      * @see get_head()
     */
     void set_head(node<T>* const nd);
@@ -135,10 +311,11 @@ public:
      * @see set_head(node<T>* const nd)
      * @see get_head()
     */
-    void set_head(T dt);
+    void set_head(const T& dt);
 
     /**
      * Inserts the Node into the index provided
+     * @note The list takes ownership of the node, unless an exception is thrown
      * @param nd Node to be inserted
      * @param idx Index where the Node will be inserted
      * @return Pointer to the Node that is behind the inserted Node
@@ -151,71 +328,289 @@ public:
      * @param idx Index where the Node will be inserted
      * @return Pointer to the Node that is behind the inserted Node 
      */
-    node<T>* insert_node(T dt, unsigned int idx);
+    node<T>* insert_node(const T& dt, unsigned int idx);
+
+    /** 
+     * Moves a value into the index provided
+     * @param dt Value to be inserted into the list
+     * @param idx Index where the Node will be inserted
+     * @return Pointer to the Node that is behind the inserted Node 
+     */
+    node<T>* insert_node(T&& dt, unsigned int idx);
 
     /**
      * Returns the length of the sl_list
      * @return Length of the singly-linked list
      * @see length()
      */
-    unsigned int size() {
+    unsigned int size() const {
         return len;
     }
+
+    /**
+     * Returns an iterator to the first value of the list
+     * @return Iterator to the head [end() if the list is empty]
+     * @see end()
+     */
+    iterator begin() {return iterator(head);}
+    const_iterator begin() const {return const_iterator(head);}
+    const_iterator cbegin() const {return const_iterator(head);}
+
+    /**
+     * Returns an iterator past the last value of the list
+     * @return Iterator which points to nothing
+     * @see begin()
+     */
+    iterator end() {return iterator(nullptr);}
+    const_iterator end() const {return const_iterator(nullptr);}
+    const_iterator cend() const {return const_iterator(nullptr);}
+
+    /**
+     * Frees every node of the list, leaving it empty
+     * @see ~sl_list()
+     */
+    void clear();
+
+    /**
+     * Returns a copy of the allocator used by the list
+     * @return The list's allocator
+     */
+    allocator_type get_allocator() const {
+        return allocator_type(alloc);
+    }
+
+private:
+    /**
+     * Allocates a node using the list's allocator, and constructs it's data in place
+     * @param args Arguments forwarded to T's constructor
+     * @return The new node
+     */
+    template <class... Args>
+    node<T>* create_node(Args&&... args);
+
+    /**
+     * Links an already created node to the front of the list
+     * @param nd Node to be linked
+     * @return The list's new head
+     */
+    node<T>* link_front(node<T>* const nd);
+
+    /**
+     * Links an already created node to the end of the list
+     * @param nd Node to be linked
+     * @return The list's new tail
+     */
+    node<T>* link_back(node<T>* const nd);
+
+    /**
+     * Destroys and deallocates a node, that was created by create_node()
+     * @param nd Node to be freed
+     */
+    void destroy_node(node<T>* const nd);
+
+    /**
+     * Returns how many nodes at the end of the list the spine holds
+     */
+    std::size_t spine_length() const {return spine.size() - spine_first;}
+
+    /**
+     * Rebuilds the spine from every node of the list, by walking it from the head
+     */
+    void build_spine();
+
+    /**
+     * Forgets the spine, the next pop_back() that needs it will build it again
+     */
+    void drop_spine() noexcept;
 };
 
-template <class T>
-sl_list<T>::sl_list(const sl_list& list) {
-    len = list.len;
-    head = list.head;
+template <class T, class Alloc>
+template <class... Args>
+node<T>* sl_list<T, Alloc>::create_node(Args&&... args) {
+    node<T>* nd = node_traits::allocate(alloc, 1);
+    try {
+        node_traits::construct(alloc, nd, std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(alloc, nd, 1);
+        throw;
+    }
+    return nd;
+}
+
+template <class T, class Alloc>
+void sl_list<T, Alloc>::destroy_node(node<T>* const nd) {
+    node_traits::destroy(alloc, nd);
+    node_traits::deallocate(alloc, nd, 1);
+}
+
+template <class T, class Alloc>
+void sl_list<T, Alloc>::build_spine() {
+    // Reserve first, so a failed allocation leaves the old spine alone
+    spine_type fresh(spine.get_allocator());
+    fresh.reserve(len);
+    for (node<T>* currNode = head; currNode != nullptr; currNode = currNode->get_next())
+        fresh.push_back(currNode);
+    spine = std::move(fresh);
+    spine_first = 0;
+}
+
+template <class T, class Alloc>
+void sl_list<T, Alloc>::drop_spine() noexcept {
+    spine.clear();
+    spine_first = 0;
+}
+
+template <class T, class Alloc>
+sl_list<T, Alloc>::sl_list(const sl_list& list)
+    : alloc{node_traits::select_on_container_copy_construction(list.alloc)}, head{nullptr}, tail{nullptr}, len{0}, spine(alloc), spine_first{0} {
+    // Copy every value into a node of our own
+    for (node<T>* currNode = list.head; currNode != nullptr; currNode = currNode->get_next())
+        emplace_back(currNode->get_data());
 };
 
-template <class T>
-node<T>* sl_list<T>::push_front(T dt) {
-    // Delagate action to more precise function
-    return push_front(new node<T>(dt));
+template <class T, class Alloc>
+sl_list<T, Alloc>::sl_list(sl_list&& list) noexcept
+    : alloc{std::move(list.alloc)}, head{list.head}, tail{list.tail}, len{list.len}, spine(std::move(list.spine)), spine_first{list.spine_first} {
+    list.head = list.tail = nullptr;
+    list.len = 0;
+    list.drop_spine();
 }
 
-template <class T>
-node<T>* sl_list<T>::push_front(node<T>* const nd) {
-    // Create new node to insert
-    node<T>* newNode = new node<T>();
+template <class T, class Alloc>
+sl_list<T, Alloc>& sl_list<T, Alloc>::operator=(const sl_list& list) {
+    if (this != &list) {
+        clear();
+        for (node<T>* currNode = list.head; currNode != nullptr; currNode = currNode->get_next())
+            emplace_back(currNode->get_data());
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+sl_list<T, Alloc>& sl_list<T, Alloc>::operator=(sl_list&& list) noexcept {
+    if (this != &list) {
+        // Our nodes have to be freed with our own allocator, before it gets replaced
+        clear();
+        alloc = std::move(list.alloc);
+        head = list.head;
+        tail = list.tail;
+        len = list.len;
+        list.head = list.tail = nullptr;
+        list.len = 0;
+        // The spine stays with the other list's allocator, ours gets rebuilt when pop_back() needs it
+        list.drop_spine();
+    }
+    return *this;
+}
+
+template <class T, class Alloc>
+sl_list<T, Alloc>::~sl_list() {
+    clear();
+}
+
+template <class T, class Alloc>
+void sl_list<T, Alloc>::clear() {
+    // Free the nodes front to back
+    while (head != nullptr) {
+        node<T>* temp = head;
+        head = head->get_next();
+        destroy_node(temp);
+    }
+    tail = nullptr;
+    len = 0;
+    drop_spine();
+}
 
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::link_front(node<T>* const nd) {
     // Make new head
-    newNode->set_data(nd->get_data());
-    newNode->set_next(head);
+    nd->set_next(head);
 
     // Replace old head with new
-    head = newNode;
+    head = nd;
+    // The first node of an empty list is also its last
+    if (tail == nullptr)
+        tail = nd;
     ++len;
 
     return head;
 }
 
-template <class T>
-node<T>* sl_list<T>::push_back(T dt) {
-    // Delagate action to more precise function
-    return push_back(new node<T>(dt));
-}
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::link_back(node<T>* const nd) {
+    nd->set_next(nullptr);
+
+    // Keep the spine ending at the tail. If it can't grow, it is rebuilt later instead of failing the push
+    if (spine_length() != 0) {
+        try {
+            spine.push_back(nd);
+        }
+        catch (...) {
+            drop_spine();
+        }
+    }
 
-template <class T>
-node<T>* sl_list<T>::push_back(node<T>* const nd) {
-    // Set pointer node
-    node<T>* currNode = head;
-    node<T>* newTail = new node<T>(nd->get_next(), nd->get_data());
-    // Traverse the list
-    while (currNode->get_next() != nullptr)
-        currNode = currNode->get_next();
-
-    // Add the Node to the end
-    currNode->set_next(newTail);
+    // Add the Node to the end, no traversal needed
+    if (tail == nullptr)
+        head = nd;
+    else
+        tail->set_next(nd);
+    tail = nd;
     ++len;
 
     // Return the new "tail"
-    return newTail;
+    return tail;
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_front(const T& dt) {
+    return emplace_front(dt);
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_front(T&& dt) {
+    return emplace_front(std::move(dt));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+node<T>* sl_list<T, Alloc>::emplace_front(Args&&... args) {
+    // The data is built directly inside of the node, no copies
+    return link_front(create_node(std::forward<Args>(args)...));
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_front(node<T>* const nd) {
+    // The node is ours now, so it gets linked as is
+    return link_front(nd);
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_back(const T& dt) {
+    return emplace_back(dt);
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_back(T&& dt) {
+    return emplace_back(std::move(dt));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+node<T>* sl_list<T, Alloc>::emplace_back(Args&&... args) {
+    // The data is built directly inside of the node, no copies
+    return link_back(create_node(std::forward<Args>(args)...));
 }
 
-template <class T>
-node<T>* sl_list<T>::pop_back() {
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::push_back(node<T>* const nd) {
+    // The node is ours now, so it gets linked as is
+    return link_back(nd);
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::pop_back() {
     // Error case
     if (len <= 0) {
         throw std::invalid_argument("Invalid removal. List length is 0.\n");
@@ -223,28 +618,30 @@ node<T>* sl_list<T>::pop_back() {
 
     else if (len == 1) {
         --len;
-        delete head;
+        destroy_node(head);
+        head = tail = nullptr;
+        drop_spine();
         return nullptr;
     }
 
-    // Set pointer node
-    node<T>* currNode = head;
-
-    // Traversing until the second-to-last list Node
-    while (currNode->get_next()->get_next() != nullptr)
-        currNode = currNode->get_next();
+    // The spine has to hold the tail's predecessor, only walk the list when it doesn't
+    if (spine_length() < 2)
+        build_spine();
+    spine.pop_back();
+    node<T>* currNode = spine.back();
 
     // Set last list member to null
-    delete(currNode->get_next());
+    destroy_node(tail);
     currNode->set_next(nullptr);
+    tail = currNode;
     --len;
 
     // Return the new last member
     return currNode;
 }
 
-template <class T>
-node<T>* sl_list<T>::pop_front() {
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::pop_front() {
     // Self-explanatory
     if (head == nullptr)
          return nullptr;
@@ -252,12 +649,25 @@ node<T>* sl_list<T>::pop_front() {
     // Move over head by one node, and return it
     node<T>* temp = head;
     head = head->get_next();
-    delete temp;
+    if (head == nullptr)
+        tail = nullptr;
+    // The head is only part of the spine when the spine covers the whole list
+    if (spine_length() == len)
+        ++spine_first;
+    if (spine_length() == 0)
+        drop_spine();
+    // Give back the popped part once it's half of the spine, or a queue would grow it forever
+    else if (spine_first > spine.size() / 2) {
+        spine.erase(spine.begin(), spine.begin() + static_cast<std::ptrdiff_t>(spine_first));
+        spine_first = 0;
+    }
+    destroy_node(temp);
+    --len;
     return head;
 }
 
-template <class T>
-node<T>* sl_list<T>::insert_node(node<T>* const nd, unsigned int idx) {
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::insert_node(node<T>* const nd, unsigned int idx) {
     // Delegate to push_front, since that's already implemented
     if (idx == 0) {
         this->push_front(nd);
@@ -279,6 +689,17 @@ node<T>* sl_list<T>::insert_node(node<T>* const nd, unsigned int idx) {
         ++counter;
     }
 
+    // An insert inside of the spine has to be mirrored by it, one before it doesn't change it
+    const std::size_t spine_start = len - spine_length();
+    if (spine_length() != 0 && idx > spine_start) {
+        try {
+            spine.insert(spine.begin() + static_cast<std::ptrdiff_t>(spine_first + (idx - spine_start)), nd);
+        }
+        catch (...) {
+            drop_spine();
+        }
+    }
+
     // Save tyhe next node
     node<T>* nextAfter = currentNode->get_next();
     // Insert node
@@ -289,24 +710,50 @@ node<T>* sl_list<T>::insert_node(node<T>* const nd, unsigned int idx) {
     return currentNode;
 }
 
-template <class T>
-node<T>* sl_list<T>::insert_node(const T dt, unsigned int idx) {
-    return insert_node(new node<T>(dt), idx);
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::insert_node(const T& dt, unsigned int idx) {
+    node<T>* nd = create_node(dt);
+    try {
+        return insert_node(nd, idx);
+    }
+    catch (...) {
+        // Out of range, the node never made it into the list
+        destroy_node(nd);
+        throw;
+    }
+}
+
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::insert_node(T&& dt, unsigned int idx) {
+    node<T>* nd = create_node(std::move(dt));
+    try {
+        return insert_node(nd, idx);
+    }
+    catch (...) {
+        // Out of range, the node never made it into the list
+        destroy_node(nd);
+        throw;
+    }
 }
 
-template <class T>
-node<T>* sl_list<T>::get_head() const {
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::get_head() const {
     return head;
 }
 
-template <class T>
-void sl_list<T>::set_head(node<T>* const nd) {
+template <class T, class Alloc>
+node<T>* sl_list<T, Alloc>::get_tail() const {
+    return tail;
+}
+
+template <class T, class Alloc>
+void sl_list<T, Alloc>::set_head(node<T>* const nd) {
     pop_front();
     push_front(nd);
 }
 
-template <class T> 
-void sl_list<T>::set_head(T dt) {
+template <class T, class Alloc>
+void sl_list<T, Alloc>::set_head(const T& dt) {
     head->set_data(dt);
 }
 
@@ -0,0 +1,481 @@
+/**
+ * @file sparse_matrix.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines compressed sparse matrix classes (CSR and CSC), and a coordinate list builder for them
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include "matrix.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <class T, bool RowMajor>
+class compressed_matrix;
+
+/*!
+ * @class coo_builder
+ * @brief Coordinate list (COO) builder for sparse matrices.
+ *
+ * @details Collects (row, column, value) triplets in any order, which is the easy way to assemble a sparse matrix incrementally. build() then sorts them into a CSR or CSC matrix in O(nnz + rows + cols),
+ * adding up the values of triplets which share a position.
+ *
+ * @fn add(std::size_t r, std::size_t c, const T& value)
+ * @fn build()
+ * @tparam T typename
+ */
+template <class T>
+class coo_builder {
+private:
+    /**< A single non-zero*/
+    struct triplet {
+        std::size_t row;
+        std::size_t col;
+        T value;
+    };
+
+    std::size_t n_rows;             /**< Amount of rows of the matrix being built*/
+    std::size_t n_cols;             /**< Amount of columns of the matrix being built*/
+    std::vector<triplet> entries;   /**< Triplets in the order they were added*/
+
+    template <class U, bool RowMajor>
+    friend class compressed_matrix;
+
+public:
+    /**
+     * @brief Creates a builder for a rows x cols matrix.
+     */
+    coo_builder(std::size_t rows, std::size_t cols)
+        : n_rows{rows}, n_cols{cols}, entries{} { }
+
+    /**
+     * @brief Adds a value at (r, c). Values added at the same position are summed.
+     * @throws std::out_of_range if (r, c) is outside of the matrix.
+     */
+    void add(std::size_t r, std::size_t c, const T& value) {
+        if (r >= n_rows || c >= n_cols)
+            throw std::out_of_range("Sparse matrix index out of range");
+        entries.push_back(triplet{r, c, value});
+    }
+
+    /**
+     * @brief Makes sure that n triplets fit without reallocating.
+     */
+    void reserve(std::size_t n) {entries.reserve(n);}
+
+    std::size_t rows() const {return n_rows;}
+    std::size_t cols() const {return n_cols;}
+    std::size_t size() const {return entries.size();}
+
+    /**
+     * @brief Builds a CSR (RowMajor = true) or CSC (RowMajor = false) matrix out of the triplets. The builder is left as it was.
+     */
+    template <bool RowMajor = true>
+    compressed_matrix<T, RowMajor> build() const {return compressed_matrix<T, RowMajor>(*this);}
+};
+
+/*!
+ * @class compressed_matrix
+ * @brief Compressed sparse matrix class, in CSR (RowMajor = true) or CSC (RowMajor = false) format.
+ *
+ * @details Only the non-zero elements are stored. Along the outer dimension (rows for CSR, columns for CSC), offsets[i] ... offsets[i + 1] is the range of the non-zeros of row (or column) i
+ * in indices (their inner coordinate, sorted) and values. That's nnz * (sizeof(T) + sizeof(std::size_t)) + (outer + 1) * sizeof(std::size_t) bytes, instead of rows * cols * sizeof(T).
+ * CSR is the format for multiplying (every row of the result is one pass over a contiguous range), CSC is the one for working with columns. Use csr_matrix and csc_matrix, rather than this class directly.
+ *
+ * @fn multiply(const T* x, T* y)
+ * @fn multiply(const T* x, T* y, thread_pool& pool)
+ * @fn operator*(const std::vector<T>& x)
+ * @fn multiply(const matrix<T, Alloc>& b)
+ * @fn to_dense()
+ * @fn to_csr()
+ * @fn to_csc()
+ * @fn get(std::size_t r, std::size_t c)
+ * @fn nnz()
+ * @fn memory_bytes()
+ * @tparam T typename
+ * @tparam RowMajor true for CSR, false for CSC
+ */
+template <class T, bool RowMajor>
+class compressed_matrix {
+private:
+    std::size_t n_rows;                 /**< Amount of rows*/
+    std::size_t n_cols;                 /**< Amount of columns*/
+    std::vector<std::size_t> offsets;   /**< Start of every outer row/column in indices and values, plus the end of the last one*/
+    std::vector<std::size_t> indices;   /**< Inner coordinate of every non-zero*/
+    std::vector<T> values;              /**< Value of every non-zero*/
+
+    template <class U, bool R>
+    friend class compressed_matrix;
+
+    std::size_t outer() const {return RowMajor ? n_rows : n_cols;}
+    std::size_t inner() const {return RowMajor ? n_cols : n_rows;}
+
+    /**
+     * @brief Fills the arrays from (outer, inner, value) triplets, with two counting sorts (by inner, then stably by outer), and merges duplicates. O(count + rows + cols).
+     */
+    template <class Outer, class Inner, class Value>
+    void compress(std::size_t count, Outer outer_of, Inner inner_of, Value value_of);
+
+    /**
+     * @brief y[row] = sum of A(row, c) * x[c], for the rows [row_begin, row_end). CSR only.
+     */
+    void multiply_rows(const T* x, T* y, std::size_t row_begin, std::size_t row_end) const;
+
+    /**
+     * @brief Returns the same matrix in the other format.
+     */
+    compressed_matrix<T, !RowMajor> swap_order() const;
+
+public:
+    using value_type = T;
+
+    /**
+     * Creates an empty 0x0 matrix.
+     * @brief Default constructor.
+     */
+    compressed_matrix()
+        : n_rows{0}, n_cols{0}, offsets(1, 0), indices{}, values{} { }
+
+    /**
+     * Creates a matrix out of the triplets of a builder.
+     * @brief Builder constructor.
+     */
+    explicit compressed_matrix(const coo_builder<T>& builder);
+
+    /**
+     * Creates a matrix out of the non-zero elements of a dense matrix.
+     * @brief Dense constructor.
+     */
+    template <class Alloc>
+    explicit compressed_matrix(const matrix<T, Alloc>& dense);
+
+    std::size_t rows() const {return n_rows;}
+    std::size_t cols() const {return n_cols;}
+
+    /**
+     * @brief Returns the amount of stored (non-zero) elements.
+     */
+    std::size_t nnz() const {return values.size();}
+
+    /**
+     * @brief Returns the amount of bytes taken up by the stored elements and indices.
+     */
+    std::size_t memory_bytes() const {
+        return values.size() * sizeof(T) + (indices.size() + offsets.size()) * sizeof(std::size_t);
+    }
+
+    /**
+     * @brief Returns the element at (r, c), found with a binary search in it's row (or column) [T() if it's not stored].
+     * @throws std::out_of_range if (r, c) is outside of the matrix.
+     */
+    T get(std::size_t r, std::size_t c) const;
+
+    const std::vector<std::size_t>& get_offsets() const {return offsets;}
+    const std::vector<std::size_t>& get_indices() const {return indices;}
+    const std::vector<T>& get_values() const {return values;}
+
+    /**
+     * @brief y = A * x [sparse matrix-vector multiply].
+     * @param x cols() elements.
+     * @param y rows() elements, overwritten.
+     */
+    void multiply(const T* x, T* y) const;
+
+    /**
+     * @brief y = A * x, with blocks of rows spread over the threads of the pool. Every row is still summed by one thread in order, so the result is the same for any amount of threads. CSR only.
+     */
+    void multiply(const T* x, T* y, thread_pool& pool) const;
+
+    /**
+     * @brief Returns A * x.
+     * @throws std::invalid_argument if x doesn't have cols() elements.
+     */
+    std::vector<T> operator*(const std::vector<T>& x) const;
+
+    /**
+     * @brief Returns A * B, where B is dense. Every non-zero A(r, k) adds a scaled row k of B to row r of the result, so both matrices are read row by row.
+     * @throws std::invalid_argument if the sizes don't match.
+     */
+    template <class Alloc>
+    matrix<T, Alloc> multiply(const matrix<T, Alloc>& b) const;
+
+    /**
+     * @brief Returns A * B, where B is dense, with blocks of rows of the result spread over the threads of the pool. CSR only.
+     */
+    template <class Alloc>
+    matrix<T, Alloc> multiply(const matrix<T, Alloc>& b, thread_pool& pool) const;
+
+    /**
+     * @brief Returns the matrix as a dense one.
+     */
+    matrix<T> to_dense() const;
+
+    /**
+     * @brief Returns the same matrix in the CSR format [a copy, if it already is one].
+     */
+    compressed_matrix<T, true> to_csr() const;
+
+    /**
+     * @brief Returns the same matrix in the CSC format [a copy, if it already is one].
+     */
+    compressed_matrix<T, false> to_csc() const;
+};
+
+/**
+ * @brief Compressed sparse row matrix.
+ */
+template <class T>
+using csr_matrix = compressed_matrix<T, true>;
+
+/**
+ * @brief Compressed sparse column matrix.
+ */
+template <class T>
+using csc_matrix = compressed_matrix<T, false>;
+
+template <class T, bool RowMajor>
+template <class Outer, class Inner, class Value>
+void compressed_matrix<T, RowMajor>::compress(std::size_t count, Outer outer_of, Inner inner_of, Value value_of) {
+    // Count the non-zeros of every outer index, and turn the counts into offsets
+    offsets.assign(outer() + 1, 0);
+    for (std::size_t i = 0; i < count; ++i)
+        ++offsets[outer_of(i) + 1];
+    for (std::size_t o = 0; o < outer(); ++o)
+        offsets[o + 1] += offsets[o];
+
+    // Counting sort by the inner index first...
+    struct entry {
+        std::size_t outer;
+        std::size_t inner;
+        T value;
+    };
+    std::vector<entry> by_inner(count);
+    {
+        std::vector<std::size_t> starts(inner() + 1, 0);
+        for (std::size_t i = 0; i < count; ++i)
+            ++starts[inner_of(i) + 1];
+        for (std::size_t in = 0; in < inner(); ++in)
+            starts[in + 1] += starts[in];
+        for (std::size_t i = 0; i < count; ++i)
+            by_inner[starts[inner_of(i)]++] = entry{outer_of(i), inner_of(i), value_of(i)};
+    }
+
+    // ...then scattering into the outer ranges in that order leaves every range sorted by the inner index (triplets that share a position keep the order they were added in)
+    std::vector<std::pair<std::size_t, T>> scattered(count);
+    std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+    for (entry& e : by_inner)
+        scattered[fill[e.outer]++] = std::make_pair(e.inner, std::move(e.value));
+    by_inner = std::vector<entry>();
+
+    // Add up duplicates, which are next to each other now
+    indices.clear();
+    values.clear();
+    indices.reserve(count);
+    values.reserve(count);
+
+    std::size_t range_begin = 0;
+    for (std::size_t o = 0; o < outer(); ++o) {
+        const std::size_t range_end = offsets[o + 1];
+        offsets[o] = indices.size();
+        for (std::size_t i = range_begin; i < range_end; ++i) {
+            if (indices.size() > offsets[o] && indices.back() == scattered[i].first)
+                values.back() += scattered[i].second;
+            else {
+                indices.push_back(scattered[i].first);
+                values.push_back(scattered[i].second);
+            }
+        }
+        range_begin = range_end;
+    }
+    offsets[outer()] = indices.size();
+}
+
+template <class T, bool RowMajor>
+compressed_matrix<T, RowMajor>::compressed_matrix(const coo_builder<T>& builder)
+    : n_rows{builder.n_rows}, n_cols{builder.n_cols}, offsets{}, indices{}, values{} {
+    const auto& entries = builder.entries;
+    compress(entries.size(),
+             [&](std::size_t i) {return RowMajor ? entries[i].row : entries[i].col;},
+             [&](std::size_t i) {return RowMajor ? entries[i].col : entries[i].row;},
+             [&](std::size_t i) -> const T& {return entries[i].value;});
+}
+
+template <class T, bool RowMajor>
+template <class Alloc>
+compressed_matrix<T, RowMajor>::compressed_matrix(const matrix<T, Alloc>& dense)
+    : n_rows{dense.rows()}, n_cols{dense.cols()}, offsets(outer() + 1, 0), indices{}, values{} {
+    // Walk the dense matrix in the outer order, so the non-zeros come out sorted
+    for (std::size_t o = 0; o < outer(); ++o) {
+        for (std::size_t i = 0; i < inner(); ++i) {
+            const T& value = RowMajor ? dense(o, i) : dense(i, o);
+            if (value != T(0)) {
+                indices.push_back(i);
+                values.push_back(value);
+            }
+        }
+        offsets[o + 1] = indices.size();
+    }
+}
+
+template <class T, bool RowMajor>
+T compressed_matrix<T, RowMajor>::get(std::size_t r, std::size_t c) const {
+    if (r >= n_rows || c >= n_cols)
+        throw std::out_of_range("Sparse matrix index out of range");
+
+    const std::size_t o = RowMajor ? r : c;
+    const std::size_t i = RowMajor ? c : r;
+    const auto first = indices.begin() + offsets[o];
+    const auto last = indices.begin() + offsets[o + 1];
+    const auto found = std::lower_bound(first, last, i);
+
+    if (found == last || *found != i)
+        return T();
+    return values[found - indices.begin()];
+}
+
+template <class T, bool RowMajor>
+void compressed_matrix<T, RowMajor>::multiply_rows(const T* x, T* y, std::size_t row_begin, std::size_t row_end) const {
+    for (std::size_t r = row_begin; r < row_end; ++r) {
+        T sum = T(0);
+        for (std::size_t k = offsets[r]; k < offsets[r + 1]; ++k)
+            sum += values[k] * x[indices[k]];
+        y[r] = sum;
+    }
+}
+
+template <class T, bool RowMajor>
+void compressed_matrix<T, RowMajor>::multiply(const T* x, T* y) const {
+    if constexpr (RowMajor)
+        multiply_rows(x, y, 0, n_rows);
+    else {
+        // Every column scatters into y
+        std::fill(y, y + n_rows, T(0));
+        for (std::size_t c = 0; c < n_cols; ++c) {
+            const T xc = x[c];
+            for (std::size_t k = offsets[c]; k < offsets[c + 1]; ++k)
+                y[indices[k]] += values[k] * xc;
+        }
+    }
+}
+
+template <class T, bool RowMajor>
+void compressed_matrix<T, RowMajor>::multiply(const T* x, T* y, thread_pool& pool) const {
+    static_assert(RowMajor, "the parallel SpMV needs a CSR matrix, a CSC one would have every thread scatter into all of y");
+
+    // Rows are independent, so blocks of them can go to different threads. Big blocks keep threads from sharing cache lines of y.
+    pool.parallel_for(0, n_rows, 1024, [&](std::size_t lo, std::size_t hi) {
+        multiply_rows(x, y, lo, hi);
+    });
+}
+
+template <class T, bool RowMajor>
+std::vector<T> compressed_matrix<T, RowMajor>::operator*(const std::vector<T>& x) const {
+    if (x.size() != n_cols)
+        throw std::invalid_argument("The vector must have as many elements as the matrix has columns");
+
+    std::vector<T> y(n_rows);
+    multiply(x.data(), y.data());
+    return y;
+}
+
+template <class T, bool RowMajor>
+template <class Alloc>
+matrix<T, Alloc> compressed_matrix<T, RowMajor>::multiply(const matrix<T, Alloc>& b) const {
+    if (n_cols != b.rows())
+        throw std::invalid_argument("The columns of the left matrix must match the rows of the right matrix");
+
+    matrix<T, Alloc> result(n_rows, b.cols());
+    for (std::size_t o = 0; o < outer(); ++o) {
+        for (std::size_t k = offsets[o]; k < offsets[o + 1]; ++k) {
+            // A(r, c) * row c of B goes into row r of the result
+            const std::size_t r = RowMajor ? o : indices[k];
+            const std::size_t c = RowMajor ? indices[k] : o;
+            const T a = values[k];
+            const T* src = b.row(c);
+            T* out = result.row(r);
+            for (std::size_t j = 0; j < b.cols(); ++j)
+                out[j] += a * src[j];
+        }
+    }
+    return result;
+}
+
+template <class T, bool RowMajor>
+template <class Alloc>
+matrix<T, Alloc> compressed_matrix<T, RowMajor>::multiply(const matrix<T, Alloc>& b, thread_pool& pool) const {
+    static_assert(RowMajor, "the parallel sparse x dense multiply needs a CSR matrix");
+    if (n_cols != b.rows())
+        throw std::invalid_argument("The columns of the left matrix must match the rows of the right matrix");
+
+    matrix<T, Alloc> result(n_rows, b.cols());
+    pool.parallel_for(0, n_rows, 64, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t r = lo; r < hi; ++r) {
+            T* out = result.row(r);
+            for (std::size_t k = offsets[r]; k < offsets[r + 1]; ++k) {
+                const T a = values[k];
+                const T* src = b.row(indices[k]);
+                for (std::size_t j = 0; j < b.cols(); ++j)
+                    out[j] += a * src[j];
+            }
+        }
+    });
+    return result;
+}
+
+template <class T, bool RowMajor>
+matrix<T> compressed_matrix<T, RowMajor>::to_dense() const {
+    matrix<T> dense(n_rows, n_cols);
+    for (std::size_t o = 0; o < outer(); ++o)
+        for (std::size_t k = offsets[o]; k < offsets[o + 1]; ++k) {
+            if constexpr (RowMajor)
+                dense(o, indices[k]) = values[k];
+            else
+                dense(indices[k], o) = values[k];
+        }
+    return dense;
+}
+
+template <class T, bool RowMajor>
+compressed_matrix<T, !RowMajor> compressed_matrix<T, RowMajor>::swap_order() const {
+    // Swapping the roles of the indices transposes the storage, which compress() does with a counting sort
+    compressed_matrix<T, !RowMajor> result;
+    result.n_rows = n_rows;
+    result.n_cols = n_cols;
+
+    std::vector<std::size_t> outer_index(values.size());
+    for (std::size_t o = 0; o < outer(); ++o)
+        for (std::size_t k = offsets[o]; k < offsets[o + 1]; ++k)
+            outer_index[k] = o;
+
+    result.compress(values.size(),
+                    [&](std::size_t k) {return indices[k];},
+                    [&](std::size_t k) {return outer_index[k];},
+                    [&](std::size_t k) -> const T& {return values[k];});
+    return result;
+}
+
+template <class T, bool RowMajor>
+compressed_matrix<T, true> compressed_matrix<T, RowMajor>::to_csr() const {
+    if constexpr (RowMajor)
+        return *this;
+    else
+        return swap_order();
+}
+
+template <class T, bool RowMajor>
+compressed_matrix<T, false> compressed_matrix<T, RowMajor>::to_csc() const {
+    if constexpr (RowMajor)
+        return swap_order();
+    else
+        return *this;
+}
+
+#endif // SPARSE_MATRIX_H
@@ -1,93 +1,436 @@
 /**
  * @file stack.hpp
  * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
- * @brief  A header that defines a dynamic node class
- * @version 0.3
- * @date 2023-06-24
+ * @brief  A header that defines a stack class, and the storage policies it can be built on
+ * @version 0.4
+ * @date 2026-10-16
  * @copyright Copyright (c) 2023
  * @link https://github.com/SleepiCaffeine
  */
 #ifndef STACK_H
 #define STACK_H
 #include "sl_list.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 /*!
- * @class stack  
+ * @class stack_array
+ * @brief Contiguous storage policy for stack [default].
+ *
+ * @details Keeps the items in a single growable buffer, which doubles when it runs out of room, so push and pop are amortized O(1) and never allocate per item.
+ * The first InlineCapacity items are stored inside of the object itself, so shallow stacks never touch the heap at all.
+ *
+ * @note Growing moves the items into a new buffer, so references to items are only valid until the next push.
+ *
+ * @tparam T typename
+ * @tparam InlineCapacity Amount of items which fit before the first heap allocation [0 to always use the heap]
+ * @tparam Alloc Allocator used for the heap buffer
+ */
+template <class T, std::size_t InlineCapacity = 0, class Alloc = std::allocator<T>>
+class stack_array {
+private:
+  using alloc_traits = std::allocator_traits<Alloc>;
+
+  /**< Raw memory for the inline items*/
+  template <std::size_t N, class Dummy = void>
+  struct inline_buffer {
+    alignas(T) unsigned char storage[N * sizeof(T)];
+    T* get() {return reinterpret_cast<T*>(storage);}
+  };
+
+  /**< No inline items, and no wasted bytes either*/
+  template <class Dummy>
+  struct inline_buffer<0, Dummy> {
+    T* get() {return nullptr;}
+  };
+
+  Alloc alloc;                                /**< Allocator which creates and frees the heap buffer*/
+  inline_buffer<InlineCapacity> small;        /**< Storage for the first InlineCapacity items*/
+  T* items;                                   /**< Either small.get(), or the heap buffer*/
+  std::size_t len;                            /**< Amount of items in the buffer*/
+  std::size_t cap;                            /**< Amount of items the buffer can hold*/
+
+  /**
+   * @brief Returns true if the items don't live in the inline buffer.
+   */
+  bool on_heap() const {return cap > InlineCapacity;}
+
+  /**
+   * @brief Moves every item into a new heap buffer, which holds new_cap items.
+   * @param new_cap Capacity of the new buffer.
+   */
+  void grow(std::size_t new_cap);
+
+  /**
+   * @brief Moves the items into fresh, frees the old buffer, and makes fresh the buffer. If moving throws, the moved items are destroyed, but fresh isn't freed.
+   */
+  void relocate(T* fresh, std::size_t new_cap);
+
+  /**
+   * @brief emplace_back() for a full buffer: builds the new item in a bigger buffer before the old items are moved, since args may refer to one of them (like push(top())).
+   */
+  template <class... Args>
+  T& grow_emplace_back(Args&&... args);
+
+  /**
+   * @brief Takes the items of the provided storage, leaving it empty.
+   * @param other Storage to move from.
+   */
+  void steal(stack_array& other);
+
+public:
+  using value_type = T;
+  using allocator_type = Alloc;
+
+  /**
+   * Creates an empty storage, which uses the inline buffer until it overflows.
+   * @brief Default constructor.
+   */
+  stack_array()
+    : alloc{}, small{}, items{small.get()}, len{0}, cap{InlineCapacity} { }
+
+  /**
+   * @brief Copy constructor.
+   */
+  stack_array(const stack_array& other);
+
+  /**
+   * @brief Move constructor. Steals the heap buffer, or moves the items one by one if they're inline.
+   */
+  stack_array(stack_array&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+  stack_array& operator=(const stack_array& other);
+  stack_array& operator=(stack_array&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+  /**
+   * @brief Destroys every item, and frees the heap buffer.
+   */
+  ~stack_array();
+
+  /**
+   * @brief Constructs an item in place after the last one, growing the buffer if it's full.
+   * @param args Arguments forwarded to T's constructor.
+   * @return Reference to the new item.
+   */
+  template <class... Args>
+  T& emplace_back(Args&&... args);
+
+  /**
+   * @brief Destroys the last item.
+   * @note The storage must not be empty.
+   */
+  void pop_back() {
+    alloc_traits::destroy(alloc, items + --len);
+  }
+
+  T& back() {return items[len - 1];}
+  const T& back() const {return items[len - 1];}
+
+  std::size_t size() const {return len;}
+  std::size_t capacity() const {return cap;}
+
+  /**
+   * @brief Makes sure that n items fit without growing again.
+   * @param n Amount of items.
+   */
+  void reserve(std::size_t n) {
+    if (n > cap)
+      grow(n);
+  }
+
+  /**
+   * @brief Destroys every item, but keeps the buffer.
+   */
+  void clear();
+};
+
+/*!
+ * @class stack_list
+ * @brief Linked storage policy for stack.
+ *
+ * @details Keeps the items in a sl_list, one node per item. Every push allocates a node and every pop frees one (pass a node_pool as Alloc to recycle them),
+ * but items never move, so references to them stay valid until they're popped.
+ *
+ * @tparam T typename
+ * @tparam Alloc Allocator used for the nodes of the list
+ */
+template <class T, class Alloc = std::allocator<T>>
+class stack_list {
+private:
+  sl_list<T, Alloc> item_list;   /**< Singly-Linked list to store the items, the last item is the head*/
+
+public:
+  using value_type = T;
+  using allocator_type = Alloc;
+
+  template <class... Args>
+  T& emplace_back(Args&&... args) {
+    return item_list.emplace_front(std::forward<Args>(args)...)->get_data();
+  }
+
+  void pop_back() {item_list.pop_front();}
+
+  T& back() {return item_list.get_head()->get_data();}
+  const T& back() const {return item_list.get_head()->get_data();}
+
+  std::size_t size() const {return item_list.size();}
+
+  void clear() {item_list.clear();}
+};
+
+/*!
+ * @class stack
  * @brief stack class.
- * 
- * @details A standard stack [LIFO] data structure. Made using SLL in sl_list.hpp. Supports synamic types, popping, pushing, inserting.
- * 
- * @fn push(T dt)
+ *
+ * @details A standard stack [LIFO] data structure. Supports dynamic types, popping, pushing and emplacing.
+ * The items are kept by a storage policy: stack_array (default) keeps them in one contiguous buffer, stack_list keeps them in a SLL (sl_list.hpp).
+ * See small_stack for a stack which doesn't touch the heap until it gets deep.
+ *
+ * @fn push(const T& dt)
+ * @fn push(T&& dt)
+ * @fn emplace(Args&&... args)
  * @fn pop()
  * @fn top()
  * @fn empty()
- * @fn insert(node<T>* nd, T dt)
+ * @fn size()
+ * @fn clear()
  * @tparam T class
+ * @tparam Storage Storage policy, stack_array<T> (default) or stack_list<T>
  */
-template <class T>
+template <class T, class Storage = stack_array<T>>
 class stack {
+  static_assert(std::is_same<typename Storage::value_type, T>::value, "stack storage must hold the same type as the stack");
+
 private:
-  sl_list<T> item_list;   /**< Singly-Linked list to store the stack items*/
+  Storage items;   /**< Storage for the stack items, the top is the last item*/
 public:
+  using value_type = T;
+  using storage_type = Storage;
+
   /**
-   * Creates a new stack object, with an empty Singly-Linked list
-   * @brief Default constructor 
+   * Creates a new, empty stack
+   * @brief Default constructor
    */
   stack()
-    : item_list{sl_list<T>()} { }
+    : items{} { }
 
   /**
    * @brief Inserts a value onto the top of the stack, and returns it
    * @param dt Data to append to the stack
-   * @return Node pointer to the top of the stack 
+   * @return Reference to the top of the stack
    */
-  node<T>* push(const T dt);
+  T& push(const T& dt) {return items.emplace_back(dt);}
 
   /**
-   * @brief Removes a value from the top of the stack, and returns the new top
-   * @return Node pointer to the top of the stack 
+   * @brief Moves a value onto the top of the stack, and returns it
+   * @param dt Data to append to the stack
+   * @return Reference to the top of the stack
    */
-  node<T>* pop();
+  T& push(T&& dt) {return items.emplace_back(std::move(dt));}
+
+  /**
+   * @brief Constructs a value in place on the top of the stack, and returns it
+   * @param args Arguments forwarded to T's constructor
+   * @return Reference to the top of the stack
+   */
+  template <class... Args>
+  T& emplace(Args&&... args) {return items.emplace_back(std::forward<Args>(args)...);}
+
+  /**
+   * @brief Removes the value from the top of the stack
+   * @note The stack must not be empty
+   */
+  void pop() {items.pop_back();}
+
+  /**
+   * @brief Returns the value on the top of the stack
+   * @note The stack must not be empty
+   * @return Reference to the top of the stack
+   */
+  T& top() {return items.back();}
+  const T& top() const {return items.back();}
 
   /**
    * @brief Function to determine if the stack is empty
-   * 
+   *
    * @return true if it's empty
    * @return false if it's NOT empty
    */
-  bool empty();
-  
+  bool empty() const {return items.size() == 0;}
+
   /**
    * @brief Returns the length/size of the stack
    * @return The size of the stack
    */
-  unsigned int size() {return item_list.size();}
+  std::size_t size() const {return items.size();}
 
   /**
-   * @brief Returns node pointer to the top of the stack
-   * @return Stack's top node pointer
+   * @brief Removes every value from the stack
    */
-  node<T>* top();
+  void clear() {items.clear();}
+
+  /**
+   * @brief Returns the storage, to reach policy specific functions (like stack_array::reserve())
+   */
+  Storage& get_storage() {return items;}
+  const Storage& get_storage() const {return items;}
 };
 
-template <class T>
-node<T>* stack<T>::push(const T dt) {
-  return item_list.push_front(dt);
+/**
+ * @brief A contiguous stack, which keeps it's first N items inside of itself.
+ * @tparam T typename
+ * @tparam N Amount of items which fit before the first heap allocation
+ */
+template <class T, std::size_t N>
+using small_stack = stack<T, stack_array<T, N>>;
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+void stack_array<T, InlineCapacity, Alloc>::grow(std::size_t new_cap) {
+  T* fresh = alloc_traits::allocate(alloc, new_cap);
+  try {
+    relocate(fresh, new_cap);
+  }
+  catch (...) {
+    alloc_traits::deallocate(alloc, fresh, new_cap);
+    throw;
+  }
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+void stack_array<T, InlineCapacity, Alloc>::relocate(T* fresh, std::size_t new_cap) {
+  // Move the items over (or copy them, if moving could throw half way through)
+  std::size_t moved = 0;
+  try {
+    for (; moved < len; ++moved)
+      alloc_traits::construct(alloc, fresh + moved, std::move_if_noexcept(items[moved]));
+  }
+  catch (...) {
+    while (moved > 0)
+      alloc_traits::destroy(alloc, fresh + --moved);
+    throw;
+  }
+
+  // Get rid of the old buffer
+  for (std::size_t i = 0; i < len; ++i)
+    alloc_traits::destroy(alloc, items + i);
+  if (on_heap())
+    alloc_traits::deallocate(alloc, items, cap);
+
+  items = fresh;
+  cap = new_cap;
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+template <class... Args>
+T& stack_array<T, InlineCapacity, Alloc>::emplace_back(Args&&... args) {
+  if (len == cap)
+    return grow_emplace_back(std::forward<Args>(args)...);
+
+  alloc_traits::construct(alloc, items + len, std::forward<Args>(args)...);
+  return items[len++];
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+template <class... Args>
+T& stack_array<T, InlineCapacity, Alloc>::grow_emplace_back(Args&&... args) {
+  // Double the buffer, starting at a handful of items
+  const std::size_t new_cap = (cap == 0) ? 8 : cap * 2;
+  T* fresh = alloc_traits::allocate(alloc, new_cap);
+
+  // The new item goes in first, while whatever args refer to is still in one piece
+  try {
+    alloc_traits::construct(alloc, fresh + len, std::forward<Args>(args)...);
+  }
+  catch (...) {
+    alloc_traits::deallocate(alloc, fresh, new_cap);
+    throw;
+  }
+
+  try {
+    relocate(fresh, new_cap);
+  }
+  catch (...) {
+    alloc_traits::destroy(alloc, fresh + len);
+    alloc_traits::deallocate(alloc, fresh, new_cap);
+    throw;
+  }
+  return items[len++];
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+void stack_array<T, InlineCapacity, Alloc>::clear() {
+  while (len > 0)
+    pop_back();
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+void stack_array<T, InlineCapacity, Alloc>::steal(stack_array& other) {
+  // A heap buffer can simply change owners
+  if (other.on_heap()) {
+    items = other.items;
+    cap = other.cap;
+    len = other.len;
+    other.items = other.small.get();
+    other.cap = InlineCapacity;
+    other.len = 0;
+    return;
+  }
+
+  // Inline items have to be moved one by one (they fit into our inline buffer)
+  for (std::size_t i = 0; i < other.len; ++i)
+    alloc_traits::construct(alloc, items + i, std::move(other.items[i]));
+  len = other.len;
+  other.clear();
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+stack_array<T, InlineCapacity, Alloc>::stack_array(const stack_array& other)
+  : alloc{alloc_traits::select_on_container_copy_construction(other.alloc)}, small{}, items{small.get()}, len{0}, cap{InlineCapacity} {
+  reserve(other.len);
+  for (std::size_t i = 0; i < other.len; ++i)
+    emplace_back(other.items[i]);
+}
+
+template <class T, std::size_t InlineCapacity, class Alloc>
+stack_array<T, InlineCapacity, Alloc>::stack_array(stack_array&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+  : alloc{std::move(other.alloc)}, small{}, items{small.get()}, len{0}, cap{InlineCapacity} {
+  steal(other);
 }
 
-template <class T>
-node<T>* stack<T>::pop() {
-   return item_list.pop_front();
+template <class T, std::size_t InlineCapacity, class Alloc>
+stack_array<T, InlineCapacity, Alloc>& stack_array<T, InlineCapacity, Alloc>::operator=(const stack_array& other) {
+  if (this != &other) {
+    clear();
+    reserve(other.len);
+    for (std::size_t i = 0; i < other.len; ++i)
+      emplace_back(other.items[i]);
+  }
+  return *this;
 }
 
-template <class T>
-bool stack<T>::empty() {
-  return size() == 0;
+template <class T, std::size_t InlineCapacity, class Alloc>
+stack_array<T, InlineCapacity, Alloc>& stack_array<T, InlineCapacity, Alloc>::operator=(stack_array&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+  if (this != &other) {
+    // Our buffer has to be freed with our own allocator, before it gets replaced
+    clear();
+    if (on_heap())
+      alloc_traits::deallocate(alloc, items, cap);
+    items = small.get();
+    cap = InlineCapacity;
+    alloc = std::move(other.alloc);
+    steal(other);
+  }
+  return *this;
 }
 
-template <class T>
-node<T>* stack<T>::top() {
-  return item_list.get_head();
+template <class T, std::size_t InlineCapacity, class Alloc>
+stack_array<T, InlineCapacity, Alloc>::~stack_array() {
+  clear();
+  if (on_heap())
+    alloc_traits::deallocate(alloc, items, cap);
 }
 
-#endif // STACK_H
\ No newline at end of file
+#endif // STACK_H
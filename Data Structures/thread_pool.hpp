@@ -0,0 +1,213 @@
+/**
+ * @file thread_pool.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines a small std::thread based pool, which splits loops across threads
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/*!
+ * @class thread_pool
+ * @brief Fork-join thread pool class.
+ *
+ * @details Keeps threads - 1 worker threads alive, and runs parallel_for() loops on them together with the calling thread.
+ * A loop is cut into fixed chunks up front, and the threads take chunks from a shared counter until none are left, so the work is balanced, but which thread runs which chunk doesn't matter for the result.
+ *
+ * @note One loop runs at a time. parallel_for() may be called from several threads, the calls are simply serialized.
+ * @note A parallel_for() called from inside a chunk [of any pool] runs it's whole loop on the calling thread, since every other thread may be busy with the outer loop, and waiting for them would deadlock.
+ *
+ * @fn parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F f)
+ * @fn size()
+ */
+class thread_pool {
+private:
+    std::vector<std::thread> workers;        /**< Every thread besides the calling one*/
+
+    std::mutex lock;                         /**< Guards everything below, besides the atomics*/
+    std::condition_variable wake;            /**< Signals the workers that a loop started (or that the pool is shutting down)*/
+    std::condition_variable finished;        /**< Signals the caller that the last chunk is done*/
+    std::mutex loop_lock;                    /**< Serializes parallel_for() calls*/
+
+    std::function<void(std::size_t)> job;    /**< Runs one chunk of the current loop*/
+    std::size_t chunks = 0;                  /**< Amount of chunks in the current loop*/
+    std::atomic<std::size_t> next_chunk{0};  /**< Next chunk which nobody has taken yet*/
+    std::size_t busy = 0;                    /**< Workers which are still inside of the current loop*/
+    std::size_t generation = 0;              /**< Bumped for every loop, so workers know there's a new one*/
+    std::exception_ptr error;                /**< First exception thrown by a chunk*/
+    bool stopping = false;                   /**< Set by the destructor*/
+
+    /**
+     * @brief Takes chunks of the current loop, until there are none left.
+     */
+    void run_chunks();
+
+    /**
+     * @brief Returns true on a thread which is currently running a chunk.
+     */
+    static bool& inside_chunk() {
+        thread_local bool inside = false;
+        return inside;
+    }
+
+    /**
+     * @brief Main loop of a worker thread.
+     */
+    void work();
+
+public:
+    /**
+     * Creates a pool, which runs loops on the provided amount of threads [including the calling one].
+     * @brief Constructor.
+     * @param threads Amount of threads [0 means std::thread::hardware_concurrency()].
+     */
+    explicit thread_pool(std::size_t threads = 0);
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /**
+     * @brief Stops and joins every worker.
+     */
+    ~thread_pool();
+
+    /**
+     * @brief Returns the amount of threads which run a loop [including the calling one].
+     */
+    std::size_t size() const {return workers.size() + 1;}
+
+    /**
+     * @brief Calls f(lo, hi) for consecutive ranges, which together cover [begin, end), spread over every thread of the pool. Returns once every range is done.
+     * @param begin First index.
+     * @param end Index past the last one.
+     * @param grain Size of a range [the last one may be shorter], at least 1.
+     * @param f Callable, which takes two std::size_t.
+     * @throws The first exception thrown by f, after the whole loop stopped.
+     */
+    template <class F>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F f);
+};
+
+inline thread_pool::thread_pool(std::size_t threads) {
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 1;
+
+    workers.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i)
+        workers.emplace_back([this] {work();});
+}
+
+inline thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+inline void thread_pool::run_chunks() {
+    // Restores the flag on the way out, the calling thread may itself be inside an outer pool's chunk
+    struct chunk_scope {
+        bool outer = inside_chunk();
+        chunk_scope() {inside_chunk() = true;}
+        ~chunk_scope() {inside_chunk() = outer;}
+    } scope;
+
+    std::size_t chunk;
+    while ((chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) < chunks) {
+        try {
+            job(chunk);
+        }
+        catch (...) {
+            // Keep the first error, and skip the chunks nobody has started yet
+            std::lock_guard<std::mutex> guard(lock);
+            if (!error)
+                error = std::current_exception();
+            next_chunk.store(chunks, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline void thread_pool::work() {
+    std::size_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [&] {return stopping || generation != seen;});
+            if (stopping)
+                return;
+            seen = generation;
+        }
+
+        run_chunks();
+
+        // The last worker out wakes the caller up
+        std::lock_guard<std::mutex> guard(lock);
+        if (--busy == 0)
+            finished.notify_one();
+    }
+}
+
+template <class F>
+void thread_pool::parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F f) {
+    if (grain == 0)
+        throw std::invalid_argument("parallel_for() needs a grain of at least 1");
+    if (begin >= end)
+        return;
+
+    const std::size_t count = (end - begin + grain - 1) / grain;
+
+    // Not worth waking anyone up, or we're a loop nested in a chunk, which would wait on itself
+    if (count == 1 || workers.empty() || inside_chunk()) {
+        for (std::size_t lo = begin; lo < end; lo += grain)
+            f(lo, (end - lo < grain) ? end : lo + grain);
+        return;
+    }
+
+    std::lock_guard<std::mutex> serial(loop_lock);
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        job = [&](std::size_t chunk) {
+            const std::size_t lo = begin + chunk * grain;
+            f(lo, (end - lo < grain) ? end : lo + grain);
+        };
+        chunks = count;
+        next_chunk.store(0, std::memory_order_relaxed);
+        busy = workers.size();
+        error = nullptr;
+        ++generation;
+    }
+    wake.notify_all();
+
+    // The calling thread helps out, and then waits for the stragglers
+    run_chunks();
+    std::exception_ptr failure;
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        finished.wait(guard, [&] {return busy == 0;});
+        job = nullptr;
+        failure = error;
+    }
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+#endif // THREAD_POOL_H
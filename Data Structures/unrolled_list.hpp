@@ -0,0 +1,673 @@
+/**
+ * @file unrolled_list.hpp
+ * @author Vakaris Michejenko (sleepicaffeine@gmail.com)
+ * @brief  A header that defines an unrolled Doubly-linked list class, where every node holds a small array of values
+ * @version 0.1
+ * @date 2026-10-16
+ * @copyright Copyright (c) 2023
+ * @link https://github.com/SleepiCaffeine
+ */
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Default amount of values in a block of an unrolled_list: as many as fit into two cache lines next to the block's links, but at least 4.
+ */
+template <class T>
+constexpr std::size_t unrolled_block_capacity() {
+    constexpr std::size_t header = 2 * sizeof(void*) + sizeof(std::size_t);
+    return (sizeof(T) * 4 + header > 128) ? 4 : (128 - header) / sizeof(T);
+}
+
+/*!
+ * @class unrolled_block
+ * @brief Unrolled List Node class.
+ *
+ * @details A node of an unrolled_list. Like double_node it links both ways, but instead of a single value, it holds up to Capacity of them in an inline array, of which the first count are constructed.
+ *
+ * @tparam T typename
+ * @tparam Capacity Amount of values which fit into the block
+ */
+template <class T, std::size_t Capacity>
+class unrolled_block {
+public:
+    unrolled_block<T, Capacity>* next;   /**< Pointer to the next block*/
+    unrolled_block<T, Capacity>* prev;   /**< Pointer to the previous block*/
+    std::size_t count;                   /**< Amount of values in the block*/
+
+    unrolled_block()
+        : next{nullptr}, prev{nullptr}, count{0} { }
+
+    unrolled_block(const unrolled_block&) = delete;
+    unrolled_block& operator=(const unrolled_block&) = delete;
+
+    T* values() {return std::launder(reinterpret_cast<T*>(storage));}
+    const T* values() const {return std::launder(reinterpret_cast<const T*>(storage));}
+
+private:
+    alignas(T) unsigned char storage[sizeof(T) * Capacity];   /**< The values, constructed in place*/
+};
+
+/*!
+ * @class unrolled_list
+ * @brief Unrolled Doubly-Linked List Class.
+ *
+ * @details A Doubly-linked list data structure class with the same interface as dl_list, where every node (an unrolled_block) holds up to BlockCapacity values in an array, instead of just one.
+ * A scan reads whole cache lines of values between pointer hops, the links are paid once per block instead of once per value, and insert_node() can skip over whole blocks by their counts on it's way to an index.
+ * A full block is split in half on insertion, and a block which drops under half full after an erase is merged with it's successor, if they fit into one.
+ *
+ * @note Values move around inside of their blocks, so references and iterators are only valid until the next insertion or removal.
+ *
+ * @fn push_front(const T& dt)
+ * @fn push_front(T&& dt)
+ * @fn emplace_front(Args&&... args)
+ * @fn push_back(const T& dt)
+ * @fn push_back(T&& dt)
+ * @fn emplace_back(Args&&... args)
+ * @fn insert_node(const T& dt, unsigned int idx)
+ * @fn insert_node(T&& dt, unsigned int idx)
+ * @fn erase(unsigned int idx)
+ *
+ * @fn pop_front()
+ * @fn pop_back()
+ *
+ * @fn front()
+ * @fn back()
+ * @fn operator[](unsigned int idx)
+ * @fn at(unsigned int idx)
+ *
+ * @fn begin()
+ * @fn end()
+ * @fn rbegin()
+ * @fn rend()
+ *
+ * @fn size()
+ * @fn clear()
+ * @fn get_allocator()
+ * @tparam T class
+ * @tparam BlockCapacity Amount of values in a single block
+ * @tparam Alloc Allocator used for the blocks, rebound to unrolled_block<T, BlockCapacity>
+ */
+template <class T, std::size_t BlockCapacity = unrolled_block_capacity<T>(), class Alloc = std::allocator<T>>
+class unrolled_list {
+    static_assert(BlockCapacity >= 2, "a block has to fit at least 2 values, so it can be split");
+
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using block_type = unrolled_block<T, BlockCapacity>;
+
+    /*!
+     * @class basic_iterator
+     * @brief Bidirectional iterator over the values of an unrolled_list.
+     *
+     * @details Steps through the array of a block, and only follows a link at the end of it. Use iterator and const_iterator, rather than this class directly.
+     * @tparam IsConst true for a read-only iterator
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        basic_iterator()
+            : blk{nullptr}, pos{0}, list{nullptr} { }
+
+        basic_iterator(block_type* const b, std::size_t p, const unrolled_list* const owner)
+            : blk{b}, pos{p}, list{owner} { }
+
+        /**
+         * @brief Allows an iterator to be used wherever a const_iterator is expected.
+         */
+        template <bool WasConst, class = std::enable_if_t<IsConst && !WasConst>>
+        basic_iterator(const basic_iterator<WasConst>& it)
+            : blk{it.get_block()}, pos{it.get_position()}, list{it.get_list()} { }
+
+        reference operator*() const {return blk->values()[pos];}
+        pointer operator->() const {return blk->values() + pos;}
+
+        basic_iterator& operator++() {
+            if (++pos == blk->count) {
+                blk = blk->next;
+                pos = 0;
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        basic_iterator& operator--() {
+            // Stepping back from end() lands on the last value of the tail
+            if (blk == nullptr)
+                blk = list->tail;
+            else if (pos == 0)
+                blk = blk->prev;
+            else {
+                --pos;
+                return *this;
+            }
+            pos = blk->count - 1;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {return a.blk == b.blk && a.pos == b.pos;}
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {return !(a == b);}
+
+        block_type* get_block() const {return blk;}
+        std::size_t get_position() const {return pos;}
+        const unrolled_list* get_list() const {return list;}
+
+    private:
+        block_type* blk;              /**< Current block [nullptr past the end]*/
+        std::size_t pos;              /**< Index inside of the current block*/
+        const unrolled_list* list;    /**< List which is being iterated, used to step back from end()*/
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    using block_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<block_type>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+    block_allocator alloc;     /**< Allocator which creates and frees every block of the list*/
+    block_type* head;          /**< First block*/
+    block_type* tail;          /**< Last block*/
+    unsigned int len;          /**< List's length [unsigned int]*/
+
+public:
+    /**
+     * Creates a new, empty unrolled list
+     * @brief Default constructor.
+     */
+    unrolled_list()
+        : unrolled_list{Alloc()} {}
+
+    /**
+     * Creates a new, empty unrolled list, which will allocate it's blocks using the provided allocator
+     * @brief Constructor.
+     * @param allocator Allocator for the blocks
+     */
+    explicit unrolled_list(const Alloc& allocator)
+        : alloc{allocator}, head{nullptr}, tail{nullptr}, len{0} {}
+
+    /**
+     * Constructs a new unrolled list from another one, by copying every value into full blocks
+     * @brief Copy constructor.
+     */
+    unrolled_list(const unrolled_list& list);
+
+    /**
+     * Constructs a new unrolled list by taking over the blocks of another one, which is left empty
+     * @brief Move constructor.
+     */
+    unrolled_list(unrolled_list&& list) noexcept;
+
+    /**
+     * Replaces the list's values with copies of the values of another list
+     * @brief Copy assignment.
+     */
+    unrolled_list& operator=(const unrolled_list& list);
+
+    /**
+     * Frees the list's blocks and takes over the blocks of another list, which is left empty
+     * @brief Move assignment.
+     */
+    unrolled_list& operator=(unrolled_list&& list) noexcept;
+
+    /**
+     * Frees every block of the list
+     * @brief Destructor.
+     */
+    ~unrolled_list() {clear();}
+
+    /**
+     * Adds the provided value to the end of the list
+     * @returns Reference to the new value
+     */
+    T& push_back(const T& dt) {return emplace_back(dt);}
+    T& push_back(T&& dt) {return emplace_back(std::move(dt));}
+
+    /**
+     * Constructs a value in place at the end of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns Reference to the new value
+     */
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+
+    /**
+     * Adds the provided value to the front of the list
+     * @returns Reference to the new value
+     */
+    T& push_front(const T& dt) {return emplace_front(dt);}
+    T& push_front(T&& dt) {return emplace_front(std::move(dt));}
+
+    /**
+     * Constructs a value in place at the front of the list
+     * @param args Arguments forwarded to T's constructor
+     * @returns Reference to the new value
+     */
+    template <class... Args>
+    T& emplace_front(Args&&... args);
+
+    /**
+     * Removes the value at the end of the list
+     * @throws std::invalid_argument if the list is empty
+     * @see pop_front()
+     */
+    void pop_back();
+
+    /**
+     * Removes the value at the front of the list [does nothing if the list is empty]
+     * @see pop_back()
+     */
+    void pop_front();
+
+    /**
+     * Inserts a value into the index provided
+     * @param dt Value to be inserted into the list
+     * @param idx Index where the value will be inserted
+     * @returns Reference to the new value
+     * @throws std::invalid_argument if idx isn't 0, and not smaller than size() [use push_back()]
+     */
+    T& insert_node(const T& dt, unsigned int idx) {return emplace_at(idx, dt);}
+    T& insert_node(T&& dt, unsigned int idx) {return emplace_at(idx, std::move(dt));}
+
+    /**
+     * Removes the value at the index provided
+     * @throws std::out_of_range if idx >= size()
+     */
+    void erase(unsigned int idx);
+
+    T& front() {return head->values()[0];}
+    const T& front() const {return head->values()[0];}
+    T& back() {return tail->values()[tail->count - 1];}
+    const T& back() const {return tail->values()[tail->count - 1];}
+
+    /**
+     * Returns the value at the index provided, skipping whole blocks on the way
+     */
+    T& operator[](unsigned int idx) {
+        std::size_t pos = idx;
+        block_type* blk = find(pos);
+        return blk->values()[pos];
+    }
+    const T& operator[](unsigned int idx) const {return const_cast<unrolled_list&>(*this)[idx];}
+
+    /**
+     * Returns the value at the index provided
+     * @throws std::out_of_range if idx >= size()
+     */
+    T& at(unsigned int idx) {
+        if (idx >= len)
+            throw std::out_of_range("Provided index exceeds list length.\n");
+        return (*this)[idx];
+    }
+    const T& at(unsigned int idx) const {return const_cast<unrolled_list&>(*this).at(idx);}
+
+    /**
+     * Returns the length of the list
+     * @return Length of the list
+     */
+    unsigned int size() const {return len;}
+    bool empty() const {return len == 0;}
+
+    iterator begin() {return iterator(head, 0, this);}
+    const_iterator begin() const {return const_iterator(head, 0, this);}
+    const_iterator cbegin() const {return const_iterator(head, 0, this);}
+
+    iterator end() {return iterator(nullptr, 0, this);}
+    const_iterator end() const {return const_iterator(nullptr, 0, this);}
+    const_iterator cend() const {return const_iterator(nullptr, 0, this);}
+
+    reverse_iterator rbegin() {return reverse_iterator(end());}
+    const_reverse_iterator rbegin() const {return const_reverse_iterator(end());}
+    reverse_iterator rend() {return reverse_iterator(begin());}
+    const_reverse_iterator rend() const {return const_reverse_iterator(begin());}
+
+    /**
+     * Frees every block of the list, leaving it empty
+     */
+    void clear();
+
+    /**
+     * Returns a copy of the allocator used by the list
+     * @return The list's allocator
+     */
+    allocator_type get_allocator() const {return allocator_type(alloc);}
+
+private:
+    /**
+     * Allocates an empty block, and links it right after the provided one [at the front, if after is nullptr]
+     */
+    block_type* insert_block(block_type* after);
+
+    /**
+     * Unlinks and frees an empty block
+     */
+    void remove_block(block_type* blk);
+
+    /**
+     * Finds the block which holds the value at index pos, from whichever end is closer. pos becomes the index inside of that block.
+     */
+    block_type* find(std::size_t& pos) const;
+
+    /**
+     * Constructs a value at index pos of a block which isn't full, shifting the values after it up by one
+     */
+    template <class... Args>
+    T& emplace_in_block(block_type* blk, std::size_t pos, Args&&... args);
+
+    /**
+     * Removes the value at index pos of a block, shifting the values after it down by one
+     */
+    void erase_in_block(block_type* blk, std::size_t pos);
+
+    /**
+     * Moves the upper half of a full block into a new block after it
+     */
+    void split_block(block_type* blk);
+
+    /**
+     * Merges the next block into blk, if blk is at most half full and both fit into one block. Frees blk if it's empty.
+     */
+    void rebalance(block_type* blk);
+
+    template <class... Args>
+    T& emplace_at(unsigned int idx, Args&&... args);
+};
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+unrolled_list<T, BlockCapacity, Alloc>::unrolled_list(const unrolled_list& list)
+    : alloc{block_traits::select_on_container_copy_construction(list.alloc)}, head{nullptr}, tail{nullptr}, len{0} {
+    // Copying with push_back packs the values into full blocks
+    try {
+        for (const T& value : list)
+            emplace_back(value);
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+unrolled_list<T, BlockCapacity, Alloc>::unrolled_list(unrolled_list&& list) noexcept
+    : alloc{std::move(list.alloc)}, head{list.head}, tail{list.tail}, len{list.len} {
+    list.head = list.tail = nullptr;
+    list.len = 0;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+unrolled_list<T, BlockCapacity, Alloc>& unrolled_list<T, BlockCapacity, Alloc>::operator=(const unrolled_list& list) {
+    if (this != &list) {
+        clear();
+        for (const T& value : list)
+            emplace_back(value);
+    }
+    return *this;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+unrolled_list<T, BlockCapacity, Alloc>& unrolled_list<T, BlockCapacity, Alloc>::operator=(unrolled_list&& list) noexcept {
+    if (this != &list) {
+        // Our blocks have to be freed with our own allocator, before it gets replaced
+        clear();
+        alloc = std::move(list.alloc);
+        head = list.head;
+        tail = list.tail;
+        len = list.len;
+        list.head = list.tail = nullptr;
+        list.len = 0;
+    }
+    return *this;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::clear() {
+    while (head != nullptr) {
+        block_type* blk = head;
+        head = head->next;
+        std::destroy(blk->values(), blk->values() + blk->count);
+        block_traits::destroy(alloc, blk);
+        block_traits::deallocate(alloc, blk, 1);
+    }
+    tail = nullptr;
+    len = 0;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+typename unrolled_list<T, BlockCapacity, Alloc>::block_type* unrolled_list<T, BlockCapacity, Alloc>::insert_block(block_type* after) {
+    block_type* blk = block_traits::allocate(alloc, 1);
+    block_traits::construct(alloc, blk);
+
+    blk->prev = after;
+    blk->next = (after == nullptr) ? head : after->next;
+    if (blk->prev != nullptr)
+        blk->prev->next = blk;
+    else
+        head = blk;
+    if (blk->next != nullptr)
+        blk->next->prev = blk;
+    else
+        tail = blk;
+    return blk;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::remove_block(block_type* blk) {
+    if (blk->prev != nullptr)
+        blk->prev->next = blk->next;
+    else
+        head = blk->next;
+    if (blk->next != nullptr)
+        blk->next->prev = blk->prev;
+    else
+        tail = blk->prev;
+
+    block_traits::destroy(alloc, blk);
+    block_traits::deallocate(alloc, blk, 1);
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+typename unrolled_list<T, BlockCapacity, Alloc>::block_type* unrolled_list<T, BlockCapacity, Alloc>::find(std::size_t& pos) const {
+    // Whole blocks are skipped by their counts, from the closer end
+    if (pos < len / 2) {
+        block_type* blk = head;
+        while (pos >= blk->count) {
+            pos -= blk->count;
+            blk = blk->next;
+        }
+        return blk;
+    }
+
+    std::size_t from_back = len - pos;
+    block_type* blk = tail;
+    while (from_back > blk->count) {
+        from_back -= blk->count;
+        blk = blk->prev;
+    }
+    pos = blk->count - from_back;
+    return blk;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+template <class... Args>
+T& unrolled_list<T, BlockCapacity, Alloc>::emplace_in_block(block_type* blk, std::size_t pos, Args&&... args) {
+    T* values = blk->values();
+    if (pos == blk->count)
+        ::new (static_cast<void*>(values + pos)) T(std::forward<Args>(args)...);
+    else {
+        // Build the value first, so a throwing constructor leaves the block as it was
+        T value(std::forward<Args>(args)...);
+        ::new (static_cast<void*>(values + blk->count)) T(std::move(values[blk->count - 1]));
+        std::move_backward(values + pos, values + blk->count - 1, values + blk->count);
+        values[pos] = std::move(value);
+    }
+    ++blk->count;
+    ++len;
+    return values[pos];
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::erase_in_block(block_type* blk, std::size_t pos) {
+    T* values = blk->values();
+    std::move(values + pos + 1, values + blk->count, values + pos);
+    std::destroy_at(values + blk->count - 1);
+    --blk->count;
+    --len;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::split_block(block_type* blk) {
+    block_type* upper = insert_block(blk);
+    const std::size_t keep = blk->count / 2;
+
+    T* from = blk->values();
+    T* to = upper->values();
+    for (std::size_t i = keep; i < blk->count; ++i) {
+        ::new (static_cast<void*>(to + (i - keep))) T(std::move(from[i]));
+        std::destroy_at(from + i);
+    }
+    upper->count = blk->count - keep;
+    blk->count = keep;
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::rebalance(block_type* blk) {
+    if (blk->count == 0) {
+        remove_block(blk);
+        return;
+    }
+
+    block_type* next = blk->next;
+    if (next == nullptr || blk->count > BlockCapacity / 2 || blk->count + next->count > BlockCapacity)
+        return;
+
+    T* to = blk->values() + blk->count;
+    T* from = next->values();
+    for (std::size_t i = 0; i < next->count; ++i) {
+        ::new (static_cast<void*>(to + i)) T(std::move(from[i]));
+        std::destroy_at(from + i);
+    }
+    blk->count += next->count;
+    next->count = 0;
+    remove_block(next);
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+template <class... Args>
+T& unrolled_list<T, BlockCapacity, Alloc>::emplace_back(Args&&... args) {
+    block_type* blk = tail;
+    if (blk == nullptr || blk->count == BlockCapacity)
+        blk = insert_block(tail);
+
+    try {
+        return emplace_in_block(blk, blk->count, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (blk->count == 0)
+            remove_block(blk);
+        throw;
+    }
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+template <class... Args>
+T& unrolled_list<T, BlockCapacity, Alloc>::emplace_front(Args&&... args) {
+    block_type* blk = head;
+    if (blk == nullptr || blk->count == BlockCapacity)
+        blk = insert_block(nullptr);
+
+    try {
+        return emplace_in_block(blk, 0, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (blk->count == 0)
+            remove_block(blk);
+        throw;
+    }
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+template <class... Args>
+T& unrolled_list<T, BlockCapacity, Alloc>::emplace_at(unsigned int idx, Args&&... args) {
+    if (idx == 0)
+        return emplace_front(std::forward<Args>(args)...);
+    else if (idx >= len)
+        throw std::invalid_argument("Provided index exceeds list length. Use push_back().\n");
+
+    std::size_t pos = idx;
+    block_type* blk = find(pos);
+    if (blk->count < BlockCapacity)
+        return emplace_in_block(blk, pos, std::forward<Args>(args)...);
+
+    // args may refer to a value the split is about to move (insert_node(l[6], 1)), so build it first
+    T value(std::forward<Args>(args)...);
+    split_block(blk);
+    if (pos > blk->count) {
+        pos -= blk->count;
+        blk = blk->next;
+    }
+    return emplace_in_block(blk, pos, std::move(value));
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::pop_back() {
+    // Error case
+    if (len == 0)
+        throw std::invalid_argument("Invalid removal. List length is 0.\n");
+
+    block_type* blk = tail;
+    erase_in_block(blk, blk->count - 1);
+    if (blk->count == 0)
+        remove_block(blk);
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::pop_front() {
+    if (head == nullptr)
+        return;
+
+    block_type* blk = head;
+    erase_in_block(blk, 0);
+    rebalance(blk);
+}
+
+template <class T, std::size_t BlockCapacity, class Alloc>
+void unrolled_list<T, BlockCapacity, Alloc>::erase(unsigned int idx) {
+    if (idx >= len)
+        throw std::out_of_range("Provided index exceeds list length.\n");
+
+    std::size_t pos = idx;
+    block_type* blk = find(pos);
+    erase_in_block(blk, pos);
+    rebalance(blk);
+}
+
+#endif // UNROLLED_LIST_H
@@ -0,0 +1,44 @@
+/**
+ * @file bench.hpp
+ * @brief Small helpers shared by the benchmarks: a timer, a sink the optimizer can't drop, and argument parsing
+ */
+#ifndef DS_BENCH_BENCH_H
+#define DS_BENCH_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+/**
+ * @brief Runs f once and returns how long it took, in seconds
+ */
+template <class F>
+double time_seconds(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Makes the compiler believe value is read, so the work that produced it isn't optimized away
+ */
+template <class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Returns the idx-th command line argument as a number, or fallback if it wasn't given.
+ * Every benchmark takes its problem size as the first argument, so the test suite can run them as a quick smoke test.
+ */
+inline std::size_t arg_or(int argc, char** argv, int idx, std::size_t fallback) {
+    return idx < argc ? static_cast<std::size_t>(std::strtoull(argv[idx], nullptr, 10)) : fallback;
+}
+
+#endif // DS_BENCH_BENCH_H
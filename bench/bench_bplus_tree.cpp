@@ -0,0 +1,70 @@
+// bplus_tree against bst (plain and AVL) and std::set: random inserts, random lookups and a full in-order scan.
+// Usage: bench_bplus_tree [keys = 2000000]
+#include "bench.hpp"
+#include "bplus_tree.hpp"
+#include "bst.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+template <class Tree>
+static bool contains(Tree& tree, int key) {
+    if constexpr (std::is_pointer_v<decltype(tree.find(key))>)
+        return tree.find(key) != nullptr;
+    else
+        return tree.find(key) != tree.end();
+}
+
+// bst and bplus_tree have for_each_in_range, std::set is walked with its iterators
+template <class Tree>
+static long long scan(const Tree& tree, int lo, int hi) {
+    long long sum = 0;
+    if constexpr (std::is_same_v<Tree, std::set<int>>) {
+        for (auto it = tree.lower_bound(lo); it != tree.end() && *it < hi; ++it)
+            sum += *it;
+    }
+    else
+        tree.for_each_in_range(lo, hi, [&](const int& value) {sum += value;});
+    return sum;
+}
+
+template <class Tree>
+static void run(const char* name, const std::vector<int>& keys, const std::vector<int>& queries) {
+    Tree tree;
+    const double insert = time_seconds([&] {
+        for (int key : keys)
+            tree.insert(key);
+    });
+    std::size_t found = 0;
+    const double find = time_seconds([&] {
+        for (int key : queries)
+            found += contains(tree, key) ? 1 : 0;
+    });
+    long long sum = 0;
+    const double full = time_seconds([&] {sum = scan(tree, 0, static_cast<int>(keys.size()));});
+    do_not_optimize(found);
+    do_not_optimize(sum);
+    const double n = static_cast<double>(keys.size());
+    std::printf("%-14s %12.1f %12.1f %12.2f %12.1f\n", name, insert * 1e9 / n, find * 1e9 / n, full * 1e9 / n, full * 1e3);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 2000000);
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+    std::vector<int> queries = keys;
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(2));
+
+    std::printf("%zu random keys\n", n);
+    std::printf("%-14s %12s %12s %12s %12s\n", "tree", "ns/insert", "ns/find", "ns/scanned", "scan ms");
+    run<bplus_tree<int>>("bplus_tree", keys, queries);
+    run<avl_tree<int>>("avl_tree", keys, queries);
+    run<bst<int>>("bst", keys, queries);
+    run<std::set<int>>("std::set", keys, queries);
+    return 0;
+}
@@ -0,0 +1,58 @@
+// Sorted versus random insertion into bst, avl_tree and std::set.
+// Sorted input turns the unbalanced bst into a list, so that row is capped at 20k keys.
+// Usage: bench_bst_insert [keys = 10000000]
+#include "bench.hpp"
+#include "bst.hpp"
+#include "node_pool.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+// bst::find returns a node [nullptr if there is none], std::set::find an iterator
+template <class Tree>
+static bool contains(Tree& tree, int key) {
+    if constexpr (std::is_pointer_v<decltype(tree.find(key))>)
+        return tree.find(key) != nullptr;
+    else
+        return tree.find(key) != tree.end();
+}
+
+template <class Tree>
+static void run(const char* name, const char* order, const std::vector<int>& keys) {
+    Tree tree;
+    const double insert = time_seconds([&] {
+        for (int key : keys)
+            tree.insert(key);
+    });
+    std::size_t found = 0;
+    const double find = time_seconds([&] {
+        for (int key : keys)
+            found += contains(tree, key) ? 1 : 0;
+    });
+    do_not_optimize(found);
+    std::printf("%-24s %-7s %10zu %12.1f %12.1f %12.1f\n", name, order, keys.size(), insert * 1e3, insert * 1e9 / keys.size(), find * 1e9 / keys.size());
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 10000000);
+    std::vector<int> sorted(n);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<int> shuffled = sorted;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+    const std::vector<int> sorted_small(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(n, 20000)));
+
+    std::printf("%-24s %-7s %10s %12s %12s %12s\n", "tree", "order", "keys", "insert ms", "ns/insert", "ns/find");
+    run<avl_tree<int>>("avl_tree", "sorted", sorted);
+    run<avl_tree<int>>("avl_tree", "random", shuffled);
+    run<avl_tree<int, node_pool<int>>>("avl_tree<node_pool>", "sorted", sorted);
+    run<avl_tree<int, node_pool<int>>>("avl_tree<node_pool>", "random", shuffled);
+    run<bst<int>>("bst", "sorted", sorted_small);
+    run<bst<int>>("bst", "random", shuffled);
+    run<std::set<int>>("std::set", "sorted", sorted);
+    run<std::set<int>>("std::set", "random", shuffled);
+    return 0;
+}
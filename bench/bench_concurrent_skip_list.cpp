@@ -0,0 +1,100 @@
+// Mixed lookups and updates on one shared ordered set: concurrent_skip_list against an avl_tree behind a std::shared_mutex.
+// Every thread runs the same mix of contains() and insert()/remove() of random keys, on a set that starts half full, at 1, 4, 16 and 64 threads.
+// Usage: bench_concurrent_skip_list [ops per thread = 200000] [max threads = 64]
+#include "bench.hpp"
+#include "concurrent_skip_list.hpp"
+#include "bst.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+constexpr int key_range = 1 << 20;
+
+/*!
+ * @class locked_tree
+ * @brief avl_tree with a reader-writer lock around it, the way a shared bst is used today
+ */
+class locked_tree {
+    avl_tree<int> tree;
+    std::shared_mutex m;
+
+public:
+    bool contains(int key) {
+        std::shared_lock<std::shared_mutex> lock(m);
+        return tree.find(key) != nullptr;
+    }
+    bool insert(int key) {
+        std::unique_lock<std::shared_mutex> lock(m);
+        if (tree.find(key) != nullptr)
+            return false;
+        tree.insert(key);
+        return true;
+    }
+    bool remove(int key) {
+        std::unique_lock<std::shared_mutex> lock(m);
+        if (tree.find(key) == nullptr)
+            return false;
+        tree.remove(key);
+        return true;
+    }
+};
+
+// Runs ops random operations on every thread, where writes_per_100 of every 100 are an insert or a remove. Returns millions of operations per second.
+template <class Set>
+static double run(Set& set, unsigned int threads, std::size_t ops, unsigned int writes_per_100) {
+    const double seconds = time_seconds([&] {
+        std::vector<std::thread> workers;
+        for (unsigned int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::mt19937 rng(t + 1);
+                std::size_t hits = 0;
+                for (std::size_t i = 0; i < ops; ++i) {
+                    const std::uint32_t r = rng();
+                    const int key = static_cast<int>(r % key_range);
+                    const unsigned int kind = (r >> 20) % 100;
+                    if (kind >= writes_per_100)
+                        hits += set.contains(key) ? 1 : 0;
+                    else if (kind % 2 == 0)
+                        hits += set.insert(key) ? 1 : 0;
+                    else
+                        hits += set.remove(key) ? 1 : 0;
+                }
+                do_not_optimize(hits);
+            });
+        }
+        for (std::thread& w : workers)
+            w.join();
+    });
+    return static_cast<double>(ops) * threads / seconds / 1e6;
+}
+
+// Both sets start with every even key
+template <class Set>
+static void fill(Set& set) {
+    for (int key = 0; key < key_range; key += 2)
+        set.insert(key);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t ops = arg_or(argc, argv, 1, 200000);
+    const std::size_t max_threads = arg_or(argc, argv, 2, 64);
+    std::printf("%zu operations per thread on %d keys, %u hardware threads\n", ops, key_range / 2, std::thread::hardware_concurrency());
+    std::printf("%8s %8s %22s %22s\n", "threads", "writes", "lock-free Mops/s", "shared_mutex Mops/s");
+
+    concurrent_skip_list<int> lock_free;
+    fill(lock_free);
+    locked_tree locked;
+    fill(locked);
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 4) {
+        for (unsigned int writes : {1u, 10u, 50u}) {
+            const double a = run(lock_free, threads, ops, writes);
+            const double b = run(locked, threads, ops, writes);
+            std::printf("%8u %7u%% %22.2f %22.2f\n", threads, writes, a, b);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Throughput of concurrent_stack against a stack<T> behind a std::mutex, with every thread doing push/pop pairs on the one shared stack.
+// Usage: bench_concurrent_stack [pairs per thread = 1000000] [max threads = 64]
+#include "bench.hpp"
+#include "concurrent_stack.hpp"
+#include "stack.hpp"
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+template <class Push, class Pop>
+static double run_threads(unsigned int threads, std::size_t pairs, Push push, Pop pop) {
+    return time_seconds([&] {
+        std::vector<std::thread> workers;
+        for (unsigned int t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                for (std::size_t i = 0; i < pairs; ++i) {
+                    push(static_cast<int>(i));
+                    pop();
+                }
+            });
+        }
+        for (std::thread& w : workers)
+            w.join();
+    });
+}
+
+int main(int argc, char** argv) {
+    const std::size_t pairs = arg_or(argc, argv, 1, 1000000);
+    const std::size_t max_threads = arg_or(argc, argv, 2, 64);
+    std::printf("%zu push/pop pairs per thread, %u hardware threads\n", pairs, std::thread::hardware_concurrency());
+    std::printf("%8s %22s %22s\n", "threads", "lock-free Mops/s", "mutex stack Mops/s");
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 2) {
+        concurrent_stack<int> lock_free;
+        const double a = run_threads(threads, pairs, [&](int v) {lock_free.push(v);}, [&] {
+            int out;
+            lock_free.try_pop(out);
+        });
+
+        stack<int> locked;
+        std::mutex m;
+        const double b = run_threads(threads, pairs, [&](int v) {
+            std::lock_guard<std::mutex> lock(m);
+            locked.push(v);
+        }, [&] {
+            std::lock_guard<std::mutex> lock(m);
+            if (!locked.empty())
+                locked.pop();
+        });
+
+        const double ops = 2.0 * static_cast<double>(pairs) * threads;
+        std::printf("%8u %22.2f %22.2f\n", threads, ops / a / 1e6, ops / b / 1e6);
+    }
+    return 0;
+}
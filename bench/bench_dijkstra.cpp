@@ -0,0 +1,157 @@
+// Dijkstra on a random graph with 1M edges, with pairing_heap against binary heaps as the priority queue.
+// pairing_heap and indexed_heap<2> decrease keys through handles, d_ary_heap<2> pushes duplicates and skips stale ones [lazy deletion, as with std::priority_queue].
+// Every run has to find the same distances.
+// Usage: bench_dijkstra [edges = 1000000]
+#include "bench.hpp"
+#include "heap.hpp"
+#include "pairing_heap.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using weight = std::uint64_t;
+using label = std::pair<weight, std::uint32_t>;
+constexpr weight unreached = std::numeric_limits<weight>::max();
+
+// Adjacency in compressed rows: the edges of v are targets[offsets[v]] ... targets[offsets[v + 1] - 1]
+struct csr {
+    std::vector<std::uint32_t> offsets, targets;
+    std::vector<weight> weights;
+};
+
+static csr random_graph(std::uint32_t vertices, std::size_t edges, unsigned int seed) {
+    std::mt19937 rng(seed);
+    csr g;
+    g.offsets.assign(vertices + 1, 0);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> list(edges);
+    for (auto& e : list) {
+        e = {static_cast<std::uint32_t>(rng() % vertices), static_cast<std::uint32_t>(rng() % vertices)};
+        ++g.offsets[e.first + 1];
+    }
+    for (std::uint32_t v = 0; v < vertices; ++v)
+        g.offsets[v + 1] += g.offsets[v];
+    g.targets.resize(edges);
+    g.weights.resize(edges);
+    std::vector<std::uint32_t> fill(g.offsets.begin(), g.offsets.end() - 1);
+    for (const auto& e : list) {
+        const std::uint32_t at = fill[e.first]++;
+        g.targets[at] = e.second;
+        g.weights[at] = 1 + rng() % 1000;
+    }
+    return g;
+}
+
+static std::vector<weight> with_pairing_heap(const csr& g) {
+    const std::size_t n = g.offsets.size() - 1;
+    std::vector<weight> distance(n, unreached);
+    std::vector<pairing_node<label>*> handle(n, nullptr);
+    pairing_heap<label, std::greater<label>> queue;
+    distance[0] = 0;
+    handle[0] = queue.push({0, 0});
+    while (!queue.empty()) {
+        const std::uint32_t u = queue.top().second;
+        queue.pop();
+        handle[u] = nullptr;
+        for (std::uint32_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+            const std::uint32_t v = g.targets[e];
+            const weight candidate = distance[u] + g.weights[e];
+            if (candidate >= distance[v])
+                continue;
+            distance[v] = candidate;
+            if (handle[v] != nullptr)
+                queue.decrease_key(handle[v], {candidate, v});
+            else
+                handle[v] = queue.push({candidate, v});
+        }
+    }
+    return distance;
+}
+
+static std::vector<weight> with_indexed_heap(const csr& g) {
+    using heap_type = indexed_heap<label, 2, std::greater<label>>;
+    const std::size_t n = g.offsets.size() - 1;
+    std::vector<weight> distance(n, unreached);
+    std::vector<heap_type::handle> handle(n);
+    std::vector<bool> queued(n, false);
+    heap_type queue;
+    distance[0] = 0;
+    handle[0] = queue.push({0, 0});
+    queued[0] = true;
+    while (!queue.empty()) {
+        const std::uint32_t u = queue.top().second;
+        queue.pop();
+        queued[u] = false;
+        for (std::uint32_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+            const std::uint32_t v = g.targets[e];
+            const weight candidate = distance[u] + g.weights[e];
+            if (candidate >= distance[v])
+                continue;
+            distance[v] = candidate;
+            if (queued[v])
+                queue.decrease_key(handle[v], {candidate, v});
+            else {
+                handle[v] = queue.push({candidate, v});
+                queued[v] = true;
+            }
+        }
+    }
+    return distance;
+}
+
+static std::vector<weight> with_lazy_binary_heap(const csr& g) {
+    const std::size_t n = g.offsets.size() - 1;
+    std::vector<weight> distance(n, unreached);
+    d_ary_heap<label, 2, std::greater<label>> queue;
+    distance[0] = 0;
+    queue.push({0, 0});
+    while (!queue.empty()) {
+        const label top = queue.top();
+        queue.pop();
+        if (top.first != distance[top.second])
+            continue;
+        const std::uint32_t u = top.second;
+        for (std::uint32_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+            const std::uint32_t v = g.targets[e];
+            const weight candidate = distance[u] + g.weights[e];
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                queue.push({candidate, v});
+            }
+        }
+    }
+    return distance;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t edges = arg_or(argc, argv, 1, 1000000);
+    const std::uint32_t vertices = static_cast<std::uint32_t>(edges / 10 > 0 ? edges / 10 : 1);
+    const csr g = random_graph(vertices, edges, 15);
+    std::printf("%u vertices, %zu edges, weights 1..1000\n", vertices, edges);
+    std::printf("%-32s %12s\n", "queue", "ms per run");
+
+    std::vector<weight> reference;
+    const auto row = [&](const char* name, std::vector<weight> (*run)(const csr&)) {
+        std::vector<weight> distance;
+        double best = 1e300;
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            const double t = time_seconds([&] {distance = run(g);});
+            best = t < best ? t : best;
+        }
+        if (reference.empty())
+            reference = distance;
+        else if (distance != reference) {
+            std::printf("%s found different distances\n", name);
+            std::exit(1);
+        }
+        std::printf("%-32s %12.1f\n", name, best * 1e3);
+    };
+    row("pairing_heap (decrease_key)", &with_pairing_heap);
+    row("indexed_heap<2> (decrease_key)", &with_indexed_heap);
+    row("d_ary_heap<2> (lazy deletion)", &with_lazy_binary_heap);
+    return 0;
+}
@@ -0,0 +1,54 @@
+// fenwick_tree against a prefix sum array that std::partial_sum rebuilds after every change, for counters which change as often as they're queried.
+// Also compares the O(n) bulk build against one std::partial_sum pass.
+// Usage: bench_fenwick [max size = 1000000]
+#include "bench.hpp"
+#include "fenwick_tree.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t max_size = arg_or(argc, argv, 1, 1000000);
+    std::mt19937 rng(20);
+    std::printf("%10s %16s %18s %22s %22s\n", "n", "assign() ms", "partial_sum ms", "fenwick update+query", "partial_sum upd+query");
+    for (std::size_t n = std::min<std::size_t>(1000, max_size); n <= max_size; n *= 10) {
+        std::vector<std::int64_t> values(n);
+        for (std::int64_t& v : values)
+            v = static_cast<std::int64_t>(rng() % 100);
+        std::vector<std::size_t> at(100000);
+        for (std::size_t& i : at)
+            i = rng() % n;
+
+        // Both builds write into memory which was already touched once
+        fenwick_tree<std::int64_t> tree(values.begin(), values.end());
+        const double build = time_seconds([&] {tree.assign(values.begin(), values.end());});
+        std::vector<std::int64_t> prefix(n);
+        const double build_prefix = time_seconds([&] {std::partial_sum(values.begin(), values.end(), prefix.begin());});
+
+        // Every step bumps one counter and reads one prefix sum
+        std::int64_t sink = 0;
+        const double fenwick = time_seconds([&] {
+            for (std::size_t k = 0; k < at.size(); ++k) {
+                tree.add(at[k], 1);
+                sink += tree.prefix_sum(at[at.size() - 1 - k]);
+            }
+        });
+        // The array has to be rebuilt after every change, so it runs fewer steps [at least 10]
+        const std::size_t steps = std::max<std::size_t>(10, std::min(at.size(), 100000000 / n));
+        const double recompute = time_seconds([&] {
+            for (std::size_t k = 0; k < steps; ++k) {
+                ++values[at[k]];
+                std::partial_sum(values.begin(), values.end(), prefix.begin());
+                sink += prefix[at[at.size() - 1 - k]];
+            }
+        });
+        do_not_optimize(sink);
+
+        std::printf("%10zu %16.3f %18.3f %19.1f ns %19.1f ns\n", n, build * 1e3, build_prefix * 1e3,
+                    fenwick / static_cast<double>(at.size()) * 1e9, recompute / static_cast<double>(steps) * 1e9);
+    }
+    return 0;
+}
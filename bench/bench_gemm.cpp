@@ -0,0 +1,70 @@
+// GFLOP/s of matrix's blocked SIMD GEMM for float and double, on square sizes from 64 up, against a naive i-k-j loop [which is only run up to 1024].
+// Usage: bench_gemm [max size = 4096]
+#include "bench.hpp"
+#include "matrix.hpp"
+#include <cstdio>
+#include <random>
+
+template <class T>
+static matrix<T> random_matrix(std::size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<T> dist(-1, 1);
+    matrix<T> m(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            m(i, j) = dist(rng);
+    return m;
+}
+
+template <class T>
+static void naive_product(const matrix<T>& a, const matrix<T>& b, matrix<T>& c) {
+    const std::size_t n = a.rows();
+    c.fill(T(0));
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t k = 0; k < n; ++k) {
+            const T aik = a(i, k);
+            for (std::size_t j = 0; j < n; ++j)
+                c(i, j) += aik * b(k, j);
+        }
+}
+
+// Repeats f until it ran for at least 0.2 seconds, and returns GFLOP/s of an n x n x n product
+template <class F>
+static double gflops(std::size_t n, F f) {
+    std::size_t repeats = 0;
+    double seconds = 0;
+    while (seconds < 0.2) {
+        seconds += time_seconds(f);
+        ++repeats;
+    }
+    return 2.0 * static_cast<double>(n) * n * n * repeats / seconds / 1e9;
+}
+
+template <class T>
+static void row(const char* name, std::size_t n, std::mt19937& rng) {
+    const matrix<T> a = random_matrix<T>(n, rng), b = random_matrix<T>(n, rng);
+    matrix<T> c(n, n);
+    const double blocked = gflops(n, [&] {
+        c = a * b;
+        do_not_optimize(c(0, 0));
+    });
+    if (n <= 1024) {
+        const double naive = gflops(n, [&] {
+            naive_product(a, b, c);
+            do_not_optimize(c(0, 0));
+        });
+        std::printf("%-7s %6zu %14.2f %14.2f\n", name, n, blocked, naive);
+    }
+    else
+        std::printf("%-7s %6zu %14.2f %14s\n", name, n, blocked, "-");
+}
+
+int main(int argc, char** argv) {
+    const std::size_t max_size = arg_or(argc, argv, 1, 4096);
+    std::mt19937 rng(16);
+    std::printf("%-7s %6s %14s %14s\n", "type", "n", "gemm GFLOP/s", "naive GFLOP/s");
+    for (std::size_t n = 64; n <= max_size; n *= 2)
+        row<float>("float", n, rng);
+    for (std::size_t n = 64; n <= max_size; n *= 2)
+        row<double>("double", n, rng);
+    return 0;
+}
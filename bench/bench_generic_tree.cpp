@@ -0,0 +1,94 @@
+// Construction, traversal and destruction of a 10M-node generic_tree, against a naive tree where every node owns a std::vector<std::unique_ptr<node>> of children.
+// Both trees get the same shape: nodes are filled in level order, with 1 to 15 children each [8 on average], like a large parsed document.
+// Usage: bench_generic_tree [nodes = 10000000]
+#include "bench.hpp"
+#include "generic_tree.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+
+struct naive_node {
+    int data;
+    std::vector<std::unique_ptr<naive_node>> children;
+    explicit naive_node(int dt) : data{dt}, children{} { }
+};
+
+static void naive_preorder(const naive_node* nd, std::uint64_t& sum) {
+    sum += static_cast<std::uint64_t>(nd->data);
+    for (const auto& c : nd->children)
+        naive_preorder(c.get(), sum);
+}
+
+static void naive_postorder(const naive_node* nd, std::uint64_t& sum) {
+    for (const auto& c : nd->children)
+        naive_postorder(c.get(), sum);
+    sum = sum * 3 + static_cast<std::uint64_t>(nd->data);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 10000000);
+    std::mt19937 rng(22);
+    std::vector<unsigned int> fanout(n);
+    for (unsigned int& f : fanout)
+        f = 1 + rng() % 15;
+
+    std::printf("%zu nodes, 1 to 15 children per node\n", n);
+    std::printf("%-12s %10s %14s %15s %15s %12s\n", "tree", "build ms", "pre-order ms", "post-order ms", "level-order ms", "destroy ms");
+
+    std::uint64_t pre = 0, post = 0, level = 0;
+    {
+        generic_tree<int> tree;
+        std::vector<tree_node<int>*> order;
+        order.reserve(n);
+        const double build = time_seconds([&] {
+            order.push_back(tree.emplace_root(0));
+            for (std::size_t i = 0; order.size() < n; ++i)
+                for (unsigned int c = 0; c < fanout[i] && order.size() < n; ++c)
+                    order.push_back(tree.emplace_back(order[i], static_cast<int>(order.size())));
+        });
+        order = std::vector<tree_node<int>*>();
+        const double t_pre = time_seconds([&] {tree.for_each_preorder([&](tree_node<int>* nd) {pre += static_cast<std::uint64_t>(nd->get_data());});});
+        const double t_post = time_seconds([&] {tree.for_each_postorder([&](tree_node<int>* nd) {post = post * 3 + static_cast<std::uint64_t>(nd->get_data());});});
+        const double t_level = time_seconds([&] {tree.for_each_level_order([&](tree_node<int>* nd) {level = level * 3 + static_cast<std::uint64_t>(nd->get_data());});});
+        const double destroy = time_seconds([&] {tree.clear();});
+        std::printf("%-12s %10.1f %14.1f %15.1f %15.1f %12.2f\n", "generic_tree", build * 1e3, t_pre * 1e3, t_post * 1e3, t_level * 1e3, destroy * 1e3);
+    }
+    {
+        std::unique_ptr<naive_node> root;
+        std::vector<naive_node*> order;
+        order.reserve(n);
+        const double build = time_seconds([&] {
+            root.reset(new naive_node(0));
+            order.push_back(root.get());
+            for (std::size_t i = 0; order.size() < n; ++i)
+                for (unsigned int c = 0; c < fanout[i] && order.size() < n; ++c) {
+                    order[i]->children.emplace_back(new naive_node(static_cast<int>(order.size())));
+                    order.push_back(order[i]->children.back().get());
+                }
+        });
+        order = std::vector<naive_node*>();
+        std::uint64_t naive_pre = 0, naive_post = 0, naive_level = 0;
+        const double t_pre = time_seconds([&] {naive_preorder(root.get(), naive_pre);});
+        const double t_post = time_seconds([&] {naive_postorder(root.get(), naive_post);});
+        const double t_level = time_seconds([&] {
+            std::deque<const naive_node*> todo{root.get()};
+            while (!todo.empty()) {
+                const naive_node* nd = todo.front();
+                todo.pop_front();
+                naive_level = naive_level * 3 + static_cast<std::uint64_t>(nd->data);
+                for (const auto& c : nd->children)
+                    todo.push_back(c.get());
+            }
+        });
+        const double destroy = time_seconds([&] {root.reset();});
+        std::printf("%-12s %10.1f %14.1f %15.1f %15.1f %12.2f\n", "naive", build * 1e3, t_pre * 1e3, t_post * 1e3, t_level * 1e3, destroy * 1e3);
+        if (naive_pre != pre || naive_post != post || naive_level != level) {
+            std::printf("the traversals disagree\n");
+            return 1;
+        }
+    }
+    return 0;
+}
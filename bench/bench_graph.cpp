@@ -0,0 +1,131 @@
+// BFS, DFS and Dijkstra on the CSR graph against the same searches on a std::vector<std::vector<int>> adjacency, on a random graph with 8 edges per vertex.
+// Both are built from the same edges, in the same random order, and have to give the same answers.
+// Usage: bench_graph [vertices = 1000000]
+#include "bench.hpp"
+#include "graph.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+using adjacency = std::vector<std::vector<int>>;
+using weighted_adjacency = std::vector<std::vector<std::pair<int, std::uint32_t>>>;
+
+static std::vector<std::uint32_t> naive_bfs(const adjacency& adj, int source) {
+    std::vector<std::uint32_t> depth(adj.size(), graph<>::unreached);
+    std::deque<int> todo{source};
+    depth[static_cast<std::size_t>(source)] = 0;
+    while (!todo.empty()) {
+        const int v = todo.front();
+        todo.pop_front();
+        for (int u : adj[static_cast<std::size_t>(v)])
+            if (depth[static_cast<std::size_t>(u)] == graph<>::unreached) {
+                depth[static_cast<std::size_t>(u)] = depth[static_cast<std::size_t>(v)] + 1;
+                todo.push_back(u);
+            }
+    }
+    return depth;
+}
+
+static std::vector<std::uint32_t> naive_dfs(const adjacency& adj, int source) {
+    std::vector<std::uint32_t> order;
+    std::vector<bool> visited(adj.size(), false);
+    std::vector<std::pair<int, std::size_t>> pending{{source, 0}};
+    visited[static_cast<std::size_t>(source)] = true;
+    order.push_back(static_cast<std::uint32_t>(source));
+    while (!pending.empty()) {
+        std::pair<int, std::size_t>& top = pending.back();
+        const std::vector<int>& out = adj[static_cast<std::size_t>(top.first)];
+        if (top.second == out.size()) {
+            pending.pop_back();
+            continue;
+        }
+        const int u = out[top.second++];
+        if (!visited[static_cast<std::size_t>(u)]) {
+            visited[static_cast<std::size_t>(u)] = true;
+            order.push_back(static_cast<std::uint32_t>(u));
+            pending.push_back({u, 0});
+        }
+    }
+    return order;
+}
+
+static std::vector<std::uint32_t> naive_dijkstra(const weighted_adjacency& adj, int source) {
+    std::vector<std::uint32_t> distance(adj.size(), std::numeric_limits<std::uint32_t>::max());
+    std::priority_queue<std::pair<std::uint32_t, int>, std::vector<std::pair<std::uint32_t, int>>, std::greater<std::pair<std::uint32_t, int>>> todo;
+    distance[static_cast<std::size_t>(source)] = 0;
+    todo.push({0, source});
+    while (!todo.empty()) {
+        const std::pair<std::uint32_t, int> top = todo.top();
+        todo.pop();
+        if (top.first != distance[static_cast<std::size_t>(top.second)])
+            continue;
+        for (const auto& edge : adj[static_cast<std::size_t>(top.second)]) {
+            const std::uint32_t candidate = top.first + edge.second;
+            if (candidate < distance[static_cast<std::size_t>(edge.first)]) {
+                distance[static_cast<std::size_t>(edge.first)] = candidate;
+                todo.push({candidate, edge.first});
+            }
+        }
+    }
+    return distance;
+}
+
+// Takes the best of 3 runs of f, and checks that it gave the expected result
+template <class F, class R>
+static double best_of_3(F f, const R& expected) {
+    double best = 1e300;
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        R result;
+        const double t = time_seconds([&] {result = f();});
+        if (result != expected) {
+            std::printf("results differ\n");
+            std::exit(1);
+        }
+        best = t < best ? t : best;
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 1000000);
+    const std::size_t m = 8 * n;
+    std::mt19937 rng(19);
+
+    graph_builder<std::uint32_t> builder(n);
+    adjacency adj(n);
+    weighted_adjacency weighted(n);
+    for (std::size_t e = 0; e < m; ++e) {
+        const std::uint32_t from = static_cast<std::uint32_t>(rng() % n), to = static_cast<std::uint32_t>(rng() % n);
+        const std::uint32_t weight = 1 + rng() % 1000;
+        builder.add_edge(from, to, weight);
+        adj[from].push_back(static_cast<int>(to));
+        weighted[from].push_back({static_cast<int>(to), weight});
+    }
+    const graph<std::uint32_t> g = builder.freeze();
+    thread_pool pool;
+
+    std::printf("%zu vertices, %zu edges, pool of %zu threads\n", n, m, pool.size());
+    std::printf("%-10s %14s %22s %10s\n", "search", "CSR ms", "vector<vector> ms", "speedup");
+    const auto row = [](const char* name, double csr, double naive) {
+        std::printf("%-10s %14.1f %22.1f %9.2fx\n", name, csr * 1e3, naive * 1e3, naive / csr);
+    };
+
+    const std::vector<std::uint32_t> depth = g.bfs(0);
+    const double naive_bfs_time = best_of_3([&] {return naive_bfs(adj, 0);}, depth);
+    row("bfs", best_of_3([&] {return g.bfs(0);}, depth), naive_bfs_time);
+    row("par. bfs", best_of_3([&] {return g.parallel_bfs(0, pool);}, depth), naive_bfs_time);
+
+    const std::vector<std::uint32_t> order = g.dfs(0);
+    row("dfs", best_of_3([&] {return g.dfs(0);}, order), best_of_3([&] {return naive_dfs(adj, 0);}, order));
+
+    const std::vector<std::uint32_t> distance = g.dijkstra(0);
+    row("dijkstra", best_of_3([&] {return g.dijkstra(0);}, distance), best_of_3([&] {return naive_dijkstra(weighted, 0);}, distance));
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Push/pop throughput of d_ary_heap with arity 2, 4 and 8 against std::priority_queue.
+// "fill+drain" pushes n random keys and pops them all. "hold" keeps n keys in the heap, and pops the top and pushes a later key n times, like a scheduler does.
+// Usage: bench_heap [max size = 4000000]
+#include "bench.hpp"
+#include "heap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+template <class Heap>
+static double fill_and_drain(const std::vector<std::uint32_t>& keys) {
+    return time_seconds([&] {
+        Heap heap;
+        for (std::uint32_t key : keys)
+            heap.push(key);
+        std::uint64_t sum = 0;
+        while (!heap.empty()) {
+            sum += heap.top();
+            heap.pop();
+        }
+        do_not_optimize(sum);
+    });
+}
+
+template <class Heap>
+static double hold(const std::vector<std::uint32_t>& keys) {
+    Heap heap;
+    for (std::uint32_t key : keys)
+        heap.push(key);
+    return time_seconds([&] {
+        // A min-heap of event times, every event schedules a later one
+        for (std::uint32_t key : keys) {
+            const std::uint32_t now = heap.top();
+            heap.pop();
+            heap.push(now + (key & 0xffff));
+        }
+        do_not_optimize(heap.top());
+    });
+}
+
+template <class Heap>
+static void row(const char* name, const std::vector<std::uint32_t>& keys) {
+    const double n = static_cast<double>(keys.size());
+    const double a = fill_and_drain<Heap>(keys);
+    const double b = hold<Heap>(keys);
+    std::printf("%-20s %10zu %22.1f %16.1f\n", name, keys.size(), a / (2 * n) * 1e9, b / (2 * n) * 1e9);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t max_size = arg_or(argc, argv, 1, 4000000);
+    using key = std::uint32_t;
+    using later = std::greater<key>;
+    std::printf("%-20s %10s %22s %16s\n", "heap", "n", "fill+drain ns/op", "hold ns/op");
+    for (std::size_t n = std::max<std::size_t>(max_size / 64, 1); n <= max_size; n *= 8) {
+        std::mt19937 rng(static_cast<unsigned int>(n));
+        std::vector<key> keys(n);
+        for (key& k : keys)
+            k = static_cast<key>(rng() >> 1);
+
+        row<d_ary_heap<key, 2, later>>("d_ary_heap<2>", keys);
+        row<d_ary_heap<key, 4, later>>("d_ary_heap<4>", keys);
+        row<d_ary_heap<key, 8, later>>("d_ary_heap<8>", keys);
+        row<std::priority_queue<key, std::vector<key>, later>>("std::priority_queue", keys);
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+// A full scan of sl_list, dl_list and bst: range-for over the iterators against the manual node loops they replace.
+// Usage: bench_iterators [size = 10000000]
+#include "bench.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include "bst.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+static void report(const char* name, const char* how, std::size_t n, double seconds) {
+    std::printf("%-10s %-16s %10.1f %12.2f\n", name, how, seconds * 1e3, seconds * 1e9 / static_cast<double>(n));
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 10000000);
+    sl_list<long long> l;
+    dl_list<long long> d;
+    for (std::size_t i = 0; i < n; ++i) {
+        l.push_back(static_cast<long long>(i));
+        d.push_back(static_cast<long long>(i));
+    }
+    // A tree with a tenth of the values, so building it doesn't dominate the run
+    std::vector<long long> keys(n / 10 + 1);
+    std::iota(keys.begin(), keys.end(), 0LL);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+    avl_tree<long long> b;
+    for (long long key : keys)
+        b.insert(key);
+
+    std::printf("%-10s %-16s %10s %12s\n", "container", "scan", "ms", "ns/value");
+    long long sum = 0;
+    report("sl_list", "range-for", n, time_seconds([&] {for (long long value : l) sum += value;}));
+    report("sl_list", "node loop", n, time_seconds([&] {
+        for (node<long long>* nd = l.get_head(); nd != nullptr; nd = nd->get_next())
+            sum += nd->get_data();
+    }));
+    report("dl_list", "range-for", n, time_seconds([&] {for (long long value : d) sum += value;}));
+    report("dl_list", "node loop", n, time_seconds([&] {
+        for (double_node<long long>* nd = d.get_head(); nd != nullptr; nd = nd->get_next())
+            sum += nd->get_data();
+    }));
+    report("dl_list", "reverse iterator", n, time_seconds([&] {sum = std::accumulate(d.rbegin(), d.rend(), sum);}));
+    report("avl_tree", "range-for", keys.size(), time_seconds([&] {for (long long value : b) sum += value;}));
+    report("avl_tree", "successor loop", keys.size(), time_seconds([&] {
+        for (auto nd = b.min(); nd != nullptr; nd = avl_tree<long long>::successor(nd))
+            sum += nd->data;
+    }));
+    do_not_optimize(sum);
+    return 0;
+}
@@ -0,0 +1,71 @@
+// kd_tree against brute force, for the 10 nearest neighbours of random queries among n uniform random points in 2, 3 and 8 dimensions.
+// Brute force computes every distance and keeps the 10 smallest with std::partial_sort. Both have to find the same distances.
+// Usage: bench_kd_tree [points = 1000000]
+#include "bench.hpp"
+#include "kd_tree.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+template <std::size_t K>
+static void row(std::size_t n, std::mt19937& rng) {
+    using tree_type = kd_tree<double, K>;
+    using point = typename tree_type::point_type;
+    constexpr std::size_t k = 10;
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<point> points(n);
+    for (point& p : points)
+        for (double& x : p)
+            x = dist(rng);
+    std::vector<point> queries(1000);
+    for (point& q : queries)
+        for (double& x : q)
+            x = dist(rng);
+
+    tree_type tree;
+    const double build = time_seconds([&] {tree.build(points.begin(), points.end());});
+
+    std::vector<std::vector<double>> found(queries.size());
+    const double tree_time = time_seconds([&] {
+        for (std::size_t q = 0; q < queries.size(); ++q)
+            for (const auto& nb : tree.k_nearest(queries[q], k))
+                found[q].push_back(nb.distance);
+    });
+
+    // Brute force is slow, so it only answers a few of the queries
+    const std::size_t brute_queries = std::max<std::size_t>(1, std::min<std::size_t>(queries.size(), 20000000 / n));
+    std::vector<double> all(n);
+    const double brute_time = time_seconds([&] {
+        for (std::size_t q = 0; q < brute_queries; ++q) {
+            for (std::size_t i = 0; i < n; ++i) {
+                double total = 0;
+                for (std::size_t d = 0; d < K; ++d)
+                    total += (queries[q][d] - points[i][d]) * (queries[q][d] - points[i][d]);
+                all[i] = total;
+            }
+            const std::size_t top = std::min(k, n);
+            std::partial_sort(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(top), all.end());
+            if (!std::equal(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(top), found[q].begin(), found[q].end())) {
+                std::printf("kd_tree and brute force disagree\n");
+                std::exit(1);
+            }
+        }
+    });
+
+    const double per_tree = tree_time / static_cast<double>(queries.size());
+    const double per_brute = brute_time / static_cast<double>(brute_queries);
+    std::printf("%4zu %10zu %12.1f %14.2f %17.2f %10.0fx\n", K, n, build * 1e3, per_tree * 1e6, per_brute * 1e6, per_brute / per_tree);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 1000000);
+    std::mt19937 rng(21);
+    std::printf("10 nearest neighbours of 1000 random queries, uniform points in [0, 1)^K\n");
+    std::printf("%4s %10s %12s %14s %17s %11s\n", "K", "points", "build ms", "kd_tree us/q", "brute force us/q", "speedup");
+    row<2>(n, rng);
+    row<3>(n, rng);
+    row<8>(n, rng);
+    return 0;
+}
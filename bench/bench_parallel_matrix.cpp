@@ -0,0 +1,58 @@
+// Scaling of matrix::gemm() and matrix::transpose() on a thread_pool, from 1 thread up to the amount of hardware threads.
+// Efficiency is the speedup over 1 thread divided by the amount of threads [1.0 is perfect scaling].
+// Usage: bench_parallel_matrix [size = 2048] [max threads = hardware threads]
+#include "bench.hpp"
+#include "matrix.hpp"
+#include "thread_pool.hpp"
+#include <cstdio>
+#include <random>
+#include <thread>
+
+// Repeats f until it ran for at least 0.2 seconds, and returns the average time of one run
+template <class F>
+static double seconds_per_run(F f) {
+    std::size_t repeats = 0;
+    double seconds = 0;
+    while (seconds < 0.2) {
+        seconds += time_seconds(f);
+        ++repeats;
+    }
+    return seconds / static_cast<double>(repeats);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 2048);
+    const std::size_t hardware = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    const std::size_t max_threads = arg_or(argc, argv, 2, hardware);
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    matrix<double> a(n, n), b(n, n), c(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j) {
+            a(i, j) = dist(rng);
+            b(i, j) = dist(rng);
+        }
+
+    std::printf("%zu x %zu doubles, %zu hardware threads\n", n, n, hardware);
+    std::printf("%8s %12s %9s %11s %16s %9s %11s\n", "threads", "gemm ms", "speedup", "efficiency", "transpose ms", "speedup", "efficiency");
+    double gemm_one = 0, transpose_one = 0;
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        thread_pool pool(threads);
+        const double g = seconds_per_run([&] {
+            matrix<double>::gemm(1.0, a, b, 0.0, c, pool);
+            do_not_optimize(c(0, 0));
+        });
+        const double t = seconds_per_run([&] {
+            const matrix<double> at = a.transpose(pool);
+            do_not_optimize(at(0, 0));
+        });
+        if (threads == 1) {
+            gemm_one = g;
+            transpose_one = t;
+        }
+        const double gs = gemm_one / g, ts = transpose_one / t;
+        std::printf("%8zu %12.1f %9.2f %11.2f %16.2f %9.2f %11.2f\n", threads, g * 1e3, gs, gs / threads, t * 1e3, ts, ts / threads);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Throughput and p99 latency of spsc_queue and mpmc_queue, with single and batch operations, for 1 to N producer/consumer pairs.
+// Producers push the time they pushed at, so a consumer can tell how long each value sat in the queue. Every 16th value is sampled.
+// Usage: bench_queue [values per producer = 1000000] [max pairs = 16]
+#include "bench.hpp"
+#include "queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct result {
+    double mops;
+    double p99_us;
+};
+
+// Runs pairs producers and pairs consumers over q, where each producer pushes count values, batch at a time
+template <class Queue>
+static result run(Queue& q, unsigned int pairs, std::size_t count, std::size_t batch) {
+    const std::size_t total = count * pairs;
+    std::atomic<std::size_t> popped{0};
+    std::vector<std::vector<std::uint64_t>> samples(pairs);
+    const double seconds = time_seconds([&] {
+        std::vector<std::thread> threads;
+        for (unsigned int p = 0; p < pairs; ++p) {
+            threads.emplace_back([&] {
+                std::uint64_t stamps[64];
+                for (std::size_t i = 0; i < count;) {
+                    const std::size_t n = std::min(batch, count - i);
+                    const std::uint64_t stamp = now_ns();
+                    std::fill(stamps, stamps + n, stamp);
+                    const std::size_t pushed = n == 1 ? static_cast<std::size_t>(q.try_push(stamp)) : q.try_push_n(stamps, n);
+                    i += pushed;
+                    if (pushed == 0)
+                        std::this_thread::yield();
+                }
+            });
+        }
+        for (unsigned int c = 0; c < pairs; ++c) {
+            threads.emplace_back([&, c] {
+                std::vector<std::uint64_t>& mine = samples[c];
+                std::uint64_t out[64];
+                std::size_t seen = 0;
+                while (popped.load(std::memory_order_relaxed) < total) {
+                    const std::size_t n = batch == 1 ? static_cast<std::size_t>(q.try_pop(out[0])) : q.try_pop_n(out, batch);
+                    if (n == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    const std::uint64_t now = now_ns();
+                    for (std::size_t k = 0; k < n; ++k)
+                        if (seen++ % 16 == 0)
+                            mine.push_back(now - out[k]);
+                    popped.fetch_add(n, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& t : threads)
+            t.join();
+    });
+
+    std::vector<std::uint64_t> all;
+    for (const std::vector<std::uint64_t>& mine : samples)
+        all.insert(all.end(), mine.begin(), mine.end());
+    const std::size_t at = all.size() * 99 / 100;
+    std::nth_element(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(at), all.end());
+    return {2.0 * static_cast<double>(total) / seconds / 1e6, static_cast<double>(all[at]) / 1e3};
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = arg_or(argc, argv, 1, 1000000);
+    const std::size_t max_pairs = arg_or(argc, argv, 2, 16);
+    std::printf("%zu values per producer, ring of 1024, %u hardware threads\n", count, std::thread::hardware_concurrency());
+    std::printf("%-6s %6s %6s %12s %14s\n", "queue", "pairs", "batch", "Mops/s", "p99 latency us");
+    for (std::size_t batch : {std::size_t(1), std::size_t(16)}) {
+        spsc_queue<std::uint64_t> q(1024);
+        const result r = run(q, 1, count, batch);
+        std::printf("%-6s %6u %6zu %12.2f %14.1f\n", "spsc", 1u, batch, r.mops, r.p99_us);
+    }
+    for (unsigned int pairs = 1; pairs <= max_pairs; pairs *= 2) {
+        for (std::size_t batch : {std::size_t(1), std::size_t(16)}) {
+            mpmc_queue<std::uint64_t> q(1024);
+            const result r = run(q, pairs, count, batch);
+            std::printf("%-6s %6u %6zu %12.2f %14.1f\n", "mpmc", pairs, batch, r.mops, r.p99_us);
+        }
+    }
+    return 0;
+}
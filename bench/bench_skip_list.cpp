@@ -0,0 +1,102 @@
+// indexed_skip_list against sl_list and dl_list: insert_node and reads at random positions of a long list.
+// Also skip_list against avl_tree and std::set as an ordered set: random inserts, lookups and removes.
+// Usage: bench_skip_list [size = 1000000]
+#include "bench.hpp"
+#include "skip_list.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include "bst.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+// sl_list and dl_list have no operator[], so a read walks an iterator to the position
+template <class List>
+static int value_at(const List& list, unsigned int idx) {
+    if constexpr (std::is_same_v<List, indexed_skip_list<int>>)
+        return list[idx];
+    else
+        return *std::next(list.begin(), idx);
+}
+
+// Every list is built with push_back, then gets the same inserts and reads. Prints the time per insert and per read, in us.
+template <class List>
+static void run_positional(const char* name, std::size_t n, const std::vector<unsigned int>& at) {
+    List list;
+    for (std::size_t i = 0; i < n; ++i)
+        list.push_back(static_cast<int>(i));
+    const double insert = time_seconds([&] {
+        for (std::size_t k = 0; k < at.size(); ++k)
+            list.insert_node(static_cast<int>(k), at[k]);
+    });
+    long long sink = 0;
+    const double read = time_seconds([&] {
+        for (std::size_t k = 0; k < at.size(); ++k)
+            sink += value_at(list, at[at.size() - 1 - k]);
+    });
+    do_not_optimize(sink);
+    const double count = static_cast<double>(at.size());
+    std::printf("%-20s %14.3f %14.3f\n", name, insert / count * 1e6, read / count * 1e6);
+}
+
+// skip_list and bst return a node from find [nullptr if there is none], std::set an iterator
+template <class Set>
+static void run_ordered(const char* name, const std::vector<int>& keys, const std::vector<int>& queries) {
+    Set set;
+    const double insert = time_seconds([&] {
+        for (int key : keys)
+            set.insert(key);
+    });
+    std::size_t found = 0;
+    const double find = time_seconds([&] {
+        for (int key : queries) {
+            if constexpr (std::is_same_v<Set, std::set<int>>)
+                found += set.find(key) != set.end() ? 1 : 0;
+            else
+                found += set.find(key) != nullptr ? 1 : 0;
+        }
+    });
+    const double remove = time_seconds([&] {
+        for (int key : queries) {
+            if constexpr (std::is_same_v<Set, std::set<int>>)
+                set.erase(key);
+            else
+                set.remove(key);
+        }
+    });
+    do_not_optimize(found);
+    const double n = static_cast<double>(keys.size());
+    std::printf("%-20s %14.1f %14.1f %14.1f\n", name, insert / n * 1e9, find / n * 1e9, remove / n * 1e9);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 1000000);
+    std::mt19937 rng(24);
+
+    // The node lists walk to every position, so they only get a few hundred inserts
+    std::vector<unsigned int> at(std::max<std::size_t>(20, std::min<std::size_t>(2000, 200000000 / n)));
+    for (std::size_t k = 0; k < at.size(); ++k)
+        at[k] = static_cast<unsigned int>(rng() % (n + k));
+    std::printf("%zu values, %zu inserts and reads at random positions\n", n, at.size());
+    std::printf("%-20s %14s %14s\n", "list", "us/insert_node", "us/read");
+    run_positional<indexed_skip_list<int>>("indexed_skip_list", n, at);
+    run_positional<sl_list<int>>("sl_list", n, at);
+    run_positional<dl_list<int>>("dl_list", n, at);
+
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::vector<int> queries = keys;
+    std::shuffle(queries.begin(), queries.end(), rng);
+    std::printf("\n%zu random keys\n", n);
+    std::printf("%-20s %14s %14s %14s\n", "set", "ns/insert", "ns/find", "ns/remove");
+    run_ordered<skip_list<int>>("skip_list", keys, queries);
+    run_ordered<avl_tree<int>>("avl_tree", keys, queries);
+    run_ordered<std::set<int>>("std::set", keys, queries);
+    return 0;
+}
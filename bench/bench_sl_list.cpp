@@ -0,0 +1,32 @@
+// sl_list push_back and pop_back at growing sizes: with the tail pointer and the spine, time per operation stays flat as the list grows.
+// Usage: bench_sl_list [max_size = 10000000]
+#include "bench.hpp"
+#include "sl_list.hpp"
+#include "node_pool.hpp"
+#include <algorithm>
+#include <cstdio>
+
+template <class List>
+static void run(const char* name, std::size_t max_size) {
+    std::printf("%-22s %10s %12s %12s %12s %12s\n", name, "n", "append ms", "ns/append", "pop_back ms", "ns/pop_back");
+    for (std::size_t n = std::max<std::size_t>(max_size / 8, 1); n <= max_size; n *= 2) {
+        List list;
+        const double append = time_seconds([&] {
+            for (std::size_t i = 0; i < n; ++i)
+                list.push_back(static_cast<int>(i));
+        });
+        do_not_optimize(list.get_tail()->get_data());
+        const double pop = time_seconds([&] {
+            while (list.size() != 0)
+                list.pop_back();
+        });
+        std::printf("%-22s %10zu %12.1f %12.2f %12.1f %12.2f\n", "", n, append * 1e3, append * 1e9 / n, pop * 1e3, pop * 1e9 / n);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t max_size = arg_or(argc, argv, 1, 10000000);
+    run<sl_list<int>>("sl_list<int>", max_size);
+    run<sl_list<int, node_pool<int>>>("sl_list<int, node_pool>", max_size);
+    return 0;
+}
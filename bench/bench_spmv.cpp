@@ -0,0 +1,65 @@
+// Memory footprint and matrix-vector throughput of csr_matrix against a dense matrix, on n x n matrices with 0.01% to 5% non-zeros.
+// The dense product is a plain dot product per row, which streams the whole matrix.
+// Usage: bench_spmv [n = 4096]
+#include "bench.hpp"
+#include "sparse_matrix.hpp"
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Repeats f until it ran for at least 0.2 seconds, and returns the average time of one run
+template <class F>
+static double seconds_per_run(F f) {
+    std::size_t repeats = 0;
+    double seconds = 0;
+    while (seconds < 0.2) {
+        seconds += time_seconds(f);
+        ++repeats;
+    }
+    return seconds / static_cast<double>(repeats);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = arg_or(argc, argv, 1, 4096);
+    std::mt19937 rng(18);
+    thread_pool pool;
+    std::vector<double> x(n, 1.0), y(n);
+
+    matrix<double> dense(n, n);
+    const double dense_mv = seconds_per_run([&] {
+        for (std::size_t r = 0; r < n; ++r) {
+            const double* row = dense.row(r);
+            double sum = 0;
+            for (std::size_t c = 0; c < n; ++c)
+                sum += row[c] * x[c];
+            y[r] = sum;
+        }
+        do_not_optimize(y[0]);
+    });
+    const double dense_mb = static_cast<double>(n * dense.stride() * sizeof(double)) / 1e6;
+
+    std::printf("%zu x %zu doubles, dense: %.1f MB, %.2f ms per product, pool of %zu threads\n", n, n, dense_mb, dense_mv * 1e3, pool.size());
+    std::printf("%9s %10s %11s %13s %15s %13s %15s\n", "density", "nnz", "sparse MB", "memory saved", "SpMV ms", "vs dense", "pool SpMV ms");
+    for (double density : {0.0001, 0.001, 0.01, 0.05}) {
+        coo_builder<double> builder(n, n);
+        const std::size_t count = static_cast<std::size_t>(density * static_cast<double>(n) * static_cast<double>(n));
+        builder.reserve(count);
+        for (std::size_t k = 0; k < count; ++k)
+            builder.add(rng() % n, rng() % n, 1.0);
+        const csr_matrix<double> sparse = builder.build();
+
+        const double serial = seconds_per_run([&] {
+            sparse.multiply(x.data(), y.data());
+            do_not_optimize(y[0]);
+        });
+        const double parallel = seconds_per_run([&] {
+            sparse.multiply(x.data(), y.data(), pool);
+            do_not_optimize(y[0]);
+        });
+        const double sparse_mb = static_cast<double>(sparse.memory_bytes()) / 1e6;
+        std::printf("%8.2f%% %10zu %11.2f %12.0fx %15.3f %12.0fx %15.3f\n", density * 100, sparse.nnz(), sparse_mb, dense_mb / sparse_mb,
+                    serial * 1e3, dense_mv / serial, parallel * 1e3);
+    }
+    return 0;
+}
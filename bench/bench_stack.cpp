@@ -0,0 +1,39 @@
+// Push/pop throughput of stack on the contiguous stack_array backend against the sl_list based stack_list, with and without node_pool.
+// Usage: bench_stack [depth = 10000] [rounds = 200]
+#include "bench.hpp"
+#include "stack.hpp"
+#include "node_pool.hpp"
+#include <cstdio>
+#include <stack>
+#include <vector>
+
+template <class Stack>
+static void run(const char* name, std::size_t depth, std::size_t rounds) {
+    Stack s;
+    long long sum = 0;
+    const double seconds = time_seconds([&] {
+        for (std::size_t r = 0; r < rounds; ++r) {
+            for (std::size_t i = 0; i < depth; ++i)
+                s.push(static_cast<int>(i));
+            while (!s.empty()) {
+                sum += s.top();
+                s.pop();
+            }
+        }
+    });
+    do_not_optimize(sum);
+    std::printf("%-28s %10.1f %14.2f\n", name, seconds * 1e3, seconds * 1e9 / static_cast<double>(depth * rounds));
+}
+
+int main(int argc, char** argv) {
+    const std::size_t depth = arg_or(argc, argv, 1, 10000);
+    const std::size_t rounds = arg_or(argc, argv, 2, 200);
+    std::printf("%zu rounds of %zu pushes and pops\n", rounds, depth);
+    std::printf("%-28s %10s %14s\n", "stack", "ms", "ns/push+pop");
+    run<stack<int>>("stack_array", depth, rounds);
+    run<small_stack<int, 64>>("stack_array, 64 inline", depth, rounds);
+    run<stack<int, stack_list<int>>>("stack_list", depth, rounds);
+    run<stack<int, stack_list<int, node_pool<int>>>>("stack_list on node_pool", depth, rounds);
+    run<std::stack<int, std::vector<int>>>("std::stack<vector>", depth, rounds);
+    return 0;
+}
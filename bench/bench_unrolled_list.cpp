@@ -0,0 +1,86 @@
+// unrolled_list against sl_list and dl_list: a full scan, and insert_node at random positions.
+// The scans are run on lists built in order [nodes next to each other in memory] and on aged ones, whose nodes were linked in a shuffled allocation order.
+// Usage: bench_unrolled_list [max size = 1000000]
+#include "bench.hpp"
+#include "unrolled_list.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Repeats the scan until 0.2 s have passed, and returns the time per element in ns
+template <class List>
+static double scan_ns(const List& list, std::size_t n) {
+    long long sink = 0;
+    std::size_t runs = 0;
+    double total = 0;
+    while (total < 0.2) {
+        total += time_seconds([&] {sink += std::accumulate(list.begin(), list.end(), 0LL);});
+        ++runs;
+    }
+    do_not_optimize(sink);
+    return total / static_cast<double>(runs * n) * 1e9;
+}
+
+template <class List>
+static double insert_us(List& list, const std::vector<unsigned int>& at) {
+    const double total = time_seconds([&] {
+        for (std::size_t k = 0; k < at.size(); ++k)
+            list.insert_node(static_cast<int>(k), at[k]);
+    });
+    return total / static_cast<double>(at.size()) * 1e6;
+}
+
+// Links n new'd nodes in the order 0..n-1, but allocated in a random order, like a list which has seen a lot of inserts and erases
+template <class List, class Node>
+static void build_aged(List& list, std::size_t n, std::mt19937& rng) {
+    std::vector<Node*> nodes(n);
+    for (std::size_t i = 0; i < n; ++i)
+        nodes[i] = new Node(static_cast<int>(i));
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+    std::vector<Node*> shuffled(n);
+    for (std::size_t i = 0; i < n; ++i)
+        shuffled[static_cast<std::size_t>(order[i])] = nodes[i];
+    for (Node* nd : shuffled)
+        list.push_back(nd);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t max_size = arg_or(argc, argv, 1, 1000000);
+    std::mt19937 rng(23);
+    std::printf("unrolled_list<int> holds %zu values per block\n", unrolled_block_capacity<int>());
+    std::printf("%9s | %-28s | %-15s | %s\n", "", "scan, in order (ns/value)", "aged (ns/value)", "insert_node (us/insert)");
+    std::printf("%9s | %8s %8s %9s  | %7s %7s | %8s %9s %9s\n", "n", "unrolled", "sl_list", "dl_list", "sl_list", "dl_list", "unrolled", "sl_list", "dl_list");
+    for (std::size_t n = std::min<std::size_t>(1000, max_size); n <= max_size; n *= 10) {
+        unrolled_list<int> u;
+        sl_list<int> s;
+        dl_list<int> d;
+        for (std::size_t i = 0; i < n; ++i) {
+            u.push_back(static_cast<int>(i));
+            s.push_back(static_cast<int>(i));
+            d.push_back(static_cast<int>(i));
+        }
+        sl_list<int> s_aged;
+        dl_list<int> d_aged;
+        build_aged<sl_list<int>, node<int>>(s_aged, n, rng);
+        build_aged<dl_list<int>, double_node<int>>(d_aged, n, rng);
+
+        const double scan_u = scan_ns(u, n), scan_s = scan_ns(s, n), scan_d = scan_ns(d, n);
+        const double aged_s = scan_ns(s_aged, n), aged_d = scan_ns(d_aged, n);
+
+        // The node lists walk to the position, so they run fewer inserts on long lists [at least 20]
+        std::vector<unsigned int> at(std::max<std::size_t>(20, std::min<std::size_t>(2000, 20000000 / n)));
+        for (std::size_t k = 0; k < at.size(); ++k)
+            at[k] = static_cast<unsigned int>(rng() % (n + k));
+        const double ins_u = insert_us(u, at), ins_s = insert_us(s, at), ins_d = insert_us(d, at);
+
+        std::printf("%9zu | %8.2f %8.2f %9.2f  | %7.2f %7.2f | %8.3f %9.2f %9.2f\n",
+                    n, scan_u, scan_s, scan_d, aged_s, aged_d, ins_u, ins_s, ins_d);
+    }
+    return 0;
+}
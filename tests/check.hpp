@@ -0,0 +1,57 @@
+/**
+ * @file check.hpp
+ * @brief Small helpers shared by the tests: a CHECK macro that works in release builds, and an allocator that counts live bytes
+ */
+#ifndef DS_TESTS_CHECK_H
+#define DS_TESTS_CHECK_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Like assert(), but it isn't compiled out by NDEBUG, and it names the failed condition before aborting
+ */
+#define CHECK(cond) ((cond) ? void(0) : ::check_failed(#cond, __FILE__, __LINE__))
+
+[[noreturn]] inline void check_failed(const char* cond, const char* file, int line) {
+    std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, cond);
+    std::abort();
+}
+
+/**
+ * @brief Bytes currently allocated through any counting_allocator
+ */
+inline std::ptrdiff_t live_bytes = 0;
+
+/*!
+ * @class counting_allocator
+ * @brief std::allocator that keeps live_bytes up to date, so a test can prove that a container gave back everything it took.
+ * @tparam T class
+ */
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) { }
+
+    T* allocate(std::size_t n) {
+        live_bytes += static_cast<std::ptrdiff_t>(n * sizeof(T));
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        live_bytes -= static_cast<std::ptrdiff_t>(n * sizeof(T));
+        ::operator delete(p);
+    }
+
+    template <class U>
+    friend bool operator==(const counting_allocator&, const counting_allocator<U>&) {return true;}
+    template <class U>
+    friend bool operator!=(const counting_allocator&, const counting_allocator<U>&) {return false;}
+};
+
+#endif // DS_TESTS_CHECK_H
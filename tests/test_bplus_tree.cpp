@@ -0,0 +1,94 @@
+// bplus_tree against std::set: random inserts and removes across several node sizes, with queries and range scans along the way.
+#include "check.hpp"
+#include "bplus_tree.hpp"
+#include "node_pool.hpp"
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <class Tree>
+static std::vector<int> values_of(const Tree& tree, int range) {
+    std::vector<int> values;
+    tree.for_each_in_range(-1, range, [&](const int& value) {values.push_back(value);});
+    return values;
+}
+
+template <class Tree>
+static void check_queries(const Tree& tree, const std::set<int>& model, int q, int lo, int hi) {
+    CHECK(tree.size() == model.size());
+    CHECK((tree.find(q) != nullptr) == (model.count(q) != 0));
+
+    const int* next = tree.successor(q);
+    const auto after = model.upper_bound(q);
+    CHECK((next == nullptr) == (after == model.end()));
+    if (next != nullptr)
+        CHECK(*next == *after);
+
+    const int* prev = tree.predecessor(q);
+    auto before = model.lower_bound(q);
+    if (before == model.begin())
+        CHECK(prev == nullptr);
+    else {
+        --before;
+        CHECK(prev != nullptr && *prev == *before);
+    }
+
+    if (!model.empty()) {
+        CHECK(*tree.min() == *model.begin());
+        CHECK(*tree.max() == *model.rbegin());
+    }
+
+    std::vector<int> got;
+    tree.for_each_in_range(lo, hi, [&](const int& value) {got.push_back(value);});
+    CHECK(got == std::vector<int>(model.lower_bound(lo), model.lower_bound(hi)));
+}
+
+template <class Tree>
+static void random_operations(unsigned int seed, int range, int count) {
+    std::mt19937 rng(seed);
+    std::set<int> model;
+    Tree tree;
+    for (int i = 0; i < count; ++i) {
+        const int key = static_cast<int>(rng() % range);
+        if (rng() % 3 != 0 && rng() % 4 != 0) {
+            const int* inserted = tree.insert(key);
+            CHECK((inserted != nullptr) == model.insert(key).second);
+            if (inserted != nullptr)
+                CHECK(*inserted == key);
+        }
+        else
+            CHECK(tree.remove(key) == (model.erase(key) != 0));
+
+        if (i % 997 == 0) {
+            const int lo = static_cast<int>(rng() % range);
+            check_queries(tree, model, static_cast<int>(rng() % range), lo, lo + static_cast<int>(rng() % 100));
+        }
+    }
+
+    const std::vector<int> expected(model.begin(), model.end());
+    Tree copy(tree);
+    CHECK(values_of(copy, range) == expected);
+    Tree moved(std::move(copy));
+    moved = tree;
+    CHECK(values_of(moved, range) == expected);
+    tree.clear();
+    CHECK(tree.empty());
+    for (int value : expected)
+        CHECK(moved.remove(value));
+    CHECK(moved.empty());
+}
+
+int main() {
+    random_operations<bplus_tree<int, std::allocator<int>, 64>>(1, 3000, 300000);
+    random_operations<bplus_tree<int, std::allocator<int>, 128>>(2, 100000, 300000);
+    random_operations<bplus_tree<int>>(3, 1000000, 300000);
+    random_operations<bplus_tree<int, node_pool<int>>>(4, 50000, 300000);
+
+    bplus_tree<std::string> strings;
+    strings.insert("b");
+    strings.insert(std::string("a"));
+    CHECK(*strings.min() == "a");
+    return 0;
+}
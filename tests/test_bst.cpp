@@ -0,0 +1,186 @@
+// bst and its AVL policy: random inserts and removes against std::multiset, with the tree's links, order and balance checked along the way.
+// Also checks the range queries, and select() and rank() of ranked trees, against std::multiset.
+#include "check.hpp"
+#include "bst.hpp"
+#include "node_pool.hpp"
+#include <cstddef>
+#include <random>
+#include <iterator>
+#include <set>
+#include <vector>
+
+// Checks parent links and ordering below nd, and for AVL trees the stored heights and the balance. Returns the height.
+template <class Tree>
+static int check_structure(const typename Tree::node_type* nd, const typename Tree::node_type* parent) {
+    if (nd == nullptr)
+        return 0;
+    CHECK(nd->parent == parent);
+    if (nd->left != nullptr)
+        CHECK(!(nd->data < nd->left->data));
+    if (nd->right != nullptr)
+        CHECK(!(nd->right->data < nd->data));
+    const int l = check_structure<Tree>(nd->left, nd);
+    const int r = check_structure<Tree>(nd->right, nd);
+    const int h = 1 + (l > r ? l : r);
+    if constexpr (Tree::node_type::balanced) {
+        CHECK(l - r <= 1 && r - l <= 1);
+        CHECK(nd->height == h);
+    }
+    return h;
+}
+
+template <class Tree>
+static void check_same(Tree& tree, const std::multiset<int>& model) {
+    check_structure<Tree>(tree.get_root(), nullptr);
+    auto nd = tree.min();
+    for (int value : model) {
+        CHECK(nd != nullptr && nd->data == value);
+        nd = Tree::successor(nd);
+    }
+    CHECK(nd == nullptr);
+}
+
+template <class Tree>
+static void random_operations(unsigned int count, int range, unsigned int seed) {
+    std::mt19937 rng(seed);
+    Tree tree;
+    std::multiset<int> model;
+    for (unsigned int i = 0; i < count; ++i) {
+        const int key = static_cast<int>(rng() % range);
+        if (rng() % 2 == 0) {
+            tree.insert(key);
+            model.insert(key);
+        }
+        else {
+            const bool had = model.count(key) != 0;
+            const auto next = tree.remove(key);
+            if (had) {
+                model.erase(model.find(key));
+                // remove() returns the node after the removed one, which may hold an equal value
+                if (next != nullptr)
+                    CHECK(!(next->data < key) && model.count(next->data) != 0);
+                else
+                    CHECK(model.upper_bound(key) == model.end());
+            }
+            else
+                CHECK(next == nullptr);
+        }
+        CHECK((tree.find(key) != nullptr) == (model.count(key) != 0));
+        if (i % 10000 == 0)
+            check_same(tree, model);
+    }
+    check_same(tree, model);
+
+    Tree copy(tree);
+    check_same(copy, model);
+}
+
+template <class Tree>
+static void range_queries(unsigned int seed) {
+    std::mt19937 rng(seed);
+    Tree tree;
+    std::multiset<int> model;
+    for (int i = 0; i < 20000; ++i) {
+        const int key = static_cast<int>(rng() % 5000);
+        tree.insert(key);
+        model.insert(key);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        const int key = static_cast<int>(rng() % 5000);
+        if (model.count(key) != 0) {
+            tree.remove(key);
+            model.erase(model.find(key));
+        }
+    }
+
+    for (int q = 0; q < 3000; ++q) {
+        const int lo = static_cast<int>(rng() % 5200) - 100;
+        const int hi = lo + static_cast<int>(rng() % 300);
+
+        const auto lower = tree.lower_bound(lo);
+        const auto model_lower = model.lower_bound(lo);
+        CHECK((lower == tree.end()) == (model_lower == model.end()));
+        if (model_lower != model.end())
+            CHECK(*lower == *model_lower);
+
+        const auto upper = tree.upper_bound(lo);
+        const auto model_upper = model.upper_bound(lo);
+        CHECK((upper == tree.end()) == (model_upper == model.end()));
+        if (model_upper != model.end())
+            CHECK(*upper == *model_upper);
+
+        const auto range = tree.equal_range(lo);
+        CHECK(static_cast<std::size_t>(std::distance(range.first, range.second)) == model.count(lo));
+
+        std::vector<int> got;
+        tree.for_each_in_range(lo, hi, [&](const int& value) {got.push_back(value);});
+        CHECK(got == std::vector<int>(model.lower_bound(lo), model.lower_bound(hi)));
+    }
+}
+
+// Checks the stored sub-tree sizes below nd, and returns the size
+template <class Tree>
+static std::size_t check_sizes(const typename Tree::node_type* nd) {
+    if (nd == nullptr)
+        return 0;
+    const std::size_t size = 1 + check_sizes<Tree>(nd->left) + check_sizes<Tree>(nd->right);
+    CHECK(nd->size == size);
+    return size;
+}
+
+template <class Tree>
+static void order_statistics(unsigned int seed) {
+    std::mt19937 rng(seed);
+    Tree tree;
+    std::multiset<int> model;
+    for (int i = 0; i < 20000; ++i) {
+        const int key = static_cast<int>(rng() % 5000);
+        tree.insert(key);
+        model.insert(key);
+        if (rng() % 3 == 0) {
+            const int gone = static_cast<int>(rng() % 5000);
+            if (model.count(gone) != 0) {
+                tree.remove(gone);
+                model.erase(model.find(gone));
+            }
+        }
+    }
+    CHECK(check_sizes<Tree>(tree.get_root()) == model.size());
+
+    const std::vector<int> sorted(model.begin(), model.end());
+    for (std::size_t k = 0; k < sorted.size(); k += 7)
+        CHECK(tree.select(k)->data == sorted[k]);
+    CHECK(tree.select(sorted.size()) == nullptr);
+    for (int q = -5; q < 5005; q += 3)
+        CHECK(tree.rank(q) == static_cast<std::size_t>(std::distance(model.begin(), model.lower_bound(q))));
+
+    Tree copy(tree);
+    CHECK(check_sizes<Tree>(copy.get_root()) == model.size());
+    CHECK(copy.select(10)->data == sorted[10]);
+}
+
+int main() {
+    random_operations<bst<int>>(200000, 2000, 1);
+    random_operations<avl_tree<int>>(200000, 2000, 2);
+    random_operations<avl_tree<int, node_pool<int>>>(200000, 50, 3);
+
+    // Sorted input can't unbalance an AVL tree: its height stays below 1.44 * log2(n)
+    avl_tree<int> sorted;
+    for (int i = 0; i < 100000; ++i)
+        sorted.insert(i);
+    CHECK(check_structure<avl_tree<int>>(sorted.get_root(), nullptr) <= 18);
+    for (int i = 0; i < 100000; i += 2)
+        sorted.remove(i);
+    CHECK(check_structure<avl_tree<int>>(sorted.get_root(), nullptr) <= 17);
+
+    range_queries<bst<int>>(5);
+    range_queries<avl_tree<int>>(6);
+
+    order_statistics<ranked_avl_tree<int>>(9);
+    order_statistics<bst<int, std::allocator<int>, bst_unbalanced, true>>(10);
+    order_statistics<bst<int, node_pool<int>, bst_avl, true>>(11);
+    // Only ranked trees pay for the sizes, and only AVL trees for the heights
+    static_assert(sizeof(bst<int>::node_type) < sizeof(avl_tree<int>::node_type), "plain nodes store no height");
+    static_assert(sizeof(avl_tree<int>::node_type) < sizeof(ranked_avl_tree<int>::node_type), "unranked nodes store no size");
+    return 0;
+}
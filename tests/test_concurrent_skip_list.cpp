@@ -0,0 +1,174 @@
+// concurrent_skip_list: random operations against std::set on one thread, then writers and wait-free readers at once.
+// Readers check values that no writer touches, writers keep a private std::set of their own keys, and the set has to match the union of them afterwards.
+// Also threads which insert and remove the same keys at once, where every key must be inserted and removed exactly once.
+#include "check.hpp"
+#include "concurrent_skip_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Orders pairs by their key only, so find() can look up the rest
+struct by_key {
+    bool operator()(const std::pair<int, std::string>& a, const std::pair<int, std::string>& b) const {return a.first < b.first;}
+};
+
+// Returns every value, in order, through min() and successor()
+template <class Set, class T>
+static std::vector<T> contents(const Set& set, T value) {
+    std::vector<T> all;
+    for (bool more = set.min(value); more; more = set.successor(value, value))
+        all.push_back(value);
+    return all;
+}
+
+static void single_thread() {
+    std::mt19937 rng(1);
+    {
+        concurrent_skip_list<std::pair<int, std::string>, by_key, counting_allocator<int>> set;
+        std::set<std::pair<int, std::string>, by_key> model;
+        std::pair<int, std::string> out;
+        CHECK(!set.min(out) && set.empty());
+        for (int step = 0; step < 100000; ++step) {
+            const int key = static_cast<int>(rng() % 2000);
+            // Long enough to live on the heap, so a value that's leaked or freed twice shows up in the sanitizers
+            const std::pair<int, std::string> value{key, std::to_string(step) + std::string(24, 'v')};
+            switch (rng() % 4) {
+            case 0:
+                CHECK(set.insert(value) == model.insert(value).second);
+                break;
+            case 1:
+                CHECK(set.emplace(key, value.second) == model.insert(value).second);
+                break;
+            case 2:
+                CHECK(set.remove(value) == (model.erase(value) != 0));
+                break;
+            default: {
+                const auto it = model.find(value);
+                CHECK(set.contains(value) == (it != model.end()));
+                CHECK(set.find(value, out) == (it != model.end()));
+                if (it != model.end())
+                    CHECK(out == *it);
+                const auto next = model.upper_bound(value);
+                CHECK(set.successor(value, out) == (next != model.end()));
+                if (next != model.end())
+                    CHECK(out == *next);
+                CHECK(set.min(out) == !model.empty());
+                if (!model.empty())
+                    CHECK(out == *model.begin());
+                break;
+            }
+            }
+            CHECK(set.size() == model.size());
+        }
+        const std::vector<std::pair<int, std::string>> all = contents(set, out);
+        CHECK(std::equal(all.begin(), all.end(), model.begin(), model.end()));
+    }
+    // Removed nodes sit in the epoch domain until they're safe to free, but the destructor frees those too
+    CHECK(live_bytes == 0);
+}
+
+// Keys with key % 8 == 7 are inserted up front and never touched, writer w only inserts and removes keys with key % 8 == w
+static void readers_and_writers(int writers, int readers, int steps) {
+    constexpr int range = 40000;
+    concurrent_skip_list<int> set;
+    for (int key = 7; key < range; key += 8)
+        CHECK(set.insert(key));
+
+    std::atomic<bool> done{false};
+    std::vector<std::set<int>> models(static_cast<std::size_t>(writers));
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writers; ++w) {
+        threads.emplace_back([&, w] {
+            std::mt19937 rng(static_cast<unsigned int>(100 + w));
+            std::set<int>& model = models[static_cast<std::size_t>(w)];
+            for (int i = 0; i < steps; ++i) {
+                const int key = static_cast<int>(rng() % (range / 8)) * 8 + w;
+                if (rng() % 2 == 0)
+                    CHECK(set.insert(key) == model.insert(key).second);
+                else
+                    CHECK(set.remove(key) == (model.erase(key) != 0));
+                if (i % 64 == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+            std::mt19937 rng(static_cast<unsigned int>(200 + r));
+            int out = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                // The untouched keys are always there, and the successor can't skip past the next one of them [so the last one is left out]
+                const int key = static_cast<int>(rng() % (range - 8));
+                const int stable = key - key % 8 + 7;
+                CHECK(set.contains(stable));
+                CHECK(set.find(stable, out) && out == stable);
+                CHECK(set.successor(key, out) && out > key && (key == stable ? out <= stable + 8 : out <= stable));
+                CHECK(!set.contains(key - key % 8 + 6));
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (int w = 0; w < writers; ++w)
+        threads[static_cast<std::size_t>(w)].join();
+    done.store(true, std::memory_order_release);
+    for (std::size_t t = static_cast<std::size_t>(writers); t < threads.size(); ++t)
+        threads[t].join();
+
+    std::set<int> expected;
+    for (int key = 7; key < range; key += 8)
+        expected.insert(key);
+    for (const std::set<int>& model : models)
+        expected.insert(model.begin(), model.end());
+    const std::vector<int> all = contents(set, 0);
+    CHECK(std::equal(all.begin(), all.end(), expected.begin(), expected.end()));
+    CHECK(set.size() == expected.size());
+}
+
+// Every thread inserts, then removes, every key, in it's own order
+static void same_keys(int threads, int keys) {
+    concurrent_skip_list<std::string> set;
+    std::vector<std::atomic<int>> inserted(static_cast<std::size_t>(keys)), removed(static_cast<std::size_t>(keys));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::vector<int> order(static_cast<std::size_t>(keys));
+            for (int k = 0; k < keys; ++k)
+                order[static_cast<std::size_t>(k)] = k;
+            std::shuffle(order.begin(), order.end(), std::mt19937(static_cast<unsigned int>(300 + t)));
+            for (int k : order) {
+                if (set.insert(std::to_string(k) + std::string(24, 'k')))
+                    inserted[static_cast<std::size_t>(k)].fetch_add(1, std::memory_order_relaxed);
+            }
+            std::shuffle(order.begin(), order.end(), std::mt19937(static_cast<unsigned int>(400 + t)));
+            for (int k : order) {
+                if (set.remove(std::to_string(k) + std::string(24, 'k')))
+                    removed[static_cast<std::size_t>(k)].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread& w : workers)
+        w.join();
+
+    // A key may be inserted again after another thread removed it, but the two counts have to match
+    for (int k = 0; k < keys; ++k) {
+        const std::size_t i = static_cast<std::size_t>(k);
+        CHECK(inserted[i].load() >= 1 && inserted[i].load() == removed[i].load());
+    }
+    std::string out;
+    CHECK(set.empty() && !set.min(out));
+}
+
+int main() {
+    single_thread();
+    readers_and_writers(4, 4, 100000);
+    readers_and_writers(2, 14, 50000);
+    same_keys(4, 20000);
+    same_keys(16, 2000);
+    return 0;
+}
@@ -0,0 +1,65 @@
+// concurrent_stack: LIFO order against std::vector on one thread, then threads pushing and popping at once, where every value must come out exactly once.
+#include "check.hpp"
+#include "concurrent_stack.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void single_thread() {
+    concurrent_stack<std::string> s;
+    std::vector<std::string> model;
+    std::string out;
+    CHECK(!s.try_pop(out));
+    for (int i = 0; i < 10000; ++i) {
+        if (i % 3 != 2) {
+            s.push(std::to_string(i) + std::string(20, 'x'));
+            model.push_back(std::to_string(i) + std::string(20, 'x'));
+        }
+        else if (!model.empty()) {
+            CHECK(s.try_pop(out));
+            CHECK(out == model.back());
+            model.pop_back();
+        }
+    }
+    CHECK(!s.empty());
+    // Whatever is left is freed by the destructor
+}
+
+static void many_threads(int threads, int per_thread) {
+    concurrent_stack<std::string> s;
+    std::vector<std::vector<int>> popped(static_cast<std::size_t>(threads));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::string out;
+            for (int i = 0; i < per_thread; ++i) {
+                s.push(std::to_string(t * per_thread + i));
+                if (i % 2 == 1 && s.try_pop(out))
+                    popped[static_cast<std::size_t>(t)].push_back(std::stoi(out));
+            }
+        });
+    }
+    for (std::thread& w : workers)
+        w.join();
+
+    std::vector<int> all;
+    for (const std::vector<int>& part : popped)
+        all.insert(all.end(), part.begin(), part.end());
+    std::string out;
+    while (s.try_pop(out))
+        all.push_back(std::stoi(out));
+
+    std::sort(all.begin(), all.end());
+    CHECK(all.size() == static_cast<std::size_t>(threads) * per_thread);
+    for (std::size_t i = 0; i < all.size(); ++i)
+        CHECK(all[i] == static_cast<int>(i));
+}
+
+int main() {
+    single_thread();
+    many_threads(4, 50000);
+    many_threads(16, 5000);
+    return 0;
+}
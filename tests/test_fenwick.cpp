@@ -0,0 +1,136 @@
+// fenwick_tree, range_fenwick_tree and fenwick_tree_2d against plain arrays, with random updates and every kind of query.
+// lower_bound() is checked against std::lower_bound over std::partial_sum of the same values.
+#include "check.hpp"
+#include "fenwick_tree.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+static void point_updates(std::mt19937& rng) {
+    for (std::size_t n : {1, 2, 7, 64, 1000, 4097}) {
+        std::vector<std::int64_t> values(n);
+        for (std::int64_t& v : values)
+            v = static_cast<std::int64_t>(rng() % 100);
+        fenwick_tree<std::int64_t> tree(values.begin(), values.end());
+        CHECK(tree.size() == n);
+
+        for (int step = 0; step < 2000; ++step) {
+            const std::size_t i = rng() % n;
+            switch (rng() % 4) {
+            case 0: {
+                const std::int64_t delta = static_cast<std::int64_t>(rng() % 50);
+                tree.add(i, delta);
+                values[i] += delta;
+                break;
+            }
+            case 1: {
+                const std::int64_t value = static_cast<std::int64_t>(rng() % 100);
+                tree.set(i, value);
+                values[i] = value;
+                break;
+            }
+            case 2: {
+                const std::size_t j = i + rng() % (n - i + 1);
+                CHECK(tree.sum(i, j) == std::accumulate(values.begin() + static_cast<std::ptrdiff_t>(i), values.begin() + static_cast<std::ptrdiff_t>(j), std::int64_t{0}));
+                break;
+            }
+            case 3:
+                CHECK(tree.get(i) == values[i]);
+                break;
+            }
+        }
+
+        std::vector<std::int64_t> prefix(n);
+        std::partial_sum(values.begin(), values.end(), prefix.begin());
+        for (std::size_t i = 0; i <= n; ++i)
+            CHECK(tree.prefix_sum(i) == (i == 0 ? 0 : prefix[i - 1]));
+        for (int q = 0; q < 500; ++q) {
+            const std::int64_t target = static_cast<std::int64_t>(rng() % static_cast<std::uint64_t>(prefix.back() + 10));
+            CHECK(tree.lower_bound(target) == static_cast<std::size_t>(std::lower_bound(prefix.begin(), prefix.end(), target) - prefix.begin()));
+        }
+
+        // Bulk construction and n updates have to build the same tree
+        fenwick_tree<std::int64_t> one_by_one(n);
+        for (std::size_t i = 0; i < n; ++i)
+            one_by_one.add(i, values[i]);
+        fenwick_tree<std::int64_t> bulk(n);
+        bulk.assign(values.begin(), values.end());
+        for (std::size_t i = 0; i <= n; ++i)
+            CHECK(one_by_one.prefix_sum(i) == bulk.prefix_sum(i));
+    }
+}
+
+static void range_updates(std::mt19937& rng) {
+    for (std::size_t n : {1, 5, 300, 2000}) {
+        std::vector<std::int64_t> values(n);
+        for (std::int64_t& v : values)
+            v = static_cast<std::int64_t>(rng() % 100) - 50;
+        range_fenwick_tree<std::int64_t> tree(values.begin(), values.end());
+        for (int step = 0; step < 2000; ++step) {
+            const std::size_t first = rng() % n;
+            const std::size_t last = first + rng() % (n - first + 1);
+            if (rng() % 2 == 0) {
+                const std::int64_t delta = static_cast<std::int64_t>(rng() % 21) - 10;
+                tree.add(first, last, delta);
+                for (std::size_t i = first; i < last; ++i)
+                    values[i] += delta;
+            }
+            else
+                CHECK(tree.sum(first, last) == std::accumulate(values.begin() + static_cast<std::ptrdiff_t>(first), values.begin() + static_cast<std::ptrdiff_t>(last), std::int64_t{0}));
+            CHECK(tree.get(first) == values[first]);
+        }
+    }
+}
+
+static void two_dimensions(std::mt19937& rng) {
+    const std::size_t rows = 37, cols = 53;
+    std::vector<std::int64_t> values(rows * cols);
+    for (std::int64_t& v : values)
+        v = static_cast<std::int64_t>(rng() % 10);
+    fenwick_tree_2d<std::int64_t> tree(rows, cols, values.data());
+    for (int step = 0; step < 3000; ++step) {
+        const std::size_t r = rng() % rows, c = rng() % cols;
+        if (rng() % 2 == 0) {
+            const std::int64_t delta = static_cast<std::int64_t>(rng() % 7) - 3;
+            tree.add(r, c, delta);
+            values[r * cols + c] += delta;
+        }
+        const std::size_t r2 = r + rng() % (rows - r + 1), c2 = c + rng() % (cols - c + 1);
+        std::int64_t expected = 0;
+        for (std::size_t i = r; i < r2; ++i)
+            for (std::size_t j = c; j < c2; ++j)
+                expected += values[i * cols + j];
+        CHECK(tree.sum(r, c, r2, c2) == expected);
+        CHECK(tree.get(r, c) == values[r * cols + c]);
+    }
+}
+
+int main() {
+    std::mt19937 rng(20);
+    point_updates(rng);
+    range_updates(rng);
+    two_dimensions(rng);
+
+    fenwick_tree<int> tree(4);
+    try {
+        tree.add(4, 1);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    try {
+        tree.sum(3, 2);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    try {
+        tree.prefix_sum(5);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    CHECK(tree.lower_bound(1) == 4);
+    return 0;
+}
@@ -0,0 +1,219 @@
+// generic_tree against a model of child lists: random emplace_back/front/after and subtree erases, then every traversal against a recursive one over the model.
+// A tree of std::string checks that clear(), erase() and the destructor leave nothing behind for LeakSanitizer.
+#include "check.hpp"
+#include "generic_tree.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using tree_type = generic_tree<int, 64>;
+using node_ptr = tree_node<int>*;
+
+struct model {
+    std::vector<std::vector<int>> children;
+    std::vector<int> parent;
+    std::vector<node_ptr> nodes;
+    std::vector<bool> alive;
+
+    int add(node_ptr nd, int p) {
+        const int id = static_cast<int>(nodes.size());
+        nodes.push_back(nd);
+        children.emplace_back();
+        parent.push_back(p);
+        alive.push_back(true);
+        return id;
+    }
+
+    void kill(int id) {
+        alive[static_cast<std::size_t>(id)] = false;
+        for (int c : children[static_cast<std::size_t>(id)])
+            kill(c);
+    }
+
+    void preorder(int id, std::vector<int>& out) const {
+        out.push_back(id);
+        for (int c : children[static_cast<std::size_t>(id)])
+            preorder(c, out);
+    }
+
+    void postorder(int id, std::vector<int>& out) const {
+        for (int c : children[static_cast<std::size_t>(id)])
+            postorder(c, out);
+        out.push_back(id);
+    }
+};
+
+// Checks every link below nd against the model, and returns the size of the subtree
+static std::size_t check_links(const model& m, int id) {
+    const node_ptr nd = m.nodes[static_cast<std::size_t>(id)];
+    CHECK(nd->get_data() == id);
+    const std::vector<int>& kids = m.children[static_cast<std::size_t>(id)];
+    std::size_t count = 1;
+    node_ptr prev = nullptr;
+    node_ptr c = nd->get_first_child();
+    for (int kid : kids) {
+        CHECK(c == m.nodes[static_cast<std::size_t>(kid)]);
+        CHECK(c->get_parent() == nd && c->get_prev_sibling() == prev);
+        count += check_links(m, kid);
+        prev = c;
+        c = c->get_next_sibling();
+    }
+    CHECK(c == nullptr);
+    CHECK(nd->get_last_child() == prev);
+    return count;
+}
+
+static void check_traversals(const tree_type& tree, const model& m) {
+    std::vector<int> got, expected;
+    tree.for_each_preorder([&](node_ptr nd) {got.push_back(nd->get_data());});
+    m.preorder(0, expected);
+    CHECK(got == expected);
+
+    got.clear();
+    expected.clear();
+    tree.for_each_postorder([&](node_ptr nd) {got.push_back(nd->get_data());});
+    m.postorder(0, expected);
+    CHECK(got == expected);
+
+    got.clear();
+    expected.clear();
+    tree.for_each_level_order([&](node_ptr nd) {got.push_back(nd->get_data());});
+    std::deque<int> todo{0};
+    while (!todo.empty()) {
+        const int id = todo.front();
+        todo.pop_front();
+        expected.push_back(id);
+        for (int c : m.children[static_cast<std::size_t>(id)])
+            todo.push_back(c);
+    }
+    CHECK(got == expected);
+}
+
+static void random_operations(unsigned int seed) {
+    std::mt19937 rng(seed);
+    tree_type tree;
+    model m;
+    m.add(tree.emplace_root(0), -1);
+
+    for (int step = 0; step < 20000; ++step) {
+        // A random live node
+        int id;
+        do
+            id = static_cast<int>(rng() % m.nodes.size());
+        while (!m.alive[static_cast<std::size_t>(id)]);
+        const node_ptr nd = m.nodes[static_cast<std::size_t>(id)];
+        const int next_id = static_cast<int>(m.nodes.size());
+
+        switch (rng() % 8) {
+        case 0:
+        case 1:
+        case 2:
+            m.add(tree.emplace_back(nd, next_id), id);
+            m.children[static_cast<std::size_t>(id)].push_back(next_id);
+            break;
+        case 3:
+            m.add(tree.emplace_front(nd, next_id), id);
+            m.children[static_cast<std::size_t>(id)].insert(m.children[static_cast<std::size_t>(id)].begin(), next_id);
+            break;
+        case 4: {
+            if (id == 0)
+                break;
+            m.add(tree.emplace_after(nd, next_id), m.parent[static_cast<std::size_t>(id)]);
+            std::vector<int>& siblings = m.children[static_cast<std::size_t>(m.parent[static_cast<std::size_t>(id)])];
+            siblings.insert(std::find(siblings.begin(), siblings.end(), id) + 1, next_id);
+            break;
+        }
+        case 5:
+            if (id == 0 || rng() % 4 != 0)
+                break;
+            tree.erase(nd);
+            m.kill(id);
+            {
+                std::vector<int>& siblings = m.children[static_cast<std::size_t>(m.parent[static_cast<std::size_t>(id)])];
+                siblings.erase(std::find(siblings.begin(), siblings.end(), id));
+            }
+            break;
+        default: {
+            // Walks limited to the subtree of a node
+            std::vector<int> got, expected;
+            for (node_ptr it = nd; it != nullptr; it = tree_type::next_preorder(it, nd))
+                got.push_back(it->get_data());
+            m.preorder(id, expected);
+            CHECK(got == expected);
+            got.clear();
+            expected.clear();
+            for (node_ptr it = tree_type::first_postorder(nd); it != nullptr; it = tree_type::next_postorder(it, nd))
+                got.push_back(it->get_data());
+            m.postorder(id, expected);
+            CHECK(got == expected);
+            break;
+        }
+        }
+        if (step % 2000 == 0) {
+            CHECK(check_links(m, 0) == tree.size());
+            check_traversals(tree, m);
+        }
+    }
+    CHECK(check_links(m, 0) == tree.size());
+    check_traversals(tree, m);
+
+    // A copy has the same shape, in new nodes
+    const tree_type copy(tree);
+    CHECK(copy.size() == tree.size() && copy.get_root() != tree.get_root());
+    std::vector<int> a, b;
+    tree.for_each_preorder([&](node_ptr nd) {a.push_back(nd->get_data());});
+    copy.for_each_preorder([&](node_ptr nd) {b.push_back(nd->get_data());});
+    CHECK(a == b);
+}
+
+static void owning_values() {
+    generic_tree<std::string> tree;
+    auto* root = tree.emplace_root(std::string(40, 'r'));
+    for (int i = 0; i < 100; ++i) {
+        auto* child = tree.emplace_back(root, std::string(40, static_cast<char>('a' + i % 26)));
+        for (int j = 0; j < 10; ++j)
+            tree.emplace_front(child, 30, 'x');
+    }
+    CHECK(tree.size() == 1 + 100 * 11);
+    tree.erase(root->get_first_child()->get_next_sibling());
+    CHECK(tree.size() == 1 + 99 * 11);
+
+    generic_tree<std::string> copy(tree);
+    generic_tree<std::string> moved(std::move(tree));
+    CHECK(tree.empty() && tree.get_root() == nullptr && moved.size() == copy.size());
+    tree.emplace_root("again");
+    CHECK(tree.size() == 1);
+    copy.clear();
+    CHECK(copy.empty());
+    copy.emplace_root("x");
+    moved = copy;
+    CHECK(moved.size() == 1 && moved.get_root()->get_data() == "x");
+
+    try {
+        tree.emplace_root("second root");
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        tree.emplace_after(tree.get_root(), "sibling of the root");
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        tree.emplace_back(nullptr, "orphan");
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+}
+
+int main() {
+    random_operations(1);
+    random_operations(2);
+    owning_values();
+    return 0;
+}
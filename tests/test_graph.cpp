@@ -0,0 +1,137 @@
+// graph: bfs(), parallel_bfs(), dfs() and dijkstra() against plain reference implementations, on random graphs built and edited through graph_builder.
+// The reference Dijkstra sums in 64 bits, so heavy weights check that dijkstra() reports paths which don't fit in W as unreachable instead of wrapping around.
+#include "check.hpp"
+#include "graph.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using vertex = std::uint32_t;
+
+template <class W>
+static std::vector<vertex> reference_bfs(const graph<W>& g, vertex source) {
+    std::vector<vertex> depth(g.vertices(), graph<W>::unreached);
+    std::deque<vertex> todo{source};
+    depth[source] = 0;
+    while (!todo.empty()) {
+        const vertex v = todo.front();
+        todo.pop_front();
+        for (vertex u : g.neighbours(v))
+            if (depth[u] == graph<W>::unreached) {
+                depth[u] = depth[v] + 1;
+                todo.push_back(u);
+            }
+    }
+    return depth;
+}
+
+template <class W>
+static void reference_dfs(const graph<W>& g, vertex v, std::vector<bool>& visited, std::vector<vertex>& order) {
+    visited[v] = true;
+    order.push_back(v);
+    for (vertex u : g.neighbours(v))
+        if (!visited[u])
+            reference_dfs(g, u, visited, order);
+}
+
+// Distances in 64 bits, clamped to W's max() where they don't fit
+template <class W>
+static std::vector<W> reference_dijkstra(const graph<W>& g, vertex source) {
+    constexpr std::uint64_t none = std::numeric_limits<std::uint64_t>::max();
+    std::vector<std::uint64_t> distance(g.vertices(), none);
+    std::set<std::pair<std::uint64_t, vertex>> todo{{0, source}};
+    distance[source] = 0;
+    while (!todo.empty()) {
+        const vertex v = todo.begin()->second;
+        todo.erase(todo.begin());
+        const W* w = g.edge_weights(v);
+        for (vertex u : g.neighbours(v)) {
+            const std::uint64_t candidate = distance[v] + static_cast<std::uint64_t>(*w++);
+            if (candidate < distance[u]) {
+                todo.erase({distance[u], u});
+                distance[u] = candidate;
+                todo.insert({candidate, u});
+            }
+        }
+    }
+    std::vector<W> clamped(g.vertices(), std::numeric_limits<W>::max());
+    for (std::size_t v = 0; v < distance.size(); ++v) {
+        const bool fits = std::is_floating_point<W>::value || distance[v] < static_cast<std::uint64_t>(std::numeric_limits<W>::max());
+        if (distance[v] != none && fits)
+            clamped[v] = static_cast<W>(distance[v]);
+    }
+    return clamped;
+}
+
+template <class W>
+static void random_graphs(unsigned int seed, W max_weight, thread_pool& pool) {
+    std::mt19937 rng(seed);
+    for (int round = 0; round < 30; ++round) {
+        const vertex n = 1 + static_cast<vertex>(rng() % 300);
+        const std::size_t m = rng() % (4 * n);
+        graph_builder<W> builder(n);
+        for (std::size_t e = 0; e < m; ++e) {
+            const W weight = static_cast<W>(1 + rng() % static_cast<std::uint64_t>(max_weight));
+            builder.add_edge(rng() % n, rng() % n, weight);
+        }
+        // Some edits, so the frozen graph isn't just the insertion order
+        for (int k = 0; k < 20; ++k)
+            builder.remove_edge(rng() % n, rng() % n);
+        if (round % 3 == 0)
+            builder.resize(n + 5);
+        CHECK(builder.edges() <= m);
+
+        const graph<W> g = builder.freeze();
+        CHECK(g.vertices() == builder.vertices() && g.edges() == builder.edges());
+        for (int q = 0; q < 5; ++q) {
+            const vertex source = rng() % static_cast<vertex>(g.vertices());
+            const std::vector<vertex> depth = reference_bfs(g, source);
+            CHECK(g.bfs(source) == depth);
+            CHECK(g.parallel_bfs(source, pool) == depth);
+
+            std::vector<bool> visited(g.vertices(), false);
+            std::vector<vertex> order;
+            reference_dfs(g, source, visited, order);
+            CHECK(g.dfs(source) == order);
+
+            CHECK(g.dijkstra(source) == reference_dijkstra(g, source));
+        }
+    }
+}
+
+int main() {
+    thread_pool pool(3);
+    random_graphs<std::uint32_t>(1, 1000, pool);
+    random_graphs<double>(2, 1000.0, pool);
+    // Weights near the top of the range, where sums of two of them don't fit
+    random_graphs<std::uint32_t>(3, std::numeric_limits<std::uint32_t>::max() / 2 + 7, pool);
+    random_graphs<std::int32_t>(4, std::numeric_limits<std::int32_t>::max() - 1, pool);
+
+    // 0 -> 1 -> 2 is longer than 2^32, the sum used to wrap around to a short path
+    graph_builder<std::uint32_t> chain(3);
+    chain.add_edge(0, 1, 4000000000u);
+    chain.add_edge(1, 2, 4000000000u);
+    const std::vector<std::uint32_t> far = chain.freeze().dijkstra(0);
+    CHECK(far[1] == 4000000000u && far[2] == std::numeric_limits<std::uint32_t>::max());
+
+    graph_builder<int> negative(2);
+    negative.add_edge(0, 1, -1);
+    try {
+        negative.freeze().dijkstra(0);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        chain.freeze().bfs(3);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    return 0;
+}
@@ -0,0 +1,142 @@
+// d_ary_heap against std::priority_queue for arity 2, 4 and 8, and indexed_heap's handles against a std::set of (value, handle) pairs.
+// indexed_heap runs on counting_allocator, so the test also proves that all three of it's arrays use the allocator it was given.
+#include "check.hpp"
+#include "heap.hpp"
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <std::size_t Arity, class Compare>
+static void d_ary_against_priority_queue(unsigned int seed) {
+    std::mt19937 rng(seed);
+    d_ary_heap<int, Arity, Compare> heap;
+    std::priority_queue<int, std::vector<int>, Compare> model;
+    for (int i = 0; i < 200000; ++i) {
+        if (rng() % 3 != 0 || model.empty()) {
+            const int value = static_cast<int>(rng() % 10000);
+            heap.push(value);
+            model.push(value);
+        }
+        else {
+            CHECK(heap.top() == model.top());
+            heap.pop();
+            model.pop();
+        }
+        CHECK(heap.size() == model.size());
+    }
+
+    // Floyd's construction has to give the same order as pushing one by one
+    std::vector<int> values;
+    for (int i = 0; i < 50000; ++i)
+        values.push_back(static_cast<int>(rng() % 1000));
+    heap.assign(values.begin(), values.end());
+    std::priority_queue<int, std::vector<int>, Compare> fresh(values.begin(), values.end());
+    while (!fresh.empty()) {
+        CHECK(heap.top() == fresh.top());
+        heap.pop();
+        fresh.pop();
+    }
+    CHECK(heap.empty());
+
+    d_ary_heap<int, Arity, Compare> ranged(values.begin(), values.begin() + 1);
+    CHECK(ranged.size() == 1 && ranged.top() == values[0]);
+}
+
+static void indexed_against_model(unsigned int seed) {
+    using heap_type = indexed_heap<int, 4, std::greater<int>, counting_allocator<int>>;
+    using handle = heap_type::handle;
+    std::mt19937 rng(seed);
+    {
+        heap_type heap;
+        std::set<std::pair<int, handle>> model;
+        std::vector<handle> live;
+        for (int i = 0; i < 200000; ++i) {
+            const int value = static_cast<int>(rng() % 100000);
+            switch (rng() % 5) {
+            case 0:
+            case 1: {
+                const handle h = heap.push(value);
+                CHECK(model.count({heap.get(h), h}) == 0);
+                model.insert({value, h});
+                live.push_back(h);
+                break;
+            }
+            case 2:
+                if (!model.empty()) {
+                    // Equal values may come out in any order, but the value has to be the smallest
+                    CHECK(heap.top() == model.begin()->first);
+                    const handle h = heap.top_handle();
+                    CHECK(model.erase({heap.top(), h}) == 1);
+                    heap.pop();
+                    CHECK(!heap.contains(h));
+                }
+                break;
+            case 3:
+            case 4: {
+                if (live.empty())
+                    break;
+                const std::size_t at = rng() % live.size();
+                const handle h = live[at];
+                if (!heap.contains(h)) {
+                    live[at] = live.back();
+                    live.pop_back();
+                    break;
+                }
+                const int old = heap.get(h);
+                model.erase({old, h});
+                if (rng() % 3 == 0) {
+                    heap.erase(h);
+                    CHECK(!heap.contains(h));
+                }
+                else if (rng() % 2 == 0) {
+                    const int lower = old - static_cast<int>(rng() % 1000);
+                    heap.decrease_key(h, lower);
+                    model.insert({lower, h});
+                }
+                else {
+                    heap.update(h, value);
+                    model.insert({value, h});
+                }
+                break;
+            }
+            }
+            CHECK(heap.size() == model.size());
+        }
+        for (const auto& kv : model)
+            CHECK(heap.contains(kv.second) && heap.get(kv.second) == kv.first);
+        CHECK(live_bytes > 0);
+
+        // Moving a value away from the top is not a decrease, and freed handles aren't in the heap
+        const handle h = heap.push(50);
+        try {
+            heap.decrease_key(h, 60);
+            CHECK(false);
+        }
+        catch (const std::invalid_argument&) { }
+        heap.erase(h);
+        try {
+            heap.erase(h);
+            CHECK(false);
+        }
+        catch (const std::invalid_argument&) { }
+        CHECK(!heap.contains(1u << 30));
+
+        heap.clear();
+        CHECK(heap.empty());
+    }
+    CHECK(live_bytes == 0);
+}
+
+int main() {
+    d_ary_against_priority_queue<2, std::less<int>>(1);
+    d_ary_against_priority_queue<4, std::less<int>>(2);
+    d_ary_against_priority_queue<8, std::greater<int>>(3);
+    d_ary_against_priority_queue<3, std::greater<int>>(4);
+    indexed_against_model(5);
+    return 0;
+}
@@ -0,0 +1,63 @@
+// The STL iterators of sl_list, dl_list and bst, used through standard algorithms and checked against std:: containers.
+#include "check.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include "bst.hpp"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+int main() {
+    std::mt19937 rng(8);
+    sl_list<int> l;
+    dl_list<int> d;
+    avl_tree<int> b;
+    bst<int> u;
+    std::list<int> model;
+    std::multiset<int> keys;
+    for (int i = 0; i < 5000; ++i) {
+        const int value = static_cast<int>(rng() % 1000);
+        l.push_back(value);
+        d.push_front(value);
+        model.push_back(value);
+        b.insert(value);
+        u.insert(value);
+        keys.insert(value);
+    }
+
+    // Forward iteration and algorithms
+    CHECK(std::equal(l.begin(), l.end(), model.begin(), model.end()));
+    CHECK(std::equal(d.rbegin(), d.rend(), model.begin(), model.end()));
+    CHECK(std::equal(b.begin(), b.end(), keys.begin(), keys.end()));
+    CHECK(std::equal(u.begin(), u.end(), keys.begin(), keys.end()));
+    CHECK(std::accumulate(l.begin(), l.end(), 0LL) == std::accumulate(model.begin(), model.end(), 0LL));
+    CHECK(std::distance(b.begin(), b.end()) == static_cast<std::ptrdiff_t>(keys.size()));
+    CHECK(*std::find(l.begin(), l.end(), model.back()) == model.back());
+
+    // Backwards from end()
+    CHECK(std::equal(b.rbegin(), b.rend(), keys.rbegin(), keys.rend()));
+    auto last = d.end();
+    --last;
+    CHECK(*last == model.front());
+    auto largest = b.end();
+    --largest;
+    CHECK(*largest == *keys.rbegin());
+
+    // Writes through iterators, and iterator to const_iterator conversion
+    for (int& value : l)
+        value *= 2;
+    sl_list<int>::const_iterator first = l.begin();
+    CHECK(*first == 2 * model.front());
+    const dl_list<int>& cd = d;
+    CHECK(std::equal(cd.cbegin(), cd.cend(), std::vector<int>(model.rbegin(), model.rend()).begin()));
+
+    bst<int> empty;
+    CHECK(empty.begin() == empty.end());
+    sl_list<int> empty_list;
+    CHECK(empty_list.begin() == empty_list.end());
+    return 0;
+}
@@ -0,0 +1,94 @@
+// kd_tree against brute force: k_nearest(), nearest() and within_radius() on random points in 1, 2, 3 and 8 dimensions, with float, double and int coordinates.
+// Equal distances may come back in any order, so results are compared by distance, and every returned index has to really be that far away.
+#include "check.hpp"
+#include "kd_tree.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+template <class Tree>
+static typename Tree::distance_type brute_distance(const typename Tree::point_type& a, const typename Tree::point_type& b) {
+    using D = typename Tree::distance_type;
+    D total = D(0);
+    for (std::size_t d = 0; d < a.size(); ++d) {
+        const D diff = static_cast<D>(a[d]) - static_cast<D>(b[d]);
+        total += diff * diff;
+    }
+    return total;
+}
+
+template <class T, std::size_t K>
+static void against_brute_force(unsigned int seed, std::size_t n, int range) {
+    using tree_type = kd_tree<T, K>;
+    using point = typename tree_type::point_type;
+    using D = typename tree_type::distance_type;
+    std::mt19937 rng(seed);
+    // A small range of coordinates makes plenty of duplicates and ties
+    const auto coordinate = [&] {return static_cast<T>(static_cast<int>(rng() % static_cast<unsigned int>(2 * range + 1)) - range);};
+
+    std::vector<point> points(n);
+    for (point& p : points)
+        for (T& x : p)
+            x = coordinate();
+    const tree_type tree(points);
+    CHECK(tree.size() == n);
+
+    for (int q = 0; q < 200; ++q) {
+        point query;
+        for (T& x : query)
+            x = coordinate();
+        std::vector<D> all(n);
+        for (std::size_t i = 0; i < n; ++i)
+            all[i] = brute_distance<tree_type>(query, points[i]);
+        std::vector<D> sorted = all;
+        std::sort(sorted.begin(), sorted.end());
+
+        const std::size_t k = 1 + rng() % 20;
+        const auto found = tree.k_nearest(query, k);
+        CHECK(found.size() == std::min(k, n));
+        for (std::size_t j = 0; j < found.size(); ++j) {
+            CHECK(found[j].distance == sorted[j]);
+            CHECK(all[found[j].index] == found[j].distance);
+        }
+        CHECK(tree.nearest(query).distance == sorted.front());
+
+        const D radius = static_cast<D>(rng() % static_cast<unsigned int>(range + 1));
+        auto inside = tree.within_radius(query, radius);
+        const std::size_t expected = static_cast<std::size_t>(std::upper_bound(sorted.begin(), sorted.end(), radius * radius) - sorted.begin());
+        CHECK(inside.size() == expected);
+        std::vector<bool> seen(n, false);
+        for (const auto& nb : inside) {
+            CHECK(!seen[nb.index] && all[nb.index] == nb.distance && nb.distance <= radius * radius);
+            seen[nb.index] = true;
+        }
+    }
+}
+
+int main() {
+    against_brute_force<double, 1>(1, 500, 1000);
+    against_brute_force<double, 2>(2, 3000, 1000);
+    against_brute_force<float, 3>(3, 3000, 100);
+    against_brute_force<int, 3>(4, 2000, 20);
+    against_brute_force<double, 8>(5, 2000, 10);
+    against_brute_force<int, 2>(6, 7, 3);
+
+    // Squared distances of 1e60 overflow float to infinity, a search that wants k points still has to take them
+    kd_tree<float, 2> far({{1e30f, 0.f}, {-1e30f, 0.f}, {0.f, 3e30f}});
+    const auto found = far.k_nearest({0.f, 0.f}, 3);
+    CHECK(found.size() == 3);
+    CHECK(far.nearest({0.f, 0.f}).distance == std::numeric_limits<float>::infinity());
+
+    kd_tree<double, 2> empty;
+    CHECK(empty.k_nearest({0, 0}, 3).empty());
+    CHECK(empty.within_radius({0, 0}, 10).empty());
+    try {
+        empty.nearest({0, 0});
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    return 0;
+}
@@ -0,0 +1,157 @@
+// matrix: GEMM and every expression form against a naive triple loop, on sizes which don't fill whole SIMD registers or blocks.
+// Also checks that assignments which read their own target (A = A * B) still give the right answer, and that rows stay 64-byte aligned.
+#include "check.hpp"
+#include "matrix.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+using dmatrix = matrix<double>;
+
+static dmatrix naive_product(const dmatrix& a, const dmatrix& b) {
+    dmatrix c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < b.cols(); ++j) {
+            double sum = 0;
+            for (std::size_t k = 0; k < a.cols(); ++k)
+                sum += a(i, k) * b(k, j);
+            c(i, j) = sum;
+        }
+    return c;
+}
+
+// Element-wise f(a, b), which the expressions are checked against
+template <class F>
+static dmatrix zip(const dmatrix& a, const dmatrix& b, F f) {
+    dmatrix c(a.rows(), a.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            c(i, j) = f(a(i, j), b(i, j));
+    return c;
+}
+
+static bool close(const dmatrix& a, const dmatrix& b) {
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+        return false;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            if (std::fabs(a(i, j) - b(i, j)) > 1e-9 * (1 + std::fabs(b(i, j))))
+                return false;
+    return true;
+}
+
+static dmatrix random_matrix(std::size_t rows, std::size_t cols, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(-1, 1);
+    dmatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            m(i, j) = dist(rng);
+    return m;
+}
+
+static void check_aligned(const dmatrix& m) {
+    for (std::size_t i = 0; i < m.rows(); ++i)
+        CHECK(reinterpret_cast<std::uintptr_t>(m.row(i)) % 64 == 0);
+    CHECK(m.stride() >= m.cols());
+}
+
+static void products(std::mt19937& rng) {
+    const std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> shapes{
+        {1, 1, 1}, {3, 5, 7}, {4, 4, 4}, {17, 1, 9}, {67, 131, 259}, {130, 300, 70}, {257, 129, 65}};
+    for (const auto& shape : shapes) {
+        const std::size_t m = std::get<0>(shape), k = std::get<1>(shape), n = std::get<2>(shape);
+        const dmatrix a = random_matrix(m, k, rng), b = random_matrix(k, n, rng), c = random_matrix(m, n, rng);
+        const dmatrix ab = naive_product(a, b);
+        const dmatrix ab_plus_c = zip(ab, c, [](double x, double y) {return x + y;});
+        check_aligned(a);
+
+        CHECK(close(a * b, ab));
+        CHECK(close(a * b + c, ab_plus_c));
+        CHECK(close(c + a * b, ab_plus_c));
+        CHECK(close(2.0 * (a * b) - c, zip(ab, c, [](double x, double y) {return 2 * x - y;})));
+        CHECK(close(0.5 * (2 * c), c));
+        CHECK(close((a * b) * dmatrix::identity(n), ab));
+        CHECK(close((c + c) * dmatrix::identity(n), zip(c, c, [](double x, double y) {return x + y;})));
+
+        // The target is also an operand
+        dmatrix h = c;
+        h = a * b + h;
+        CHECK(close(h, ab_plus_c));
+        h = c;
+        h = h + a * b;
+        CHECK(close(h, ab_plus_c));
+        h = c;
+        h += a * b;
+        CHECK(close(h, ab_plus_c));
+        h = c;
+        h -= a * b;
+        CHECK(close(h, zip(c, ab, [](double x, double y) {return x - y;})));
+        h = c;
+        h = a * b - h;
+        CHECK(close(h, zip(ab, c, [](double x, double y) {return x - y;})));
+
+        // BLAS style, alpha * A * B + beta * C
+        dmatrix g = c;
+        dmatrix::gemm(3.0, a, b, -0.5, g);
+        CHECK(close(g, zip(ab, c, [](double x, double y) {return 3 * x - 0.5 * y;})));
+
+        const dmatrix t = a.transpose();
+        CHECK(t.rows() == k && t.cols() == m);
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < k; ++j)
+                CHECK(t(j, i) == a(i, j));
+    }
+
+    const dmatrix a = random_matrix(50, 50, rng);
+    const dmatrix aa = naive_product(a, a);
+    dmatrix b = a;
+    b = b * b;
+    CHECK(close(b, aa));
+    dmatrix z = a;
+    z = a * z;
+    CHECK(close(z, aa));
+    dmatrix w = a;
+    w = w - w;
+    CHECK(w == dmatrix(50, 50));
+}
+
+int main() {
+    std::mt19937 rng(16);
+    products(rng);
+
+    // Other element types use the scalar kernels, or SIMD of a different width
+    matrix<float> fa(33, 33, 1.f), fb(33, 33, 2.f);
+    const matrix<float> fc = fa * fb;
+    CHECK(fc(5, 7) == 66.f && fc(32, 32) == 66.f);
+    matrix<int> ia(3, 3, 1);
+    const matrix<int> ib = ia * ia + ia;
+    CHECK(ib(2, 2) == 4);
+
+    dmatrix r(3, 4, 1.0);
+    r.resize(5, 2);
+    CHECK(r.rows() == 5 && r.cols() == 2);
+    check_aligned(r);
+    dmatrix moved(std::move(r));
+    CHECK(moved.rows() == 5);
+
+    try {
+        const dmatrix bad = dmatrix(2, 3) * dmatrix(2, 3);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        const dmatrix bad = dmatrix(2, 3) + dmatrix(3, 2);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        dmatrix(2, 2).at(2, 0);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    return 0;
+}
@@ -0,0 +1,132 @@
+// node_pool: rebound copies share one pool, containers handed the same pool share it, and recycled slots are handed out again.
+#include "check.hpp"
+#include "node_pool.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include "bst.hpp"
+#include "pairing_heap.hpp"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+struct alignas(64) wide {
+    double values[3];
+};
+
+static void check_rebinding() {
+    node_pool<int> p;
+    node_pool<node<int>> rebound(p);
+    node_pool<int> back(rebound);
+    CHECK(rebound == p);
+    CHECK(back == p);
+    CHECK(node_pool<int>() != p);
+
+    sl_list<int, node_pool<int>> a(p), b(p);
+    CHECK(a.get_allocator() == p);
+    CHECK(a.get_allocator() == b.get_allocator());
+    CHECK(node_pool<int>(node_pool<node<int>>(a.get_allocator())) == a.get_allocator());
+
+    // A node from an equal pool can be handed to the list, which frees it through its own copy
+    using node_traits = std::allocator_traits<node_pool<node<int>>>;
+    node_pool<node<int>> na(a.get_allocator());
+    node<int>* nd = node_traits::allocate(na, 1);
+    node_traits::construct(na, nd, 7);
+    a.push_back(nd);
+    a.pop_back();
+
+    // Lists on one pool share its slots: what one frees, the other gets back
+    node<int>* first = a.push_back(1);
+    a.pop_front();
+    CHECK(b.push_back(2) == first);
+
+    // Copies of a container get a pool of their own
+    sl_list<int, node_pool<int>> c(b);
+    CHECK(c.get_allocator() != b.get_allocator());
+}
+
+static void check_slabs() {
+    node_pool<char, 4> p;
+    node_pool<wide, 4> w(p);
+    node_pool<std::uint64_t, 4> q(p);
+
+    // Slots of a slab are laid out back to back, and respect the type's alignment
+    std::vector<wide*> wides;
+    for (int i = 0; i < 10; ++i) {
+        wides.push_back(w.allocate(1));
+        CHECK(reinterpret_cast<std::uintptr_t>(wides.back()) % alignof(wide) == 0);
+    }
+    CHECK(wides[1] == wides[0] + 1);
+    std::vector<std::uint64_t*> words;
+    for (int i = 0; i < 10; ++i)
+        words.push_back(q.allocate(1));
+    char* ch = p.allocate(1);
+    CHECK(reinterpret_cast<std::uintptr_t>(ch) % alignof(void*) == 0);
+
+    // Freed slots are recycled, last freed first, even through another copy of the pool
+    node_pool<wide, 4> w2(q);
+    w2.deallocate(wides[3], 1);
+    CHECK(w.allocate(1) == wides[3]);
+    for (wide* x : wides)
+        w.deallocate(x, 1);
+    for (std::uint64_t* x : words)
+        q.deallocate(x, 1);
+    p.deallocate(ch, 1);
+
+    // Arrays bypass the slabs
+    int* arr = node_pool<int, 4>(p).allocate(100);
+    arr[99] = 1;
+    node_pool<int, 4>(p).deallocate(arr, 100);
+}
+
+static void check_containers() {
+    std::mt19937 rng(7);
+    node_pool<int> pool;
+    bst<int, node_pool<int>> tree(pool);
+    dl_list<std::string, node_pool<std::string>> list{node_pool<std::string>(pool)};
+    std::multiset<int> model;
+    for (int i = 0; i < 200000; ++i) {
+        const int key = static_cast<int>(rng() % 1000);
+        if (rng() % 2 == 0) {
+            tree.insert(key);
+            model.insert(key);
+            list.push_back(std::to_string(key));
+        }
+        else {
+            if (tree.find(key) != nullptr) {
+                tree.remove(key);
+                model.erase(model.find(key));
+            }
+            if (list.size() != 0)
+                list.pop_front();
+        }
+    }
+    auto it = model.begin();
+    for (int key : tree)
+        CHECK(key == *it++);
+    CHECK(it == model.end());
+    CHECK(tree.get_allocator() == list.get_allocator());
+
+    // Heaps built from one pool can be melded, without going through the node allocator
+    pairing_heap<int> h1;
+    pairing_heap<int> h2(h1.get_allocator());
+    for (int i = 0; i < 100; ++i) {
+        h1.push(i * 2);
+        h2.push(i * 2 + 1);
+    }
+    h1.meld(h2);
+    CHECK(h1.size() == 200 && h2.size() == 0);
+    for (int i = 0; i < 200; ++i) {
+        CHECK(h1.top() == 199 - i);
+        h1.pop();
+    }
+}
+
+int main() {
+    check_rebinding();
+    check_slabs();
+    check_containers();
+    return 0;
+}
@@ -0,0 +1,193 @@
+// 1M random operations on sl_list, dl_list and bst, checked against std:: containers.
+// Every list uses counting_allocator, so the test can prove that all of their bytes come back, and the ASan build (LeakSanitizer) checks the rest.
+#include "check.hpp"
+#include "sl_list.hpp"
+#include "dl_list.hpp"
+#include "bst.hpp"
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+
+using str_alloc = counting_allocator<std::string>;
+using int_alloc = counting_allocator<int>;
+
+template <class List, class Model>
+static void check_same(const List& list, const Model& model) {
+    CHECK(list.size() == model.size());
+    auto it = model.begin();
+    for (const auto& value : list)
+        CHECK(value == *it++);
+}
+
+template <class Tree>
+static void check_same_tree(const Tree& tree, const std::multiset<int>& model) {
+    std::size_t count = 0;
+    auto it = model.begin();
+    for (int value : tree) {
+        CHECK(value == *it++);
+        ++count;
+    }
+    CHECK(count == model.size());
+}
+
+// Long enough to live on the heap, so a leaked value shows up in LeakSanitizer too
+static std::string make_value(unsigned int i) {
+    return std::to_string(i) + std::string(32, 'x');
+}
+
+// Value overloads allocate exactly one node, node-pointer overloads allocate nothing and link the node they are given
+static void check_single_allocation() {
+    {
+        sl_list<std::string, str_alloc> l;
+        const std::ptrdiff_t before = live_bytes;
+        l.push_back(make_value(1));
+        CHECK(live_bytes - before == static_cast<std::ptrdiff_t>(sizeof(node<std::string>)));
+        l.push_front(make_value(2));
+        l.emplace_back(3, 'y');
+        l.insert_node(make_value(4), 1);
+        CHECK(live_bytes - before == static_cast<std::ptrdiff_t>(4 * sizeof(node<std::string>)));
+
+        using node_alloc = std::allocator_traits<str_alloc>::rebind_alloc<node<std::string>>;
+        using node_traits = std::allocator_traits<node_alloc>;
+        node_alloc na;
+        node<std::string>* nd = node_traits::allocate(na, 1);
+        node_traits::construct(na, nd, make_value(5));
+        const std::ptrdiff_t linked = live_bytes;
+        CHECK(l.push_back(nd) == nd);
+        CHECK(l.get_tail() == nd);
+        CHECK(live_bytes == linked);
+    }
+    {
+        dl_list<std::string, str_alloc> d;
+        const std::ptrdiff_t before = live_bytes;
+        d.push_back(make_value(1));
+        d.push_front(make_value(2));
+        d.insert_node(make_value(3), 1);
+        CHECK(live_bytes - before == static_cast<std::ptrdiff_t>(3 * sizeof(double_node<std::string>)));
+    }
+    CHECK(live_bytes == 0);
+
+    // With std::allocator, a node-pointer overload takes a plain new'd node
+    sl_list<std::string> l;
+    node<std::string>* nd = new node<std::string>(make_value(6));
+    CHECK(l.push_front(nd) == nd);
+    dl_list<std::string> d;
+    double_node<std::string>* dn = new double_node<std::string>(make_value(7));
+    CHECK(d.push_back(dn) == dn);
+    CHECK(d.get_tail() == dn);
+
+    // An out of range insert frees the node it made
+    try {
+        l.insert_node(make_value(8), 100);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    CHECK(l.size() == 1);
+}
+
+static void random_operations(unsigned int count) {
+    std::mt19937 rng(12345);
+    sl_list<std::string, str_alloc> l;
+    dl_list<std::string, str_alloc> d;
+    bst<int, int_alloc> b;
+    std::deque<std::string> lm, dm;
+    std::multiset<int> bm;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        const std::string value = make_value(i);
+        const int key = static_cast<int>(rng() % 5000);
+        switch (rng() % 8) {
+        case 0:
+            l.push_back(value);
+            lm.push_back(value);
+            d.push_back(value);
+            dm.push_back(value);
+            break;
+        case 1:
+            l.emplace_front(value);
+            lm.push_front(value);
+            d.push_front(std::string(value));
+            dm.push_front(value);
+            break;
+        case 2:
+            if (l.size() != 0) {
+                l.pop_front();
+                lm.pop_front();
+            }
+            if (d.size() != 0) {
+                d.pop_back();
+                dm.pop_back();
+            }
+            break;
+        case 3:
+            if (l.size() > 1) {
+                l.insert_node(value, 1);
+                lm.insert(lm.begin() + 1, value);
+            }
+            if (d.size() > 2) {
+                d.insert_node(value, 2);
+                dm.insert(dm.begin() + 2, value);
+            }
+            break;
+        case 4:
+            if (l.size() != 0 && l.size() < 64) {
+                l.pop_back();
+                lm.pop_back();
+            }
+            if (d.size() != 0) {
+                d.pop_front();
+                dm.pop_front();
+            }
+            break;
+        case 5:
+        case 6:
+            b.insert(key);
+            bm.insert(key);
+            break;
+        case 7:
+            if (b.find(key) != nullptr) {
+                b.remove(key);
+                bm.erase(bm.find(key));
+            }
+            else
+                CHECK(bm.count(key) == 0);
+            break;
+        }
+
+        if (i % 100000 == 0) {
+            check_same(l, lm);
+            check_same(d, dm);
+            check_same_tree(b, bm);
+
+            // Copies and moves have to free everything they made as well
+            sl_list<std::string, str_alloc> lc(l);
+            lc = l;
+            sl_list<std::string, str_alloc> lmv(std::move(lc));
+            check_same(lmv, lm);
+            dl_list<std::string, str_alloc> dc(d);
+            dc = d;
+            dl_list<std::string, str_alloc> dmv(std::move(dc));
+            check_same(dmv, dm);
+            bst<int, int_alloc> bc(b);
+            bc = b;
+            bst<int, int_alloc> bmv(std::move(bc));
+            check_same_tree(bmv, bm);
+        }
+    }
+    check_same(l, lm);
+    check_same(d, dm);
+    check_same_tree(b, bm);
+    CHECK(live_bytes > 0);
+}
+
+int main() {
+    check_single_allocation();
+    CHECK(live_bytes == 0);
+    random_operations(1000000);
+    CHECK(live_bytes == 0);
+    return 0;
+}
@@ -0,0 +1,153 @@
+// pairing_heap against a std::set of (value, node) pairs: push, pop, decrease_key, erase and meld, with the tree's sibling links and heap order checked along the way.
+// Runs on counting_allocator and on the default node_pool, and checks that heaps with different pools refuse to meld.
+#include "check.hpp"
+#include "pairing_heap.hpp"
+#include "node_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Walks the whole tree without recursion, checks every link and that no child ranks above it's parent, and returns the amount of nodes
+template <class Heap>
+static std::size_t check_structure(const Heap& heap) {
+    using node_type = typename std::remove_pointer<decltype(heap.top_node())>::type;
+    const node_type* root = heap.top_node();
+    if (root == nullptr)
+        return 0;
+    CHECK(root->prev == nullptr && root->next == nullptr);
+    std::size_t count = 0;
+    std::vector<const node_type*> todo{root};
+    while (!todo.empty()) {
+        const node_type* nd = todo.back();
+        todo.pop_back();
+        ++count;
+        const node_type* expected_prev = nd;
+        for (const node_type* c = nd->child; c != nullptr; c = c->next) {
+            CHECK(c->prev == expected_prev);
+            CHECK(!typename Heap::value_compare()(nd->data, c->data));
+            expected_prev = c;
+            todo.push_back(c);
+        }
+    }
+    return count;
+}
+
+template <class Heap>
+static void random_operations(unsigned int seed) {
+    using node_type = typename std::remove_pointer<decltype(std::declval<Heap&>().top_node())>::type;
+    // In a min-heap the top is the smallest value, and decrease_key() lowers values. A max-heap does the opposite.
+    constexpr bool min_heap = std::is_same<typename Heap::value_compare, std::greater<int>>::value;
+    constexpr int toward_top = min_heap ? -1 : 1;
+    std::mt19937 rng(seed);
+    Heap heap;
+    std::set<std::pair<int, node_type*>> model;
+    std::vector<node_type*> handles;
+
+    for (int i = 0; i < 200000; ++i) {
+        const int value = static_cast<int>(rng() % 100000);
+        switch (rng() % 6) {
+        case 0:
+        case 1:
+            model.insert({value, heap.push(value)});
+            break;
+        case 2:
+            if (!model.empty()) {
+                CHECK(heap.top() == (min_heap ? model.begin()->first : model.rbegin()->first));
+                CHECK(model.erase({heap.top(), heap.top_node()}) == 1);
+                heap.pop();
+            }
+            break;
+        case 3:
+        case 4: {
+            // A random live node, found through the model so popped handles are never touched
+            if (model.empty())
+                break;
+            auto it = model.lower_bound({value, nullptr});
+            if (it == model.end())
+                it = model.begin();
+            const std::pair<int, node_type*> picked = *it;
+            model.erase(it);
+            if (rng() % 3 == 0)
+                heap.erase(picked.second);
+            else {
+                const int higher = picked.first + toward_top * static_cast<int>(rng() % 5000);
+                heap.decrease_key(picked.second, higher);
+                CHECK(picked.second->data == higher);
+                model.insert({higher, picked.second});
+            }
+            break;
+        }
+        case 5: {
+            // Meld a small heap built from the same allocator, it's handles stay valid
+            Heap other(heap.get_allocator());
+            for (int k = 0; k < 5; ++k) {
+                const int v = static_cast<int>(rng() % 100000);
+                model.insert({v, other.push(v)});
+            }
+            heap.meld(other);
+            CHECK(other.empty() && other.top_node() == nullptr);
+            break;
+        }
+        }
+        CHECK(heap.size() == model.size());
+        if (i % 20000 == 0)
+            CHECK(check_structure(heap) == model.size());
+    }
+    CHECK(check_structure(heap) == model.size());
+
+    // Copies are deep, and drain in the same order
+    Heap copy(heap);
+    CHECK(check_structure(copy) == model.size());
+    Heap assigned;
+    assigned = copy;
+    Heap moved(std::move(copy));
+    std::vector<int> order;
+    for (const auto& kv : model)
+        order.push_back(kv.first);
+    if (!min_heap)
+        std::reverse(order.begin(), order.end());
+    for (int value : order) {
+        CHECK(moved.top() == value && assigned.top() == value);
+        moved.pop();
+        assigned.pop();
+    }
+    CHECK(moved.empty() && assigned.empty());
+
+    try {
+        heap.decrease_key(nullptr, 0);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    if (!heap.empty()) {
+        try {
+            heap.decrease_key(heap.top_node(), heap.top() - toward_top);
+            CHECK(false);
+        }
+        catch (const std::invalid_argument&) { }
+    }
+}
+
+int main() {
+    random_operations<pairing_heap<int, std::greater<int>, counting_allocator<int>>>(1);
+    CHECK(live_bytes == 0);
+    random_operations<pairing_heap<int, std::greater<int>>>(2);
+    random_operations<pairing_heap<int, std::less<int>>>(3);
+
+    // Two default constructed heaps have their own pools, so their nodes can't be mixed
+    pairing_heap<int> a, b;
+    a.push(1);
+    b.push(2);
+    try {
+        a.meld(b);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    CHECK(a.size() == 1 && b.size() == 1);
+    return 0;
+}
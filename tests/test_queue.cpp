@@ -0,0 +1,148 @@
+// queue against std::deque, spsc_queue with a producer and a consumer thread, and mpmc_queue with several of each.
+// The ring buffers mix single and batch operations, and every value must come out exactly once, in order per producer.
+#include "check.hpp"
+#include "queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void single_thread_queue() {
+    std::mt19937 rng(13);
+    queue<std::string> q;
+    std::deque<std::string> model;
+    for (int i = 0; i < 100000; ++i) {
+        if (rng() % 3 != 0) {
+            q.push(std::to_string(i));
+            model.push_back(std::to_string(i));
+        }
+        else if (!model.empty()) {
+            CHECK(q.front() == model.front());
+            q.pop();
+            model.pop_front();
+        }
+        CHECK(q.size() == model.size());
+        if (!model.empty())
+            CHECK(q.back() == model.back());
+    }
+    q.emplace(2, 'x');
+    CHECK(q.back() == "xx");
+    q.clear();
+    CHECK(q.empty());
+}
+
+static void spsc(long count) {
+    spsc_queue<std::string> q(1000);
+    CHECK(q.capacity() == 1024);
+    std::thread producer([&] {
+        for (long i = 0; i < count;) {
+            if (i % 3 == 0) {
+                std::string batch[7];
+                const long n = std::min<long>(7, count - i);
+                for (long k = 0; k < n; ++k)
+                    batch[k] = std::to_string(i + k);
+                i += static_cast<long>(q.try_push_n(batch, static_cast<std::size_t>(n)));
+            }
+            else if (q.try_push(std::to_string(i)))
+                ++i;
+            else
+                std::this_thread::yield();
+        }
+    });
+    long expected = 0;
+    while (expected < count) {
+        std::string out[5];
+        const std::size_t n = q.try_pop_n(out, 5);
+        for (std::size_t k = 0; k < n; ++k)
+            CHECK(out[k] == std::to_string(expected++));
+        std::string one;
+        if (q.try_pop(one))
+            CHECK(one == std::to_string(expected++));
+        else if (n == 0)
+            std::this_thread::yield();
+    }
+    producer.join();
+    CHECK(q.empty());
+
+    // Values which were never popped are destroyed with the queue
+    spsc_queue<std::string> leftovers(4);
+    leftovers.try_push(std::string(40, 'a'));
+    leftovers.try_push(std::string(40, 'b'));
+}
+
+static void mpmc(int producers, int consumers, long per_producer) {
+    mpmc_queue<long> q(256);
+    const long total = per_producer * producers;
+    std::atomic<long> popped{0};
+    std::vector<std::vector<long>> seen(static_cast<std::size_t>(consumers));
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            const long base = p * per_producer;
+            for (long i = 0; i < per_producer;) {
+                if (i % 2 == 1) {
+                    long batch[4];
+                    const long n = std::min<long>(4, per_producer - i);
+                    for (long k = 0; k < n; ++k)
+                        batch[k] = base + i + k;
+                    i += static_cast<long>(q.try_push_n(batch, static_cast<std::size_t>(n)));
+                }
+                else if (q.try_push(base + i))
+                    ++i;
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::vector<long>& mine = seen[static_cast<std::size_t>(c)];
+            long out[3];
+            while (popped.load() < total) {
+                const std::size_t n = q.try_pop_n(out, 3);
+                mine.insert(mine.end(), out, out + n);
+                popped += static_cast<long>(n);
+                if (n == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (std::thread& t : threads)
+        t.join();
+
+    // Each consumer sees the values of one producer in the order they were pushed
+    std::vector<long> all;
+    for (const std::vector<long>& mine : seen) {
+        std::vector<long> last(static_cast<std::size_t>(producers), -1);
+        for (long value : mine) {
+            long& prev = last[static_cast<std::size_t>(value / per_producer)];
+            CHECK(value > prev);
+            prev = value;
+        }
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    std::sort(all.begin(), all.end());
+    CHECK(static_cast<long>(all.size()) == total);
+    for (long i = 0; i < total; ++i)
+        CHECK(all[static_cast<std::size_t>(i)] == i);
+
+    mpmc_queue<std::string> full(8);
+    for (int i = 0; i < 8; ++i)
+        CHECK(full.try_push(std::to_string(i)));
+    CHECK(!full.try_push("x"));
+    std::string out;
+    CHECK(full.try_pop(out) && out == "0");
+}
+
+int main() {
+    single_thread_queue();
+    spsc(200000);
+    mpmc(1, 1, 100000);
+    mpmc(2, 2, 50000);
+    mpmc(4, 4, 25000);
+    mpmc(4, 1, 25000);
+    return 0;
+}
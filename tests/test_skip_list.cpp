@@ -0,0 +1,224 @@
+// skip_list against std::set, and indexed_skip_list against std::vector: random inserts, removes, searches and positional edits.
+// Every tower link is checked too: link i has to reach the next node taller than i, and in an indexed list it has to skip exactly it's width.
+#include "check.hpp"
+#include "skip_list.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <class T, bool Indexed>
+static void check_towers(skip_node<T, Indexed>* first) {
+    std::vector<skip_node<T, Indexed>*> nodes;
+    for (skip_node<T, Indexed>* nd = first; nd != nullptr; nd = nd->get_next())
+        nodes.push_back(nd);
+    for (std::size_t p = 0; p < nodes.size(); ++p) {
+        skip_node<T, Indexed>* nd = nodes[p];
+        for (std::size_t i = 0; i < nd->get_height(); ++i) {
+            std::size_t q = p + 1;
+            while (q < nodes.size() && nodes[q]->get_height() <= i)
+                ++q;
+            CHECK(nd->links()[i].next == (q < nodes.size() ? nodes[q] : nullptr));
+            if constexpr (Indexed) {
+                if (q < nodes.size())
+                    CHECK(nd->links()[i].width == q - p);
+            }
+        }
+    }
+}
+
+template <class Set, class Model>
+static void check_same(const Set& set, const Model& model) {
+    CHECK(set.size() == model.size());
+    CHECK(std::equal(set.begin(), set.end(), model.begin(), model.end()));
+    check_towers(set.min());
+}
+
+template <class Compare>
+static void ordered_set(unsigned int seed) {
+    std::mt19937 rng(seed);
+    skip_list<int, Compare, counting_allocator<int>> set;
+    std::set<int, Compare> model;
+    for (int step = 0; step < 200000; ++step) {
+        const int key = static_cast<int>(rng() % 3000);
+        switch (rng() % 4) {
+        case 0:
+        case 1: {
+            const bool fresh = model.insert(key).second;
+            const std::size_t before = set.size();
+            auto nd = set.insert(key);
+            CHECK(nd != nullptr && nd->get_data() == key);
+            CHECK(set.size() == before + (fresh ? 1 : 0));
+            break;
+        }
+        case 2: {
+            const auto it = model.find(key);
+            auto next = set.remove(key);
+            if (it != model.end()) {
+                const auto after = model.erase(it);
+                CHECK(after == model.end() ? next == nullptr : next != nullptr && next->get_data() == *after);
+            }
+            else
+                CHECK(next == nullptr);
+            break;
+        }
+        default: {
+            CHECK(set.contains(key) == (model.count(key) != 0));
+            const auto lower = model.lower_bound(key), upper = model.upper_bound(key);
+            CHECK(lower == model.end() ? set.lower_bound(key) == set.end() : *set.lower_bound(key) == *lower);
+            CHECK(upper == model.end() ? set.successor(key) == nullptr : set.successor(key)->get_data() == *upper);
+            auto pred = set.predecessor(key);
+            CHECK(lower == model.begin() ? pred == nullptr : pred != nullptr && pred->get_data() == *std::prev(lower));
+            CHECK(model.empty() ? set.min() == nullptr && set.max() == nullptr
+                                : set.min()->get_data() == *model.begin() && set.max()->get_data() == *model.rbegin());
+
+            const int hi = Compare()(0, 1) ? key + 200 : key - 200;
+            std::vector<int> got;
+            set.for_each_in_range(key, hi, [&](const int& value) {got.push_back(value);});
+            CHECK(got == std::vector<int>(lower, model.lower_bound(hi)));
+            break;
+        }
+        }
+        if (step % 20000 == 0)
+            check_same(set, model);
+    }
+    check_same(set, model);
+
+    skip_list<int, Compare, counting_allocator<int>> copy(set);
+    check_same(copy, model);
+    skip_list<int, Compare, counting_allocator<int>> moved(std::move(copy));
+    CHECK(copy.empty() && copy.min() == nullptr);
+    check_same(moved, model);
+    copy = moved;
+    check_same(copy, model);
+    moved.clear();
+    CHECK(moved.empty() && moved.begin() == moved.end());
+}
+
+static void indexed_list(unsigned int seed) {
+    std::mt19937 rng(seed);
+    indexed_skip_list<std::string, counting_allocator<std::string>> list;
+    std::vector<std::string> model;
+    for (int step = 0; step < 50000; ++step) {
+        // Long enough to live on the heap, so a value that's dropped or copied twice shows up in the sanitizers
+        const std::string value = std::to_string(step) + std::string(24, 'v');
+        const unsigned int n = static_cast<unsigned int>(list.size());
+        switch (rng() % 8) {
+        case 0:
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        case 1:
+            list.emplace_front(value);
+            model.insert(model.begin(), value);
+            break;
+        case 2:
+        case 3:
+            if (n != 0) {
+                const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                CHECK(list.insert_node(value, idx) == value);
+                model.insert(model.begin() + idx, value);
+            }
+            else {
+                list.insert_node(value, 0);
+                model.push_back(value);
+            }
+            break;
+        case 4:
+            if (n != 0) {
+                const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                list.erase(idx);
+                model.erase(model.begin() + idx);
+            }
+            break;
+        case 5:
+            if (n != 0) {
+                if (rng() % 2 == 0) {
+                    list.pop_back();
+                    model.pop_back();
+                }
+                else {
+                    list.pop_front();
+                    model.erase(model.begin());
+                }
+            }
+            break;
+        case 6:
+            // The value comes from the list itself
+            if (n != 0) {
+                const unsigned int from = static_cast<unsigned int>(rng() % n);
+                const unsigned int to = static_cast<unsigned int>(rng() % n);
+                const std::string copy = model[from];
+                list.insert_node(list[from], to);
+                model.insert(model.begin() + to, copy);
+            }
+            break;
+        default:
+            if (n != 0) {
+                const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                CHECK(list[idx] == model[idx] && list.at(idx) == model[idx]);
+                CHECK(list.front() == model.front() && list.back() == model.back());
+                list[idx] += '!';
+                model[idx] += '!';
+            }
+            break;
+        }
+        CHECK(list.size() == model.size());
+        if (step % 5000 == 0) {
+            CHECK(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+            check_towers(list.get_head());
+        }
+    }
+    CHECK(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    check_towers(list.get_head());
+
+    indexed_skip_list<std::string, counting_allocator<std::string>> copy(list);
+    CHECK(std::equal(copy.begin(), copy.end(), model.begin(), model.end()));
+    check_towers(copy.get_head());
+    for (unsigned int i = 0; i < model.size(); i += 97)
+        CHECK(copy[i] == model[i]);
+    indexed_skip_list<std::string, counting_allocator<std::string>> moved(std::move(copy));
+    CHECK(copy.empty() && copy.get_head() == nullptr);
+    copy = moved;
+    CHECK(copy.size() == model.size() && copy.back() == model.back());
+
+    try {
+        list.insert_node(model.front(), static_cast<unsigned int>(list.size() + 1));
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        list.at(static_cast<unsigned int>(list.size()));
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    try {
+        list.erase(static_cast<unsigned int>(list.size()));
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    list.clear();
+    list.pop_front();
+    try {
+        list.pop_back();
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    list.push_back("last");
+    CHECK(list.front() == "last" && list.back() == "last");
+}
+
+int main() {
+    ordered_set<std::less<int>>(1);
+    ordered_set<std::greater<int>>(2);
+    CHECK(live_bytes == 0);
+    indexed_list(3);
+    CHECK(live_bytes == 0);
+    return 0;
+}
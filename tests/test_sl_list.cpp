@@ -0,0 +1,106 @@
+// Random operations on sl_list against std::deque, with a lot of pop_back() mixed in, so the spine gets built, extended, cut and dropped.
+#include "check.hpp"
+#include "sl_list.hpp"
+#include "node_pool.hpp"
+#include <deque>
+#include <random>
+#include <utility>
+
+template <class List>
+static void check_same(const List& list, const std::deque<int>& model) {
+    CHECK(list.size() == model.size());
+    CHECK((list.get_tail() == nullptr) == model.empty());
+    if (!model.empty())
+        CHECK(list.get_tail()->get_data() == model.back());
+    auto it = model.begin();
+    for (int value : list)
+        CHECK(value == *it++);
+}
+
+template <class List>
+static void random_operations(unsigned int count, unsigned int seed) {
+    std::mt19937 rng(seed);
+    List list;
+    std::deque<int> model;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        const int value = static_cast<int>(i);
+        switch (rng() % 9) {
+        case 0:
+        case 1:
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        case 2:
+            list.push_front(value);
+            model.push_front(value);
+            break;
+        case 3:
+        case 4:
+            if (!model.empty()) {
+                list.pop_back();
+                model.pop_back();
+            }
+            break;
+        case 5:
+            if (!model.empty()) {
+                list.pop_front();
+                model.pop_front();
+            }
+            break;
+        case 6:
+            if (!model.empty()) {
+                const unsigned int idx = rng() % model.size();
+                list.insert_node(value, idx);
+                model.insert(model.begin() + idx, value);
+            }
+            break;
+        case 7:
+            if (!model.empty()) {
+                list.set_head(new node<int>(value));
+                model.front() = value;
+            }
+            break;
+        case 8:
+            if (rng() % 16 == 0) {
+                List moved(std::move(list));
+                list = std::move(moved);
+            }
+            break;
+        }
+        if (i % 1000 == 0)
+            check_same(list, model);
+    }
+    check_same(list, model);
+
+    // Draining from the back ends with an empty list, and the list can be refilled afterwards
+    while (!model.empty()) {
+        list.pop_back();
+        model.pop_back();
+    }
+    check_same(list, model);
+    list.push_back(1);
+    list.pop_back();
+    CHECK(list.get_head() == nullptr && list.get_tail() == nullptr);
+}
+
+int main() {
+    random_operations<sl_list<int>>(200000, 1);
+    random_operations<sl_list<int>>(200000, 2);
+    // set_head() hands over a new'd node, so the pooled list only gets the other operations
+    std::mt19937 rng(3);
+    sl_list<int, node_pool<int>> pooled;
+    std::deque<int> model;
+    for (int i = 0; i < 100000; ++i) {
+        if (rng() % 3 != 0 || model.empty()) {
+            pooled.push_back(i);
+            model.push_back(i);
+        }
+        else {
+            pooled.pop_back();
+            model.pop_back();
+        }
+    }
+    check_same(pooled, model);
+    return 0;
+}
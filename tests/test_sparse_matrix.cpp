@@ -0,0 +1,105 @@
+// csr_matrix and csc_matrix against a dense matrix, built from random COO triplets [with duplicates, which are summed].
+// Values are small integers, so every product has to match the dense one exactly, serial or on a pool.
+#include "check.hpp"
+#include "sparse_matrix.hpp"
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+static void against_dense(std::mt19937& rng, std::size_t rows, std::size_t cols, std::size_t count, thread_pool& pool) {
+    coo_builder<double> builder(rows, cols);
+    matrix<double> dense(rows, cols);
+    for (std::size_t k = 0; k < count; ++k) {
+        const std::size_t r = rng() % rows, c = rng() % cols;
+        const double v = static_cast<double>(rng() % 7 + 1);
+        builder.add(r, c, v);
+        dense(r, c) += v;
+    }
+    const csr_matrix<double> csr = builder.build();
+    const csc_matrix<double> csc = builder.build<false>();
+    CHECK(csr.rows() == rows && csr.cols() == cols && csc.rows() == rows && csc.cols() == cols);
+
+    std::size_t nonzero = 0;
+    for (std::size_t r = 0; r < rows; ++r)
+        for (std::size_t c = 0; c < cols; ++c) {
+            nonzero += dense(r, c) != 0;
+            CHECK(csr.get(r, c) == dense(r, c) && csc.get(r, c) == dense(r, c));
+        }
+    CHECK(csr.nnz() == nonzero && csc.nnz() == nonzero);
+    CHECK(csr_matrix<double>(dense).nnz() == nonzero);
+    CHECK(csc_matrix<double>(dense).get_indices() == csc.get_indices());
+
+    // Within every row [column] the indices are sorted
+    const std::vector<std::size_t>& offsets = csr.get_offsets();
+    CHECK(offsets.size() == rows + 1 && offsets.back() == nonzero);
+    for (std::size_t r = 0; r < rows; ++r)
+        for (std::size_t i = offsets[r] + 1; i < offsets[r + 1]; ++i)
+            CHECK(csr.get_indices()[i - 1] < csr.get_indices()[i]);
+
+    // SpMV, serial and on the pool
+    std::vector<double> x(cols);
+    for (double& v : x)
+        v = static_cast<double>(rng() % 5);
+    const std::vector<double> y_csr = csr * x, y_csc = csc * x;
+    std::vector<double> y_pool(rows);
+    csr.multiply(x.data(), y_pool.data(), pool);
+    for (std::size_t r = 0; r < rows; ++r) {
+        double sum = 0;
+        for (std::size_t c = 0; c < cols; ++c)
+            sum += dense(r, c) * x[c];
+        CHECK(y_csr[r] == sum && y_csc[r] == sum && y_pool[r] == sum);
+    }
+
+    // Conversions both ways
+    CHECK(csc.to_csr().to_dense() == dense);
+    CHECK(csr.to_csc().to_dense() == dense);
+    CHECK(csr.to_csc().get_indices() == csc.get_indices());
+    CHECK(csr.to_csr().get_values() == csr.get_values());
+
+    // Sparse x dense
+    matrix<double> b(cols, 7);
+    for (std::size_t r = 0; r < cols; ++r)
+        for (std::size_t c = 0; c < 7; ++c)
+            b(r, c) = static_cast<double>(rng() % 3);
+    const matrix<double> product = dense * b;
+    CHECK(csr.multiply(b) == product);
+    CHECK(csc.multiply(b) == product);
+    CHECK(csr.multiply(b, pool) == product);
+}
+
+int main() {
+    std::mt19937 rng(18);
+    thread_pool pool(3);
+    for (int i = 0; i < 40; ++i) {
+        const std::size_t rows = rng() % 60 + 1, cols = rng() % 60 + 1;
+        against_dense(rng, rows, cols, rows * cols / (i % 2 == 0 ? 5 : 50), pool);
+    }
+    against_dense(rng, 2000, 1500, 20000, pool);
+
+    coo_builder<double> builder(3, 4);
+    try {
+        builder.add(3, 0, 1.0);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    const csr_matrix<double> empty = builder.build();
+    CHECK(empty.nnz() == 0 && empty.get(2, 3) == 0);
+    CHECK(empty * std::vector<double>(4, 1.0) == std::vector<double>(3, 0.0));
+    try {
+        empty.get(0, 4);
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    try {
+        const std::vector<double> y = empty * std::vector<double>(3);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        const matrix<double> p = empty.multiply(matrix<double>(3, 3));
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    return 0;
+}
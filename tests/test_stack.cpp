@@ -0,0 +1,96 @@
+// stack on each storage backend against std::vector, plus pushing an item of the stack onto itself while it grows.
+#include "check.hpp"
+#include "stack.hpp"
+#include "node_pool.hpp"
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <class Stack>
+static void random_operations(unsigned int seed) {
+    std::mt19937 rng(seed);
+    Stack s;
+    std::vector<std::string> model;
+    for (int i = 0; i < 200000; ++i) {
+        switch (rng() % 5) {
+        case 0:
+        case 1:
+            s.push(std::to_string(i) + std::string(20, 'x'));
+            model.push_back(std::to_string(i) + std::string(20, 'x'));
+            break;
+        case 2:
+            s.emplace(3, 'z');
+            model.emplace_back(3, 'z');
+            break;
+        case 3:
+            if (!model.empty()) {
+                s.pop();
+                model.pop_back();
+            }
+            break;
+        case 4:
+            // top() is a reference, and pushing it may reallocate the storage it points into
+            if (!model.empty()) {
+                s.push(s.top());
+                model.push_back(model.back());
+            }
+            break;
+        }
+        CHECK(s.size() == model.size());
+        if (!model.empty())
+            CHECK(s.top() == model.back());
+
+        if (i % 20000 == 0) {
+            Stack copy(s);
+            Stack moved(std::move(copy));
+            Stack assigned;
+            assigned = moved;
+            while (!model.empty() && assigned.size() != 0) {
+                CHECK(assigned.top() == model[assigned.size() - 1]);
+                assigned.pop();
+            }
+        }
+    }
+    s.clear();
+    CHECK(s.empty());
+}
+
+template <class Stack>
+static void self_push_when_full() {
+    Stack s;
+    for (int i = 0; i < 8; ++i)
+        s.push(std::string(40, static_cast<char>('a' + i)));
+    // Every push doubles past a power of two, so each of these hits a full buffer at some point
+    for (int i = 0; i < 100; ++i) {
+        s.push(s.top());
+        CHECK(s.top() == std::string(40, 'h'));
+    }
+    s.emplace(s.top());
+    CHECK(s.top() == std::string(40, 'h'));
+}
+
+int main() {
+    random_operations<stack<std::string>>(1);
+    random_operations<stack<std::string, stack_list<std::string>>>(2);
+    random_operations<stack<std::string, stack_list<std::string, node_pool<std::string>>>>(3);
+    random_operations<small_stack<std::string, 4>>(4);
+    random_operations<small_stack<std::string, 64>>(5);
+
+    self_push_when_full<stack<std::string>>();
+    self_push_when_full<small_stack<std::string, 8>>();
+    self_push_when_full<stack<std::string, stack_list<std::string>>>();
+
+    // Move-only items
+    stack<std::unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i)
+        owners.emplace(new int(i));
+    CHECK(*owners.top() == 99);
+
+    small_stack<int, 16> inline_only;
+    for (int i = 0; i < 16; ++i)
+        inline_only.push(i);
+    CHECK(inline_only.get_storage().capacity() == 16);
+    return 0;
+}
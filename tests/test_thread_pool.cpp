@@ -0,0 +1,102 @@
+// thread_pool and the parallel matrix operations: gemm() and transpose() on a pool must be bit for bit equal to the serial ones for any amount of threads.
+// parallel_for() must cover every index exactly once, pass exceptions on, run nested loops inline, and serialize loops started from several threads.
+#include "check.hpp"
+#include "matrix.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using dmatrix = matrix<double>;
+
+static dmatrix random_matrix(std::size_t rows, std::size_t cols, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(-1, 1);
+    dmatrix m(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            m(i, j) = dist(rng);
+    return m;
+}
+
+static void deterministic_matrix_operations() {
+    std::mt19937 rng(17);
+    const std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> shapes{{1, 1, 1}, {64, 64, 64}, {200, 300, 150}, {513, 129, 260}};
+    for (const auto& shape : shapes) {
+        const std::size_t m = std::get<0>(shape), k = std::get<1>(shape), n = std::get<2>(shape);
+        const dmatrix a = random_matrix(m, k, rng), b = random_matrix(k, n, rng), c0 = random_matrix(m, n, rng);
+        dmatrix serial = c0;
+        dmatrix::gemm(0.5, a, b, 2.0, serial);
+        const dmatrix serial_t = a.transpose();
+
+        for (std::size_t threads : {1, 2, 3, 8}) {
+            thread_pool pool(threads);
+            CHECK(pool.size() == threads);
+            dmatrix c = c0;
+            dmatrix::gemm(0.5, a, b, 2.0, c, pool);
+            CHECK(c == serial);
+            CHECK(a.transpose(pool) == serial_t);
+        }
+    }
+}
+
+static void loops() {
+    thread_pool pool(4);
+    for (std::size_t grain : {1, 7, 64, 1000, 5000}) {
+        std::vector<std::atomic<int>> hits(1000);
+        pool.parallel_for(0, 1000, grain, [&](std::size_t lo, std::size_t hi) {
+            CHECK(lo < hi && hi - lo <= grain);
+            for (std::size_t i = lo; i < hi; ++i)
+                ++hits[i];
+        });
+        for (const std::atomic<int>& h : hits)
+            CHECK(h.load() == 1);
+    }
+    pool.parallel_for(5, 5, 1, [](std::size_t, std::size_t) {CHECK(false);});
+
+    try {
+        pool.parallel_for(0, 10, 0, [](std::size_t, std::size_t) { });
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+
+    // The loop still finishes, and the pool stays usable
+    try {
+        pool.parallel_for(0, 100, 1, [](std::size_t lo, std::size_t) {
+            if (lo == 50)
+                throw std::runtime_error("chunk 50");
+        });
+        CHECK(false);
+    }
+    catch (const std::runtime_error&) { }
+
+    // Nested loops run inline on whichever thread runs the outer chunk
+    std::atomic<int> inner{0};
+    pool.parallel_for(0, 16, 1, [&](std::size_t, std::size_t) {
+        pool.parallel_for(0, 100, 10, [&](std::size_t lo, std::size_t hi) {inner += static_cast<int>(hi - lo);});
+    });
+    CHECK(inner.load() == 1600);
+
+    // Loops started from several threads at once are serialized, not mixed up
+    std::atomic<long> total{0};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t)
+        callers.emplace_back([&] {
+            for (int r = 0; r < 50; ++r)
+                pool.parallel_for(0, 64, 1, [&](std::size_t lo, std::size_t hi) {total += static_cast<long>(hi - lo);});
+        });
+    for (std::thread& c : callers)
+        c.join();
+    CHECK(total.load() == 4 * 50 * 64);
+}
+
+int main() {
+    deterministic_matrix_operations();
+    loops();
+    thread_pool defaulted;
+    CHECK(defaulted.size() >= 1);
+    return 0;
+}
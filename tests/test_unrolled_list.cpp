@@ -0,0 +1,150 @@
+// unrolled_list against std::deque: random pushes, pops, indexed inserts and erases on small and default block sizes, with iterators both ways.
+// Also inserts values which live in the list itself [like insert_node(l[6], 1)], where a block split must not move the value before it's copied.
+#include "check.hpp"
+#include "unrolled_list.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+template <class List>
+static void check_same(const List& list, const std::deque<std::string>& model) {
+    CHECK(list.size() == model.size());
+    CHECK(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    CHECK(std::equal(list.rbegin(), list.rend(), model.rbegin(), model.rend()));
+}
+
+template <std::size_t Capacity>
+static void random_operations(unsigned int seed) {
+    using list_type = unrolled_list<std::string, Capacity, counting_allocator<std::string>>;
+    std::mt19937 rng(seed);
+    {
+        list_type list;
+        std::deque<std::string> model;
+        for (int step = 0; step < 40000; ++step) {
+            // Long enough to live on the heap, so a value that's dropped or copied twice shows up in the sanitizers
+            const std::string value = std::to_string(step) + std::string(24, 'v');
+            const unsigned int n = list.size();
+            switch (rng() % 10) {
+            case 0:
+            case 1:
+                list.push_back(value);
+                model.push_back(value);
+                break;
+            case 2:
+                list.emplace_front(value);
+                model.push_front(value);
+                break;
+            case 3:
+                if (n != 0) {
+                    const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                    CHECK(list.insert_node(value, idx) == value);
+                    model.insert(model.begin() + idx, value);
+                }
+                break;
+            case 4:
+                if (n != 0) {
+                    list.pop_back();
+                    model.pop_back();
+                }
+                break;
+            case 5:
+                list.pop_front();
+                if (!model.empty())
+                    model.pop_front();
+                break;
+            case 6:
+                if (n != 0) {
+                    const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                    list.erase(idx);
+                    model.erase(model.begin() + idx);
+                }
+                break;
+            case 7:
+                // The value comes from the list, and the insert may split it's block
+                if (n != 0) {
+                    const unsigned int from = static_cast<unsigned int>(rng() % n);
+                    const unsigned int to = static_cast<unsigned int>(rng() % n);
+                    const std::string copy = model[from];
+                    list.insert_node(list[from], to);
+                    model.insert(model.begin() + to, copy);
+                }
+                break;
+            case 8:
+                if (n != 0) {
+                    const std::string first = model.front(), last = model.back();
+                    list.push_back(list.front());
+                    list.push_front(list.back());
+                    model.push_back(first);
+                    model.push_front(model.back());
+                }
+                break;
+            default:
+                if (n != 0) {
+                    const unsigned int idx = static_cast<unsigned int>(rng() % n);
+                    CHECK(list[idx] == model[idx] && list.at(idx) == model[idx]);
+                    CHECK(list.front() == model.front() && list.back() == model.back());
+                }
+                break;
+            }
+            CHECK(list.size() == model.size());
+            if (step % 5000 == 0)
+                check_same(list, model);
+        }
+        check_same(list, model);
+
+        list_type copy(list);
+        check_same(copy, model);
+        list_type assigned;
+        assigned = copy;
+        list_type moved(std::move(copy));
+        CHECK(copy.size() == 0);
+        check_same(moved, model);
+        check_same(assigned, model);
+        moved.clear();
+        CHECK(moved.empty() && moved.begin() == moved.end());
+    }
+    CHECK(live_bytes == 0);
+}
+
+int main() {
+    // The case which once inserted a moved-from value: the source sits in the block that gets split
+    unrolled_list<std::string, 4> l;
+    for (int i = 0; i < 8; ++i)
+        l.push_back(std::to_string(i) + std::string(24, 'x'));
+    const std::string six = l[6];
+    l.insert_node(l[6], 1);
+    CHECK(l[1] == six && l[7] == six && l.size() == 9);
+
+    random_operations<2>(1);
+    random_operations<4>(2);
+    random_operations<unrolled_block_capacity<std::string>()>(3);
+
+    try {
+        l.insert_node("past the end", l.size() + 1);
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    try {
+        l.at(l.size());
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    try {
+        l.erase(l.size());
+        CHECK(false);
+    }
+    catch (const std::out_of_range&) { }
+    unrolled_list<int> empty;
+    try {
+        empty.pop_back();
+        CHECK(false);
+    }
+    catch (const std::invalid_argument&) { }
+    empty.pop_front();
+    CHECK(empty.size() == 0);
+    return 0;
+}